@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _BRIDGE_STREAM_H_
+#define _BRIDGE_STREAM_H_
+
+/**
+ * @brief Direct data streaming between the UART and USB CDC ACM modules
+ * @defgroup bridge_stream Bridge data streaming
+ * @{
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief UART bridging statistics. */
+struct bridge_stream_stats {
+	/** Number of bytes received over UART. */
+	uint32_t rx_bytes;
+	/** Number of bytes received over UART that were not accepted by USB CDC ACM. */
+	uint32_t rx_dropped;
+	/** Number of times no UART receive buffer was available. */
+	uint32_t rx_buf_overflows;
+	/** Number of bytes queued for transmission over UART. */
+	uint32_t tx_bytes;
+	/** Number of bytes dropped because the UART transmit buffer was full. */
+	uint32_t tx_dropped;
+};
+
+/** @brief Function used to read the data that is to be transmitted over UART.
+ *
+ * @param buf Buffer for the data.
+ * @param len Size of the buffer.
+ * @param user_data User data.
+ *
+ * @return Number of bytes read.
+ */
+typedef int (*bridge_stream_read_t)(uint8_t *buf, size_t len, void *user_data);
+
+/** @brief Read data directly into the UART transmit buffer and start the transmission.
+ *
+ * The function can be called from an interrupt context. The function reads until no more
+ * data is available. The data that does not fit in the UART transmit buffer is dropped.
+ *
+ * @param dev_idx UART device index.
+ * @param read Function used to read the data.
+ * @param user_data User data passed to the read function.
+ *
+ * @return Number of bytes queued for transmission or a negative error code.
+ */
+int uart_handler_stream_tx_fill(uint8_t dev_idx, bridge_stream_read_t read, void *user_data);
+
+/** @brief Get the UART bridging statistics.
+ *
+ * @param dev_idx UART device index.
+ * @param stats Statistics.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL If the device index is invalid.
+ */
+int uart_handler_stats_get(uint8_t dev_idx, struct bridge_stream_stats *stats);
+
+/** @brief Write data received over UART directly to USB CDC ACM.
+ *
+ * The function can be called from an interrupt context.
+ *
+ * @param dev_idx USB CDC ACM device index.
+ * @param buf Data.
+ * @param len Data length.
+ *
+ * @return Number of bytes written, or -ENOTCONN if the port is not opened by the USB host.
+ */
+int usb_cdc_handler_stream_write(uint8_t dev_idx, const uint8_t *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _BRIDGE_STREAM_H_ */
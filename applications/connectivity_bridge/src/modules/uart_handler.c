@@ -15,6 +15,7 @@
 #include "ble_data_event.h"
 #include "cdc_data_event.h"
 #include "uart_data_event.h"
+#include "bridge_stream.h"
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(MODULE, CONFIG_BRIDGE_UART_LOG_LEVEL);
@@ -47,9 +48,18 @@ struct uart_rx_buf {
 
 struct uart_tx_buf {
 	struct ring_buf rb;
+	struct k_spinlock lock;
 	uint8_t buf[UART_BUF_SIZE];
 };
 
+struct uart_stats {
+	atomic_t rx_bytes;
+	atomic_t rx_dropped;
+	atomic_t rx_buf_overflows;
+	atomic_t tx_bytes;
+	atomic_t tx_dropped;
+};
+
 BUILD_ASSERT((sizeof(struct uart_rx_buf) % UART_SLAB_ALIGNMENT) == 0);
 
 /* Blocks from the same slab is used for RX for all UART instances */
@@ -63,6 +73,9 @@ static uint32_t uart_default_baudrate[UART_DEVICE_COUNT];
 static int subscriber_count[UART_DEVICE_COUNT];
 static bool enable_rx_retry[UART_DEVICE_COUNT];
 static atomic_t uart_tx_started[UART_DEVICE_COUNT];
+static struct uart_stats uart_stats[UART_DEVICE_COUNT];
+/* BLE UART Service is connected, always mapped to UART_0 */
+static bool ble_subscribed;
 
 static void enable_uart_rx(uint8_t dev_idx);
 static void disable_uart_rx(uint8_t dev_idx);
@@ -123,23 +136,44 @@ static void uart_rx_buf_unref(void *buf)
 	}
 }
 
+static void uart_rx_data(int dev_idx, uint8_t *buf, size_t len)
+{
+	struct uart_data_event *event;
+
+	atomic_add(&uart_stats[dev_idx].rx_bytes, len);
+
+	if (IS_ENABLED(CONFIG_BRIDGE_CDC_UART_STREAM)) {
+		int written = usb_cdc_handler_stream_write(dev_idx, buf, len);
+
+		if ((written >= 0) && ((size_t)written < len)) {
+			atomic_add(&uart_stats[dev_idx].rx_dropped, len - written);
+		}
+
+		/* The data is passed through events only to the BLE UART Service. */
+		if (!IS_ENABLED(CONFIG_BRIDGE_BLE_ENABLE) || (dev_idx != 0) || !ble_subscribed) {
+			return;
+		}
+	}
+
+	uart_rx_buf_ref(buf);
+
+	event = new_uart_data_event();
+	event->dev_idx = dev_idx;
+	event->buf = buf;
+	event->len = len;
+	APP_EVENT_SUBMIT(event);
+}
+
 static void uart_callback(const struct device *dev, struct uart_event *evt,
 			  void *user_data)
 {
 	int dev_idx = (int) user_data;
-	struct uart_data_event *event;
 	struct uart_rx_buf *buf;
 	int err;
 
 	switch (evt->type) {
 	case UART_RX_RDY:
-		uart_rx_buf_ref(evt->data.rx.buf);
-
-		event = new_uart_data_event();
-		event->dev_idx = dev_idx;
-		event->buf = &evt->data.rx.buf[evt->data.rx.offset];
-		event->len = evt->data.rx.len;
-		APP_EVENT_SUBMIT(event);
+		uart_rx_data(dev_idx, &evt->data.rx.buf[evt->data.rx.offset], evt->data.rx.len);
 		break;
 	case UART_RX_BUF_RELEASED:
 		if (evt->data.rx_buf.buf) {
@@ -149,6 +183,7 @@ static void uart_callback(const struct device *dev, struct uart_event *evt,
 	case UART_RX_BUF_REQUEST:
 		buf = uart_rx_buf_alloc();
 		if (buf == NULL) {
+			atomic_inc(&uart_stats[dev_idx].rx_buf_overflows);
 			LOG_WRN("UART_%d RX overflow", dev_idx);
 			break;
 		}
@@ -304,17 +339,11 @@ static void uart_tx_finish(uint8_t dev_idx, size_t len)
 	}
 }
 
-static int uart_tx_enqueue(uint8_t *data, size_t data_len, uint8_t dev_idx)
+static void uart_tx_kick(uint8_t dev_idx)
 {
 	atomic_t started;
-	uint32_t written;
 	int err;
 
-	written = ring_buf_put(&uart_tx_ringbufs[dev_idx].rb, data, data_len);
-	if (written == 0) {
-		return -ENOMEM;
-	}
-
 	started = atomic_set(&uart_tx_started[dev_idx], true);
 	if (!started) {
 		err = uart_tx_start(dev_idx);
@@ -323,6 +352,27 @@ static int uart_tx_enqueue(uint8_t *data, size_t data_len, uint8_t dev_idx)
 			atomic_set(&uart_tx_started[dev_idx], false);
 		}
 	}
+}
+
+static int uart_tx_enqueue(uint8_t *data, size_t data_len, uint8_t dev_idx)
+{
+	struct uart_tx_buf *tx = &uart_tx_ringbufs[dev_idx];
+	k_spinlock_key_t key;
+	uint32_t written;
+
+	/* Data can also be written directly from the USB CDC ACM interrupt. */
+	key = k_spin_lock(&tx->lock);
+	written = ring_buf_put(&tx->rb, data, data_len);
+	k_spin_unlock(&tx->lock, key);
+
+	atomic_add(&uart_stats[dev_idx].tx_bytes, written);
+	atomic_add(&uart_stats[dev_idx].tx_dropped, data_len - written);
+
+	if (written == 0) {
+		return -ENOMEM;
+	}
+
+	uart_tx_kick(dev_idx);
 
 	if (written == data_len) {
 		return 0;
@@ -333,6 +383,70 @@ static int uart_tx_enqueue(uint8_t *data, size_t data_len, uint8_t dev_idx)
 	return 0;
 }
 
+int uart_handler_stream_tx_fill(uint8_t dev_idx, bridge_stream_read_t read, void *user_data)
+{
+	static uint8_t discard_buf[64];
+	struct uart_tx_buf *tx;
+	k_spinlock_key_t key;
+	uint32_t space;
+	uint8_t *buf;
+	int written = 0;
+	int dropped = 0;
+	int len;
+
+	if (dev_idx >= UART_DEVICE_COUNT) {
+		return -EINVAL;
+	}
+
+	tx = &uart_tx_ringbufs[dev_idx];
+
+	/* Read directly into the free space of the ring buffer, which can be split in two parts. */
+	key = k_spin_lock(&tx->lock);
+	do {
+		space = ring_buf_put_claim(&tx->rb, &buf, sizeof(tx->buf));
+		len = (space > 0) ? read(buf, space, user_data) : 0;
+		len = MAX(len, 0);
+		ring_buf_put_finish(&tx->rb, len);
+		written += len;
+	} while ((len > 0) && (len == space));
+	k_spin_unlock(&tx->lock, key);
+
+	/* The ring buffer is full. Drop the remaining data. */
+	if (space == 0) {
+		while ((len = read(discard_buf, sizeof(discard_buf), user_data)) > 0) {
+			dropped += len;
+		}
+	}
+
+	atomic_add(&uart_stats[dev_idx].tx_bytes, written);
+
+	if (dropped > 0) {
+		atomic_add(&uart_stats[dev_idx].tx_dropped, dropped);
+		LOG_DBG("CDC_%d->UART_%d overflow", dev_idx, dev_idx);
+	}
+
+	if (written > 0) {
+		uart_tx_kick(dev_idx);
+	}
+
+	return written;
+}
+
+int uart_handler_stats_get(uint8_t dev_idx, struct bridge_stream_stats *stats)
+{
+	if (dev_idx >= UART_DEVICE_COUNT) {
+		return -EINVAL;
+	}
+
+	stats->rx_bytes = atomic_get(&uart_stats[dev_idx].rx_bytes);
+	stats->rx_dropped = atomic_get(&uart_stats[dev_idx].rx_dropped);
+	stats->rx_buf_overflows = atomic_get(&uart_stats[dev_idx].rx_buf_overflows);
+	stats->tx_bytes = atomic_get(&uart_stats[dev_idx].tx_bytes);
+	stats->tx_dropped = atomic_get(&uart_stats[dev_idx].tx_dropped);
+
+	return 0;
+}
+
 static bool app_event_handler(const struct app_event_header *aeh)
 {
 	int err;
@@ -409,6 +523,10 @@ static bool app_event_handler(const struct app_event_header *aeh)
 			return false;
 		}
 
+		if (event->peer_id == PEER_ID_BLE) {
+			ble_subscribed = (event->conn_state == PEER_STATE_CONNECTED);
+		}
+
 		prev_count = subscriber_count[event->dev_idx];
 
 		if (event->conn_state == PEER_STATE_CONNECTED) {
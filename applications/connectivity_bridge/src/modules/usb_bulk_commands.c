@@ -6,6 +6,7 @@
 
 #include <zephyr/retention/bootmode.h>
 #include <zephyr/sys/reboot.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/drivers/gpio.h>
 #include <dk_buttons_and_leds.h>
 #include <fw_info.h>
@@ -15,6 +16,8 @@
 #include <cmsis_dap.h>
 #include <zephyr/dap/dap_link.h>
 
+#include "bridge_stream.h"
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(bulk_commands, CONFIG_BRIDGE_BULK_LOG_LEVEL);
 
@@ -23,11 +26,13 @@ LOG_MODULE_REGISTER(bulk_commands, CONFIG_BRIDGE_BULK_LOG_LEVEL);
 #define ID_DAP_VENDOR16			(0x80 + 16)
 #define ID_DAP_VENDOR17			(0x80 + 17)
 #define ID_DAP_VENDOR18			(0x80 + 18)
+#define ID_DAP_VENDOR19			(0x80 + 19)
 #define ID_DAP_VENDOR_NRF53_BOOTLOADER	ID_DAP_VENDOR14
 #define ID_DAP_VENDOR_NRF91_BOOTLOADER	ID_DAP_VENDOR15
 #define ID_DAP_VENDOR_NRF53_RESET	ID_DAP_VENDOR16
 #define ID_DAP_VENDOR_NRF91_RESET	ID_DAP_VENDOR17
 #define ID_DAP_VENDOR_NRF53_VERSION	ID_DAP_VENDOR18
+#define ID_DAP_VENDOR_BRIDGE_STATS	ID_DAP_VENDOR19
 
 #define DAP_COMMAND_SUCCESS		0x00
 #define DAP_COMMAND_FAILED		0xFF
@@ -159,6 +164,27 @@ size_t dap_execute_vendor_cmd(struct dap_link_context *const dap_link_ctx, uint8
 		out[1] = len;
 		return len + 2;
 	}
+	if (in[0] == ID_DAP_VENDOR_BRIDGE_STATS) {
+		/* Statistics of all UART devices, each as five little-endian 32-bit values. */
+		struct bridge_stream_stats stats;
+		uint8_t *p = out + 2;
+
+		for (uint8_t i = 0; uart_handler_stats_get(i, &stats) == 0; i++) {
+			if ((p + 5 * sizeof(uint32_t)) > (out + USB_BULK_PACKET_SIZE)) {
+				break;
+			}
+
+			sys_put_le32(stats.rx_bytes, p);
+			sys_put_le32(stats.rx_dropped, p + 4);
+			sys_put_le32(stats.rx_buf_overflows, p + 8);
+			sys_put_le32(stats.tx_bytes, p + 12);
+			sys_put_le32(stats.tx_dropped, p + 16);
+			p += 5 * sizeof(uint32_t);
+		}
+		out[0] = in[0];
+		out[1] = p - (out + 2);
+		return p - out;
+	}
 
 error:
 	/* default reply: command failed */
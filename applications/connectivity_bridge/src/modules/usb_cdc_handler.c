@@ -13,6 +13,7 @@
 #include "peer_conn_event.h"
 #include "cdc_data_event.h"
 #include "uart_data_event.h"
+#include "bridge_stream.h"
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(MODULE, CONFIG_BRIDGE_CDC_LOG_LEVEL);
@@ -95,6 +96,11 @@ static void cdc_dtr_work_handler(struct k_work *work)
 	poll_dtr();
 }
 
+static int cdc_fifo_read(uint8_t *buf, size_t len, void *user_data)
+{
+	return uart_fifo_read((const struct device *)user_data, buf, len);
+}
+
 static void cdc_uart_interrupt_handler(const struct device *dev, void *user_data)
 {
 	int dev_idx = (int) user_data;
@@ -110,6 +116,11 @@ static void cdc_uart_interrupt_handler(const struct device *dev, void *user_data
 
 	poll_dtr();
 
+	if (IS_ENABLED(CONFIG_BRIDGE_CDC_UART_STREAM)) {
+		uart_handler_stream_tx_fill(dev_idx, cdc_fifo_read, (void *)dev);
+		return;
+	}
+
 	do {
 		err = k_mem_slab_alloc(&cdc_rx_slab, &rx_buf, K_NO_WAIT);
 		if (err) {
@@ -183,6 +194,15 @@ static void usbd_status(enum usb_dc_status_code cb_status, const uint8_t *param)
 	}
 }
 
+int usb_cdc_handler_stream_write(uint8_t dev_idx, const uint8_t *buf, size_t len)
+{
+	if ((dev_idx >= CDC_DEVICE_COUNT) || (cdc_ready[dev_idx] == 0)) {
+		return -ENOTCONN;
+	}
+
+	return uart_fifo_fill(devices[dev_idx], buf, len);
+}
+
 static bool app_event_handler(const struct app_event_header *aeh)
 {
 	if (is_uart_data_event(aeh)) {
@@ -190,6 +210,11 @@ static bool app_event_handler(const struct app_event_header *aeh)
 			cast_uart_data_event(aeh);
 		int tx_written;
 
+		/* The data was already written directly by the UART module. */
+		if (IS_ENABLED(CONFIG_BRIDGE_CDC_UART_STREAM)) {
+			return false;
+		}
+
 		if (event->dev_idx >= CDC_DEVICE_COUNT) {
 			return false;
 		}
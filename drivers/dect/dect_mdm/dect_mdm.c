@@ -21,6 +21,8 @@
 #include "dect_mdm_ctrl.h"
 #include "dect_mdm_settings.h"
 #include "dect_mdm_sink.h"
+#include "dect_mdm_tx.h"
+#include "dect_mdm_utils.h"
 #include "dect_mdm.h"
 
 #include <zephyr/logging/log.h>
@@ -39,21 +41,14 @@ struct dect_mdm_mac_dev_context {
 
 	struct dect_mdm_association_data
 		child_associations[CONFIG_DECT_CLUSTER_MAX_CHILD_ASSOCIATION_COUNT];
+	/* Index of child_associations by target long RD ID */
+	struct dect_mdm_utils_rd_id_index_slot child_association_index[
+		DECT_MDM_UTILS_RD_ID_INDEX_SIZE(CONFIG_DECT_CLUSTER_MAX_CHILD_ASSOCIATION_COUNT)];
 	struct dect_mdm_association_data parent_associations[1];
 };
 
 static struct dect_mdm_mac_dev_context dect_mdm_mac_dev_context_data;
 
-static K_MUTEX_DEFINE(send_buf_lock); /* Only one TX requests at a time */
-
-#if defined(CONFIG_DECT_MDM_NRF_TX_FLOW_CTRL_BASED_ON_MDM_TX_DLC_REQS)
-/* We are using handle as array index */
-BUILD_ASSERT(DECT_MDM_DATA_TX_HANDLE_COUNT == DECT_MDM_DLC_DATA_INFO_MAX_COUNT,
-	     "Mismatch in DECT MAC data tx handle range and DECT_MDM_DLC_DATA_INFO_MAX_COUNT");
-#endif
-#define DECT_MDM_TX_TRY_MAX_COUNT 20
-#define DECT_MDM_TX_RETRY_SLEEP_MS 50
-
 /* Sanity checks between Zephyr and nrf api */
 BUILD_ASSERT((NRF_MODEM_DECT_MAC_MAX_CHANNELS_IN_RSSI_SCAN == DECT_MAX_CHANNELS_IN_RSSI_SCAN),
 	     "NRF_MODEM_DECT_MAC_MAX_CHANNELS_IN_RSSI_SCAN != "
@@ -172,16 +167,17 @@ static struct dect_mdm_association_data *
 dect_mdm_child_association_list_item_get(uint32_t target_long_rd_id)
 {
 	struct dect_mdm_mac_dev_context *ctx = &dect_mdm_mac_dev_context_data;
+	int item;
 
 	LOG_DBG("%s: target_long_rd_id %u", (__func__), target_long_rd_id);
 
-	for (int i = 0; i < ARRAY_SIZE(ctx->child_associations); i++) {
-		if (ctx->child_associations[i].in_use &&
-		    ctx->child_associations[i].target_long_rd_id == target_long_rd_id) {
-			return &ctx->child_associations[i];
-		}
+	item = dect_mdm_utils_rd_id_index_get(ctx->child_association_index,
+					      ARRAY_SIZE(ctx->child_association_index),
+					      target_long_rd_id);
+	if (item < 0) {
+		return NULL;
 	}
-	return NULL;
+	return &ctx->child_associations[item];
 }
 
 static struct dect_mdm_association_data *
@@ -200,6 +196,13 @@ dect_mdm_child_association_list_add(uint32_t target_long_rd_id)
 	/* Add to list */
 	for (int i = 0; i < ARRAY_SIZE(ctx->child_associations); i++) {
 		if (!ctx->child_associations[i].in_use) {
+			/* Cannot fail: the index has twice as many slots as the list */
+			if (dect_mdm_utils_rd_id_index_add(
+				    ctx->child_association_index,
+				    ARRAY_SIZE(ctx->child_association_index),
+				    target_long_rd_id, i)) {
+				return NULL;
+			}
 			ctx->child_associations[i].in_use = true;
 			ctx->child_associations[i].target_long_rd_id = target_long_rd_id;
 			return &ctx->child_associations[i];
@@ -211,15 +214,16 @@ dect_mdm_child_association_list_add(uint32_t target_long_rd_id)
 static void dect_mdm_child_association_list_remove(uint32_t target_long_rd_id)
 {
 	struct dect_mdm_mac_dev_context *ctx = &dect_mdm_mac_dev_context_data;
+	struct dect_mdm_association_data *ass_list_item;
 
 	LOG_DBG("%s: target_long_rd_id %u", (__func__), target_long_rd_id);
 
-	for (int i = 0; i < ARRAY_SIZE(ctx->child_associations); i++) {
-		if (ctx->child_associations[i].in_use &&
-		    ctx->child_associations[i].target_long_rd_id == target_long_rd_id) {
-			ctx->child_associations[i].in_use = false;
-			break;
-		}
+	ass_list_item = dect_mdm_child_association_list_item_get(target_long_rd_id);
+	if (ass_list_item != NULL) {
+		ass_list_item->in_use = false;
+		dect_mdm_utils_rd_id_index_remove(ctx->child_association_index,
+						  ARRAY_SIZE(ctx->child_association_index),
+						  target_long_rd_id);
 	}
 }
 
@@ -542,6 +546,7 @@ static int dect_mdm_hal_status_info_get(const struct device *dev,
 		}
 	}
 	status_info_out->nw_beacon_running = dect_mdm_ctrl_api_nw_beacon_running();
+	dect_mdm_tx_stats_get(&status_info_out->tx_stats);
 
 	strncpy(status_info_out->fw_version_str, "Not available",
 		sizeof(status_info_out->fw_version_str) - 1);
@@ -641,11 +646,7 @@ static int dect_mdm_hal_driver_send(const struct device *dev, struct net_pkt *pk
 {
 	__ASSERT_NO_MSG(pkt != NULL);
 
-	struct dect_mdm_ctrl_api_tx_cmd_params tx_params;
 	uint32_t target_long_rd_id = 0;
-	static uint32_t transaction_id = DECT_MDM_DATA_TX_HANDLE_START;
-	int ret;
-	int data_len = 0;
 
 	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
 		target_long_rd_id = dect_utils_lib_dst_long_rd_id_get_from_pkt_dst_addr(pkt);
@@ -669,59 +670,10 @@ static int dect_mdm_hal_driver_send(const struct device *dev, struct net_pkt *pk
 
 	LOG_DBG("dect_mdm_hal_driver_send: target_long_rd_id %u", target_long_rd_id);
 
-	k_mutex_lock(&send_buf_lock, K_FOREVER);
-	data_len = net_pkt_get_len(pkt);
-
-	if (data_len > NRF91_DECT_UL_BUFFER_SIZE) {
-		LOG_ERR("Packet too large: %d", data_len);
-		k_mutex_unlock(&send_buf_lock);
-		return -EINVAL;
-	}
-
-	ret = net_pkt_read(pkt, tx_params.data, data_len);
-	if (ret < 0) {
-		LOG_ERR("%s: cannot read packet: %d, from pkt %p, data_len %d\n", __func__, ret,
-			pkt, data_len);
-	} else {
-		int retry_count = 0;
-		bool data_sent = false;
-
-		tx_params.data_len = data_len;
-		tx_params.long_rd_id = target_long_rd_id;
-		tx_params.flow_id = 1;
-		tx_params.transaction_id = transaction_id++;
-
-		while (retry_count < DECT_MDM_TX_TRY_MAX_COUNT &&
-		       data_sent == false) {
-			ret = dect_mdm_ctrl_api_tx_cmd(&tx_params);
-			if (ret == -ENOMEM || ret == -EACCES) {
-				k_sleep(K_MSEC(DECT_MDM_TX_RETRY_SLEEP_MS));
-				retry_count++;
-			} else if (ret == -EBUSY) {
-				tx_params.transaction_id = transaction_id++;
-				retry_count++;
-			} else {
-				data_sent = true;
-			}
-			if (transaction_id > DECT_MDM_DATA_TX_HANDLE_END) {
-				transaction_id = DECT_MDM_DATA_TX_HANDLE_START;
-			}
-		}
-
-		if (data_sent && ret == 0) {
-			LOG_DBG("Packet sending initiated to %d (%d bytes) after %d retries",
-				target_long_rd_id, data_len, retry_count);
-		} else {
-			LOG_ERR("Error (%d) when sending packet to rd id %u: retries %d",
-				ret, target_long_rd_id, retry_count);
-		}
-	}
-	k_mutex_unlock(&send_buf_lock);
 	/* If something went wrong, then we need to return negative value to
 	 * net_if.c:net_if_tx() so that the net_pkt will get released.
 	 */
-
-	return ret;
+	return dect_mdm_tx_pkt_send(pkt, target_long_rd_id);
 }
 
 static int dect_mdm_hal_neighbor_list_req(const struct device *dev)
@@ -982,6 +934,7 @@ void dect_mdm_parent_association_removed(uint32_t long_rd_id,
 
 	/* ...and finally, remove from our list */
 	dect_mdm_parent_association_list_remove(long_rd_id);
+	dect_mdm_tx_dest_flush(long_rd_id);
 }
 
 void dect_mdm_child_association_removed(uint32_t long_rd_id,
@@ -998,6 +951,7 @@ void dect_mdm_child_association_removed(uint32_t long_rd_id,
 	if (ass_list_item) {
 		dect_mdm_child_association_list_remove(long_rd_id);
 	}
+	dect_mdm_tx_dest_flush(long_rd_id);
 }
 
 void dect_mdm_child_association_all_removed(enum nrf_modem_dect_mac_release_cause rel_cause)
@@ -1011,6 +965,7 @@ void dect_mdm_child_association_all_removed(enum nrf_modem_dect_mac_release_caus
 				ctx->child_associations[i].target_long_rd_id,
 				(enum dect_association_release_cause)rel_cause,
 				false);
+			dect_mdm_tx_dest_flush(ctx->child_associations[i].target_long_rd_id);
 			dect_mdm_child_association_list_remove(
 				ctx->child_associations[i].target_long_rd_id);
 		}
@@ -28,6 +28,7 @@
 #include "dect_mdm.h"
 #include "dect_mdm_rx.h"
 #include "dect_mdm_sink.h"
+#include "dect_mdm_tx.h"
 #include "dect_mdm_ctrl.h"
 #include "dect_mdm_ctrl_internal.h"
 
@@ -681,6 +682,7 @@ static void handle_mdm_activated(struct dect_mdm_common_op_event_msgq_item *even
 	memset(ctrl_data.dlc_data_tx_infos, 0, sizeof(ctrl_data.dlc_data_tx_infos));
 #endif
 	CTRL_DATA_UNLOCK();
+	dect_mdm_tx_reset();
 	k_sem_give(&dect_mdm_ctrl_reactivate_sema);
 	LOG_INF("Modem activated - ready for commands");
 }
@@ -1055,6 +1057,10 @@ static void handle_mdm_flow_control(struct dect_mdm_common_op_event_msgq_item *e
 
 	LOG_DBG("Flow control %s:",
 		evt_data->status == NRF_MODEM_DECT_DLC_FLOW_CTRL_STATUS_ON ? "ON" : "OFF");
+
+	if (evt_data->status != NRF_MODEM_DECT_DLC_FLOW_CTRL_STATUS_ON) {
+		dect_mdm_tx_resume();
+	}
 }
 
 static void handle_mdm_association_ind(struct dect_mdm_common_op_event_msgq_item *event)
@@ -2645,6 +2651,11 @@ static void handle_mdm_dlc_data_resp(struct dect_mdm_common_op_event_msgq_item *
 	uint16_t total_unacked_req_amount = ctrl_data.total_unacked_req_amount;
 
 	CTRL_DATA_UNLOCK();
+
+	/* Release the per destination TX window */
+	for (int i = 0; i < evt_data->num_acked_data; i++) {
+		dect_mdm_tx_done(evt_data->acked_data[i].transaction_id);
+	}
 	LOG_DBG("DLC data response (towards RD ID %u): "
 		"total %d bytes unacked left, total req count %d",
 		evt_data->long_rd_id, total_unacked_tx_data_amount, total_unacked_req_amount);
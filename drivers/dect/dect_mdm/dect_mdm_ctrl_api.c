@@ -191,7 +191,7 @@ int dect_mdm_ctrl_api_tx_cmd(struct dect_mdm_ctrl_api_tx_cmd_params *params)
 		.transaction_id = params->transaction_id,
 		.flow_id = params->flow_id,
 		.long_rd_id = params->long_rd_id,
-		.data = params->data,
+		.data = (void *)params->data,
 		.data_len = params->data_len,
 	};
 	int ret;
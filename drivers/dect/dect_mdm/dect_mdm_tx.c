@@ -0,0 +1,490 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/sys/slist.h>
+#include <stdint.h>
+
+#include "dect_mdm_ctrl.h"
+#include "dect_mdm_utils.h"
+#include "dect_mdm_tx.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(dect_mdm, CONFIG_DECT_MDM_LOG_LEVEL);
+
+#if defined(CONFIG_DECT_MDM_NRF_TX_FLOW_CTRL_BASED_ON_MDM_TX_DLC_REQS)
+/* We are using handle as array index */
+BUILD_ASSERT(DECT_MDM_DATA_TX_HANDLE_COUNT == DECT_MDM_DLC_DATA_INFO_MAX_COUNT,
+	     "Mismatch in DECT MAC data tx handle range and DECT_MDM_DLC_DATA_INFO_MAX_COUNT");
+#endif
+#define DECT_MDM_TX_TRY_MAX_COUNT 20
+#define DECT_MDM_TX_RETRY_SLEEP_MS 50
+
+#define DECT_MDM_TX_FLOW_ID 1
+
+/* TX request handed over to the modem, indexed by transaction ID */
+struct dect_mdm_tx_req {
+	uint32_t long_rd_id; /* Zero when not waiting for the modem TX acknowledgment */
+	uint32_t start_time_ms;
+};
+
+static struct dect_mdm_tx_req tx_reqs[DECT_MDM_DATA_TX_HANDLE_COUNT];
+static uint32_t tx_req_next;
+
+static struct dect_tx_stats tx_stats;
+static uint64_t tx_latency_sum_ms;
+static uint32_t tx_latency_count;
+
+/* Protects the data of this module. Never held while calling the modem. */
+static struct k_spinlock tx_lock;
+
+#if defined(CONFIG_DECT_MDM_NRF_TX_QUEUE)
+#define DECT_MDM_TX_THREAD_PRIORITY 5
+
+struct dect_mdm_tx_item {
+	sys_snode_t node;
+	struct net_pkt *pkt;
+	uint32_t queued_time_ms;
+};
+
+struct dect_mdm_tx_dest {
+	uint32_t long_rd_id; /* Zero when free */
+	sys_slist_t queue;
+	uint16_t depth;
+	uint16_t in_flight;
+};
+
+K_MEM_SLAB_DEFINE_STATIC(dect_mdm_tx_item_slab, sizeof(struct dect_mdm_tx_item),
+			 CONFIG_DECT_MDM_NRF_TX_QUEUE_SIZE, 4);
+
+static struct dect_mdm_tx_dest tx_dests[CONFIG_DECT_MDM_NRF_TX_QUEUE_DEST_COUNT];
+static struct dect_mdm_utils_rd_id_index_slot
+	tx_dest_index[DECT_MDM_UTILS_RD_ID_INDEX_SIZE(CONFIG_DECT_MDM_NRF_TX_QUEUE_DEST_COUNT)];
+
+/* Destination to serve first on the next round */
+static size_t tx_dest_next;
+
+/* Used only by the TX thread for packets that have more than one fragment */
+static uint8_t tx_linear_buf[NRF91_DECT_UL_BUFFER_SIZE];
+
+static K_SEM_DEFINE(tx_sem, 0, 1);
+
+static struct dect_mdm_tx_dest *dect_mdm_tx_dest_get(uint32_t long_rd_id)
+{
+	int item = dect_mdm_utils_rd_id_index_get(tx_dest_index, ARRAY_SIZE(tx_dest_index),
+						  long_rd_id);
+
+	return (item < 0) ? NULL : &tx_dests[item];
+}
+
+static struct dect_mdm_tx_dest *dect_mdm_tx_dest_alloc(uint32_t long_rd_id)
+{
+	struct dect_mdm_tx_dest *dest = dect_mdm_tx_dest_get(long_rd_id);
+
+	if (dest != NULL) {
+		return dest;
+	}
+	for (int i = 0; i < ARRAY_SIZE(tx_dests); i++) {
+		if (tx_dests[i].long_rd_id == 0) {
+			if (dect_mdm_utils_rd_id_index_add(tx_dest_index,
+							   ARRAY_SIZE(tx_dest_index),
+							   long_rd_id, i)) {
+				return NULL;
+			}
+			tx_dests[i].long_rd_id = long_rd_id;
+			sys_slist_init(&tx_dests[i].queue);
+			tx_dests[i].depth = 0;
+			tx_dests[i].in_flight = 0;
+			return &tx_dests[i];
+		}
+	}
+	return NULL;
+}
+
+static void dect_mdm_tx_dest_release_if_idle(struct dect_mdm_tx_dest *dest)
+{
+	if (dest->depth == 0 && dest->in_flight == 0) {
+		dect_mdm_utils_rd_id_index_remove(tx_dest_index, ARRAY_SIZE(tx_dest_index),
+						  dest->long_rd_id);
+		dest->long_rd_id = 0;
+	}
+}
+#endif /* CONFIG_DECT_MDM_NRF_TX_QUEUE */
+
+static int dect_mdm_tx_req_claim(uint32_t long_rd_id, uint32_t start_time_ms)
+{
+	k_spinlock_key_t key = k_spin_lock(&tx_lock);
+	int transaction_id = -ENOMEM;
+
+	for (int n = 0; n < DECT_MDM_DATA_TX_HANDLE_COUNT; n++) {
+		uint32_t index = tx_req_next++ % DECT_MDM_DATA_TX_HANDLE_COUNT;
+
+		/* Without modem TX acknowledgment tracking the handles are just rotated */
+		if (!IS_ENABLED(CONFIG_DECT_MDM_NRF_TX_FLOW_CTRL_BASED_ON_MDM_TX_DLC_REQS) ||
+		    tx_reqs[index].long_rd_id == 0) {
+			tx_reqs[index].long_rd_id = long_rd_id;
+			tx_reqs[index].start_time_ms = start_time_ms;
+			transaction_id = DECT_MDM_DATA_TX_HANDLE_START + index;
+			break;
+		}
+	}
+	k_spin_unlock(&tx_lock, key);
+
+	return transaction_id;
+}
+
+static void dect_mdm_tx_req_release(uint32_t transaction_id)
+{
+	k_spinlock_key_t key = k_spin_lock(&tx_lock);
+
+	tx_reqs[transaction_id - DECT_MDM_DATA_TX_HANDLE_START].long_rd_id = 0;
+	k_spin_unlock(&tx_lock, key);
+}
+
+static int dect_mdm_tx_pkt_submit(struct net_pkt *pkt, uint32_t long_rd_id,
+				  uint32_t start_time_ms, uint8_t *linear_buf)
+{
+	struct dect_mdm_ctrl_api_tx_cmd_params tx_params = {
+		.flow_id = DECT_MDM_TX_FLOW_ID,
+		.long_rd_id = long_rd_id,
+		.data_len = net_pkt_get_len(pkt),
+	};
+	k_spinlock_key_t key;
+	int transaction_id;
+	int ret;
+
+	if (pkt->buffer != NULL && pkt->buffer->frags == NULL) {
+		/* Single fragment: the modem library copies the data directly from it */
+		tx_params.data = pkt->buffer->data;
+	} else {
+		net_pkt_cursor_init(pkt);
+		ret = net_pkt_read(pkt, linear_buf, tx_params.data_len);
+		if (ret < 0) {
+			LOG_ERR("%s: cannot read packet: %d, from pkt %p, data_len %u", __func__,
+				ret, pkt, tx_params.data_len);
+			return ret;
+		}
+		tx_params.data = linear_buf;
+	}
+
+	ret = -ENOMEM;
+	for (int n = 0; n < DECT_MDM_DATA_TX_HANDLE_COUNT; n++) {
+		transaction_id = dect_mdm_tx_req_claim(long_rd_id, start_time_ms);
+		if (transaction_id < 0) {
+			/* All handles waiting for the modem TX acknowledgment */
+			return transaction_id;
+		}
+		tx_params.transaction_id = transaction_id;
+
+		ret = dect_mdm_ctrl_api_tx_cmd(&tx_params);
+		if (ret == 0) {
+			key = k_spin_lock(&tx_lock);
+			tx_stats.sent++;
+			k_spin_unlock(&tx_lock, key);
+			break;
+		}
+		dect_mdm_tx_req_release(transaction_id);
+		if (ret != -EBUSY) {
+			break;
+		}
+	}
+
+	return ret;
+}
+
+#if defined(CONFIG_DECT_MDM_NRF_TX_QUEUE)
+/* Returns true if the modem cannot take more data now and packets are waiting. */
+static bool dect_mdm_tx_queue_service(void)
+{
+	bool progress = true;
+
+	while (progress) {
+		progress = false;
+
+		/* One packet per destination and round */
+		for (size_t n = 0; n < ARRAY_SIZE(tx_dests); n++) {
+			size_t i = (tx_dest_next + n) % ARRAY_SIZE(tx_dests);
+			struct dect_mdm_tx_dest *dest = &tx_dests[i];
+			struct dect_mdm_tx_item *item;
+			uint32_t long_rd_id;
+			k_spinlock_key_t key;
+			int ret;
+
+			key = k_spin_lock(&tx_lock);
+			if (dest->long_rd_id == 0 || sys_slist_is_empty(&dest->queue) ||
+			    dest->in_flight >= CONFIG_DECT_MDM_NRF_TX_QUEUE_DEST_IN_FLIGHT) {
+				k_spin_unlock(&tx_lock, key);
+				continue;
+			}
+			item = CONTAINER_OF(sys_slist_get_not_empty(&dest->queue),
+					    struct dect_mdm_tx_item, node);
+			dest->depth--;
+			dest->in_flight++;
+			tx_stats.queue_depth--;
+			long_rd_id = dest->long_rd_id;
+			k_spin_unlock(&tx_lock, key);
+
+			ret = dect_mdm_tx_pkt_submit(item->pkt, long_rd_id, item->queued_time_ms,
+						     tx_linear_buf);
+
+			/* The destination might have been flushed meanwhile: look it up again */
+			key = k_spin_lock(&tx_lock);
+			if (ret == -ENOMEM || ret == -EACCES) {
+				/* Modem TX window full or flow control on: keep the order and
+				 * start from this destination when the modem can take data.
+				 * A flushed destination is not recreated, the packet is dropped.
+				 */
+				dest = dect_mdm_tx_dest_get(long_rd_id);
+				if (dest != NULL) {
+					if (dest->in_flight > 0) {
+						dest->in_flight--;
+					}
+					sys_slist_prepend(&dest->queue, &item->node);
+					dest->depth++;
+					tx_stats.queue_depth++;
+					tx_dest_next = dest - tx_dests;
+					k_spin_unlock(&tx_lock, key);
+					return true;
+				}
+			}
+			dest = dect_mdm_tx_dest_get(long_rd_id);
+			if (ret) {
+				tx_stats.dropped++;
+				if (dest != NULL && dest->in_flight > 0) {
+					dest->in_flight--;
+				}
+			}
+			if (dest != NULL) {
+				dect_mdm_tx_dest_release_if_idle(dest);
+			}
+			k_spin_unlock(&tx_lock, key);
+
+			if (ret) {
+				LOG_ERR("Error (%d) when sending packet to rd id %u", ret,
+					long_rd_id);
+			}
+			net_pkt_unref(item->pkt);
+			k_mem_slab_free(&dect_mdm_tx_item_slab, item);
+			progress = true;
+		}
+	}
+
+	return false;
+}
+
+static void dect_mdm_tx_thread_handler(void)
+{
+	k_timeout_t timeout = K_FOREVER;
+
+	while (true) {
+		(void)k_sem_take(&tx_sem, timeout);
+
+		/* Modem busy: poll in case flow control is released without an event */
+		timeout = dect_mdm_tx_queue_service() ? K_MSEC(DECT_MDM_TX_RETRY_SLEEP_MS)
+						      : K_FOREVER;
+	}
+}
+
+K_THREAD_DEFINE(dect_mdm_tx_th, CONFIG_DECT_MDM_NRF_TX_THREAD_STACK_SIZE,
+		dect_mdm_tx_thread_handler, NULL, NULL, NULL,
+		K_PRIO_PREEMPT(DECT_MDM_TX_THREAD_PRIORITY), 0, 0);
+
+static int dect_mdm_tx_pkt_enqueue(struct net_pkt *pkt, uint32_t long_rd_id)
+{
+	struct dect_mdm_tx_item *item;
+	struct dect_mdm_tx_dest *dest;
+	k_spinlock_key_t key;
+
+	if (k_mem_slab_alloc(&dect_mdm_tx_item_slab, (void **)&item, K_NO_WAIT)) {
+		key = k_spin_lock(&tx_lock);
+		tx_stats.dropped++;
+		k_spin_unlock(&tx_lock, key);
+		LOG_WRN("TX queue full, packet to rd id %u dropped", long_rd_id);
+		return -ENOBUFS;
+	}
+	item->pkt = pkt;
+	item->queued_time_ms = k_uptime_get_32();
+
+	key = k_spin_lock(&tx_lock);
+	dest = dect_mdm_tx_dest_alloc(long_rd_id);
+	if (dest == NULL || dest->depth >= CONFIG_DECT_MDM_NRF_TX_QUEUE_DEST_DEPTH) {
+		tx_stats.dropped++;
+		k_spin_unlock(&tx_lock, key);
+		k_mem_slab_free(&dect_mdm_tx_item_slab, item);
+		LOG_WRN("TX queue for rd id %u full, packet dropped", long_rd_id);
+		return -ENOBUFS;
+	}
+	/* Released by the TX thread, the L2 releases its own reference on success */
+	net_pkt_ref(pkt);
+	sys_slist_append(&dest->queue, &item->node);
+	dest->depth++;
+	tx_stats.queued++;
+	tx_stats.queue_depth++;
+	tx_stats.queue_depth_max = MAX(tx_stats.queue_depth_max, tx_stats.queue_depth);
+	k_spin_unlock(&tx_lock, key);
+
+	k_sem_give(&tx_sem);
+
+	return 0;
+}
+#else
+static int dect_mdm_tx_pkt_send_sync(struct net_pkt *pkt, uint32_t long_rd_id)
+{
+	uint8_t linear_buf[NRF91_DECT_UL_BUFFER_SIZE];
+	uint32_t start_time_ms = k_uptime_get_32();
+	int retry_count = 0;
+	k_spinlock_key_t key;
+	int ret;
+
+	while (true) {
+		ret = dect_mdm_tx_pkt_submit(pkt, long_rd_id, start_time_ms, linear_buf);
+		if ((ret != -ENOMEM && ret != -EACCES) ||
+		    ++retry_count >= DECT_MDM_TX_TRY_MAX_COUNT) {
+			break;
+		}
+		k_sleep(K_MSEC(DECT_MDM_TX_RETRY_SLEEP_MS));
+	}
+
+	if (ret == 0) {
+		LOG_DBG("Packet sending initiated to %u (%u bytes) after %d retries", long_rd_id,
+			(uint32_t)net_pkt_get_len(pkt), retry_count);
+	} else {
+		key = k_spin_lock(&tx_lock);
+		tx_stats.dropped++;
+		k_spin_unlock(&tx_lock, key);
+		LOG_ERR("Error (%d) when sending packet to rd id %u: retries %d", ret, long_rd_id,
+			retry_count);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_DECT_MDM_NRF_TX_QUEUE */
+
+int dect_mdm_tx_pkt_send(struct net_pkt *pkt, uint32_t long_rd_id)
+{
+	size_t data_len = net_pkt_get_len(pkt);
+
+	if (data_len > NRF91_DECT_UL_BUFFER_SIZE) {
+		LOG_ERR("Packet too large: %zu", data_len);
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_DECT_MDM_NRF_TX_QUEUE)
+	return dect_mdm_tx_pkt_enqueue(pkt, long_rd_id);
+#else
+	return dect_mdm_tx_pkt_send_sync(pkt, long_rd_id);
+#endif
+}
+
+void dect_mdm_tx_done(uint32_t transaction_id)
+{
+	struct dect_mdm_tx_req *req;
+	k_spinlock_key_t key;
+	uint32_t latency_ms;
+
+	if (!DECT_MDM_DATA_TX_HANDLE_IN_RANGE(transaction_id)) {
+		return;
+	}
+
+	key = k_spin_lock(&tx_lock);
+	req = &tx_reqs[transaction_id - DECT_MDM_DATA_TX_HANDLE_START];
+	if (req->long_rd_id == 0) {
+		k_spin_unlock(&tx_lock, key);
+		return;
+	}
+	latency_ms = k_uptime_get_32() - req->start_time_ms;
+	tx_latency_sum_ms += latency_ms;
+	tx_latency_count++;
+	tx_stats.latency_max_ms = MAX(tx_stats.latency_max_ms, latency_ms);
+
+#if defined(CONFIG_DECT_MDM_NRF_TX_QUEUE)
+	struct dect_mdm_tx_dest *dest = dect_mdm_tx_dest_get(req->long_rd_id);
+
+	if (dest != NULL && dest->in_flight > 0) {
+		dest->in_flight--;
+		dect_mdm_tx_dest_release_if_idle(dest);
+	}
+#endif
+	req->long_rd_id = 0;
+	k_spin_unlock(&tx_lock, key);
+
+	dect_mdm_tx_resume();
+}
+
+void dect_mdm_tx_resume(void)
+{
+#if defined(CONFIG_DECT_MDM_NRF_TX_QUEUE)
+	k_sem_give(&tx_sem);
+#endif
+}
+
+void dect_mdm_tx_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&tx_lock);
+
+	for (int i = 0; i < ARRAY_SIZE(tx_reqs); i++) {
+		tx_reqs[i].long_rd_id = 0;
+	}
+#if defined(CONFIG_DECT_MDM_NRF_TX_QUEUE)
+	for (int i = 0; i < ARRAY_SIZE(tx_dests); i++) {
+		if (tx_dests[i].long_rd_id != 0) {
+			tx_dests[i].in_flight = 0;
+			dect_mdm_tx_dest_release_if_idle(&tx_dests[i]);
+		}
+	}
+#endif
+	k_spin_unlock(&tx_lock, key);
+
+	dect_mdm_tx_resume();
+}
+
+void dect_mdm_tx_dest_flush(uint32_t long_rd_id)
+{
+#if defined(CONFIG_DECT_MDM_NRF_TX_QUEUE)
+	struct dect_mdm_tx_item *item, *tmp;
+	struct dect_mdm_tx_dest *dest;
+	k_spinlock_key_t key;
+	sys_slist_t flushed;
+	uint16_t count = 0;
+
+	sys_slist_init(&flushed);
+
+	key = k_spin_lock(&tx_lock);
+	dest = dect_mdm_tx_dest_get(long_rd_id);
+	if (dest != NULL) {
+		flushed = dest->queue;
+		sys_slist_init(&dest->queue);
+		count = dest->depth;
+		tx_stats.queue_depth -= count;
+		tx_stats.dropped += count;
+		dest->depth = 0;
+		dect_mdm_tx_dest_release_if_idle(dest);
+	}
+	k_spin_unlock(&tx_lock, key);
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&flushed, item, tmp, node) {
+		net_pkt_unref(item->pkt);
+		k_mem_slab_free(&dect_mdm_tx_item_slab, item);
+	}
+	if (count) {
+		LOG_DBG("%u queued packets to rd id %u dropped", count, long_rd_id);
+	}
+#else
+	ARG_UNUSED(long_rd_id);
+#endif
+}
+
+void dect_mdm_tx_stats_get(struct dect_tx_stats *stats_out)
+{
+	k_spinlock_key_t key = k_spin_lock(&tx_lock);
+
+	*stats_out = tx_stats;
+	if (tx_latency_count) {
+		stats_out->latency_avg_ms = tx_latency_sum_ms / tx_latency_count;
+	}
+	k_spin_unlock(&tx_lock, key);
+}
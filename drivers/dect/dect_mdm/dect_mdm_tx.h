@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef DECT_MDM_TX_H
+#define DECT_MDM_TX_H
+
+#include <zephyr/net/net_pkt.h>
+#include <net/dect/dect_net_l2.h>
+
+/**
+ * @brief Send a packet to a DECT NR+ device.
+ *
+ * With CONFIG_DECT_MDM_NRF_TX_QUEUE, the packet is queued, the driver takes a reference
+ * to it and it is sent from the driver's TX thread. Otherwise the packet is handed over
+ * to the modem before returning.
+ *
+ * @param pkt Packet to send.
+ * @param long_rd_id Long RD ID of the destination.
+ * @return 0 on success, -EINVAL if the packet is too large, -ENOBUFS if the TX queue is
+ *         full, or other negative value if the modem did not accept the packet.
+ */
+int dect_mdm_tx_pkt_send(struct net_pkt *pkt, uint32_t long_rd_id);
+
+/** Upcall from the ctrl module: the modem has acknowledged a DLC data TX request. */
+void dect_mdm_tx_done(uint32_t transaction_id);
+
+/** Upcall from the ctrl module: modem flow control is off, the TX can be resumed. */
+void dect_mdm_tx_resume(void);
+
+/** Upcall from the ctrl module: modem (re)activated, no TX requests are pending. */
+void dect_mdm_tx_reset(void);
+
+/** Drop the packets queued to a destination, e.g. when its association is released. */
+void dect_mdm_tx_dest_flush(uint32_t long_rd_id);
+
+void dect_mdm_tx_stats_get(struct dect_tx_stats *stats_out);
+
+#endif /* DECT_MDM_TX_H */
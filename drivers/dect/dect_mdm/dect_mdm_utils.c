@@ -383,3 +383,93 @@ bool dect_mdm_ctrl_utils_tx_pwr_dbm_is_valid_by_band(int8_t tx_pwr_dbm, uint16_t
 	LOG_WRN("%s: band %d not supported\n", __func__, band_nbr);
 	return false;
 }
+
+/******************************************************************************/
+
+static size_t dect_mdm_utils_rd_id_index_home(uint32_t long_rd_id, size_t slot_count)
+{
+	/* Multiplicative hashing spreads the often sequential long RD IDs */
+	return ((long_rd_id * 2654435761U) >> 16) & (slot_count - 1);
+}
+
+int dect_mdm_utils_rd_id_index_get(const struct dect_mdm_utils_rd_id_index_slot *slots,
+				   size_t slot_count, uint32_t long_rd_id)
+{
+	size_t i = dect_mdm_utils_rd_id_index_home(long_rd_id, slot_count);
+
+	__ASSERT_NO_MSG(IS_POWER_OF_TWO(slot_count));
+
+	if (long_rd_id == 0) {
+		return -ENOENT;
+	}
+	for (size_t n = 0; n < slot_count; n++) {
+		if (slots[i].long_rd_id == long_rd_id) {
+			return slots[i].item;
+		}
+		if (slots[i].long_rd_id == 0) {
+			break;
+		}
+		i = (i + 1) & (slot_count - 1);
+	}
+	return -ENOENT;
+}
+
+int dect_mdm_utils_rd_id_index_add(struct dect_mdm_utils_rd_id_index_slot *slots,
+				   size_t slot_count, uint32_t long_rd_id, uint16_t item)
+{
+	size_t i = dect_mdm_utils_rd_id_index_home(long_rd_id, slot_count);
+
+	__ASSERT_NO_MSG(IS_POWER_OF_TWO(slot_count));
+
+	if (long_rd_id == 0) {
+		return -EINVAL;
+	}
+	for (size_t n = 0; n < slot_count; n++) {
+		if (slots[i].long_rd_id == 0 || slots[i].long_rd_id == long_rd_id) {
+			slots[i].long_rd_id = long_rd_id;
+			slots[i].item = item;
+			return 0;
+		}
+		i = (i + 1) & (slot_count - 1);
+	}
+	return -ENOMEM;
+}
+
+void dect_mdm_utils_rd_id_index_remove(struct dect_mdm_utils_rd_id_index_slot *slots,
+				       size_t slot_count, uint32_t long_rd_id)
+{
+	size_t mask = slot_count - 1;
+	size_t i = dect_mdm_utils_rd_id_index_home(long_rd_id, slot_count);
+	size_t n;
+
+	if (long_rd_id == 0) {
+		return;
+	}
+	for (n = 0; n < slot_count; n++) {
+		if (slots[i].long_rd_id == long_rd_id) {
+			break;
+		}
+		if (slots[i].long_rd_id == 0) {
+			return;
+		}
+		i = (i + 1) & mask;
+	}
+	if (n == slot_count) {
+		return;
+	}
+
+	/* Shift the following entries of the probe sequence back instead of leaving
+	 * a tombstone, so that lookups stay short after many associations and releases.
+	 */
+	for (size_t j = (i + 1) & mask; slots[j].long_rd_id != 0; j = (j + 1) & mask) {
+		size_t home = dect_mdm_utils_rd_id_index_home(slots[j].long_rd_id, slot_count);
+
+		/* Entry j can fill the hole at i only if its home is not in (i, j] */
+		if ((i < j) ? (home > i && home <= j) : (home > i || home <= j)) {
+			continue;
+		}
+		slots[i] = slots[j];
+		i = j;
+	}
+	slots[i].long_rd_id = 0;
+}
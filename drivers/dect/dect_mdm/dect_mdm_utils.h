@@ -20,6 +20,17 @@ struct dect_mdm_utils_mapping_tbl_item {
 	char *value_str;
 };
 
+/** Slot of an open addressed long RD ID index. Long RD ID zero marks a free slot. */
+struct dect_mdm_utils_rd_id_index_slot {
+	uint32_t long_rd_id;
+	uint16_t item;
+};
+
+/** Number of index slots for the given item count: a power of two that is at least
+ *  twice the item count, to keep the probe sequences short.
+ */
+#define DECT_MDM_UTILS_RD_ID_INDEX_SIZE(item_count) NHPOT(2 * (item_count))
+
 /******************************************************************************/
 
 void dect_mdm_utils_modem_mac_err_to_string(enum nrf_modem_dect_mac_err err, char *out_str_buff,
@@ -46,4 +57,23 @@ bool dect_mdm_utils_cluster_acceptable_for_association(
 
 bool dect_mdm_ctrl_utils_tx_pwr_dbm_is_valid_by_band(int8_t tx_pwr_dbm, uint16_t band_nbr);
 
+/******************************************************************************/
+
+/* Long RD ID index: maps a long RD ID to an item index in a fixed size array.
+ * slot_count must be a power of two, see DECT_MDM_UTILS_RD_ID_INDEX_SIZE().
+ */
+
+/** @return Item index, or -ENOENT if the long RD ID is not in the index. */
+int dect_mdm_utils_rd_id_index_get(const struct dect_mdm_utils_rd_id_index_slot *slots,
+				   size_t slot_count, uint32_t long_rd_id);
+
+/** Add or update the item index of a long RD ID.
+ * @return 0 on success, -EINVAL for long RD ID zero, -ENOMEM if the index is full.
+ */
+int dect_mdm_utils_rd_id_index_add(struct dect_mdm_utils_rd_id_index_slot *slots,
+				   size_t slot_count, uint32_t long_rd_id, uint16_t item);
+
+void dect_mdm_utils_rd_id_index_remove(struct dect_mdm_utils_rd_id_index_slot *slots,
+				       size_t slot_count, uint32_t long_rd_id);
+
 #endif /* DECT_MDM_DRIVER_UTILS_H */
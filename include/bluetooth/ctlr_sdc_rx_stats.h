@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BT_CTLR_SDC_RX_STATS_H__
+#define BT_CTLR_SDC_RX_STATS_H__
+
+/**
+ * @file
+ * @defgroup bt_ctlr_sdc_rx_stats SoftDevice Controller HCI receive statistics
+ * @{
+ * @brief Statistics of the HCI packets passed from the SoftDevice Controller to the host.
+ *
+ * The packet counters and the latency include only the packets passed to the host. Advertising
+ * reports dropped by the filters are counted separately.
+ *
+ * The statistics are available if the SoftDevice Controller runs in the same image as the
+ * host and the CONFIG_BT_CTLR_SDC_RX_STATS Kconfig option is enabled.
+ */
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** HCI receive statistics. */
+struct bt_ctlr_sdc_rx_stats {
+	/** Number of HCI events passed to the host. */
+	uint32_t evt_count;
+	/** Number of HCI ACL data packets passed to the host. */
+	uint32_t acl_count;
+	/** Number of HCI ISO data packets passed to the host. */
+	uint32_t iso_count;
+	/** Number of ACL data packets fetched directly into host buffers. */
+	uint32_t acl_zero_copy_count;
+	/** Number of discardable events dropped because of lack of host buffers.
+	 *  Not included in @ref evt_count.
+	 */
+	uint32_t evt_discarded_count;
+	/** Number of advertising reports dropped because of lack of host buffers.
+	 *  Included in @ref evt_discarded_count.
+	 */
+	uint32_t adv_discarded_count;
+	/** Number of advertising reports dropped by the duplicate filter enabled with
+	 *  CONFIG_BT_CTLR_SDC_RX_ADV_DUP_FILTER.
+	 */
+	uint32_t adv_duplicate_count;
+	/** Number of advertising reports dropped by the rate limit set with
+	 *  CONFIG_BT_CTLR_SDC_RX_ADV_RATE_LIMIT.
+	 */
+	uint32_t adv_rate_limited_count;
+	/** Number of advertising reports queued in the low-priority lane enabled with
+	 *  CONFIG_BT_CTLR_SDC_RX_ADV_LANE.
+	 */
+	uint32_t adv_deferred_count;
+	/** Number of times the processing was stalled waiting for host buffers. */
+	uint32_t no_buf_count;
+	/** Maximum time from fetching a packet until passing it to the host, in microseconds. */
+	uint32_t latency_max_us;
+	/** Sum of the times from fetching a packet until passing it to the host,
+	 *  in microseconds. Divide by the number of packets to get the average.
+	 */
+	uint64_t latency_total_us;
+};
+
+/** @brief Get the HCI receive statistics.
+ *
+ * @param[out] stats Statistics.
+ */
+void bt_ctlr_sdc_rx_stats_get(struct bt_ctlr_sdc_rx_stats *stats);
+
+/** @brief Reset the HCI receive statistics. */
+void bt_ctlr_sdc_rx_stats_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* BT_CTLR_SDC_RX_STATS_H__ */
@@ -332,6 +332,29 @@ static inline void bt_gatt_dm_data_print(const struct bt_gatt_dm *dm)
 }
 #endif
 
+/** @brief Discovery cache statistics. */
+struct bt_gatt_dm_cache_stats {
+	/** Number of discoveries completed from the cache. */
+	uint32_t hits;
+	/** Number of cacheable discoveries performed over the air. */
+	uint32_t misses;
+	/** Number of services written to the cache. */
+	uint32_t stores;
+	/** Time from the start of the last cacheable discovery until the
+	 *  service was ready, in milliseconds.
+	 */
+	uint32_t last_ready_time_ms;
+};
+
+/** @brief Get the discovery cache statistics.
+ *
+ * The function is available only if the
+ * @kconfig{CONFIG_BT_GATT_DM_CACHE} Kconfig option is enabled.
+ *
+ * @param[out] stats Discovery cache statistics.
+ */
+void bt_gatt_dm_cache_stats_get(struct bt_gatt_dm_cache_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
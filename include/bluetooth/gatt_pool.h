@@ -130,6 +130,10 @@ struct bt_gatt_pool {
 	struct bt_gatt_service svc;
 	/** Maximum number of attributes supported. */
 	size_t attr_array_size;
+	/** Memory slab of the attribute array, NULL if the array was not
+	 *  allocated using @ref bt_gatt_pool_attrs_alloc.
+	 */
+	struct k_mem_slab *attr_slab;
 };
 
 /** @brief Take a primary service descriptor from the pool.
@@ -185,7 +189,62 @@ int bt_gatt_pool_ccc_alloc(struct bt_gatt_pool *gp,
  */
 void bt_gatt_pool_free(struct bt_gatt_pool *gp);
 
+#if CONFIG_BT_GATT_POOL_ATTR_SLABS
+/** @brief Take an attribute array for a GATT service from the pool.
+ *
+ *  The array is taken from the smallest attribute array size class that
+ *  can hold @p attr_count attributes and has a free array. Use this function
+ *  instead of @ref BT_GATT_POOL_DEF to size the service at runtime.
+ *
+ *  @param gp GATT service object with no attribute array assigned.
+ *  @param attr_count Required number of attributes.
+ *
+ *  @retval 0 Operation finished successfully.
+ *  @retval -EINVAL Invalid input value.
+ *  @retval -ENOMEM No attribute array of the required size is available.
+ */
+int bt_gatt_pool_attrs_alloc(struct bt_gatt_pool *gp, size_t attr_count);
+
+/** @brief Free the whole dynamically created GATT service together with
+ *         its attribute array.
+ *
+ *  @param gp GATT service object with the attribute array taken using
+ *            @ref bt_gatt_pool_attrs_alloc.
+ */
+void bt_gatt_pool_attrs_free(struct bt_gatt_pool *gp);
+#endif
+
 #if CONFIG_BT_GATT_POOL_STATS != 0
+/** @brief Usage statistics of a single element pool. */
+struct bt_gatt_pool_el_stats {
+	/** Number of elements in the pool. */
+	uint16_t size;
+	/** Number of elements currently in use. */
+	uint16_t used;
+	/** Maximum number of elements that were in use at the same time. */
+	uint16_t max_used;
+};
+
+/** @brief Usage statistics of the module pools. */
+struct bt_gatt_pool_stats {
+	/** 16-bit UUID pool. */
+	struct bt_gatt_pool_el_stats uuid_16;
+	/** 32-bit UUID pool. */
+	struct bt_gatt_pool_el_stats uuid_32;
+	/** 128-bit UUID pool. */
+	struct bt_gatt_pool_el_stats uuid_128;
+	/** Characteristic descriptor pool. */
+	struct bt_gatt_pool_el_stats chrc;
+};
+
+/** @brief Get the module statistics.
+ *
+ *  Identical UUIDs shared by several attributes are counted as one element.
+ *
+ *  @param[out] stats Statistics.
+ */
+void bt_gatt_pool_stats_get(struct bt_gatt_pool_stats *stats);
+
 /** @brief Print basic module statistics (containing pool size usage).
  */
 void bt_gatt_pool_stats_print(void);
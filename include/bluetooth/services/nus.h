@@ -79,6 +79,15 @@ struct bt_nus_cb {
 	 */
 	void (*send_enabled)(enum bt_nus_send_status status);
 
+	/** @brief Stream ready callback.
+	 *
+	 * Space has been freed in the TX buffer of the connection after
+	 * @ref bt_nus_stream_send did not accept all of the data.
+	 * Used only if CONFIG_BT_NUS_STREAM is enabled.
+	 *
+	 * @param[in] conn Pointer to connection object.
+	 */
+	void (*stream_ready)(struct bt_conn *conn);
 };
 
 /**@brief Initialize the NUS Service.
@@ -113,6 +122,36 @@ int bt_nus_init(struct bt_nus_cb *callbacks);
  */
 int bt_nus_send(struct bt_conn *conn, const uint8_t *data, uint16_t len);
 
+/**@brief Queue data for streaming to a connected peer.
+ *
+ * @details The data is copied to the TX buffer of the connection and sent
+ *          in notifications as large as the ATT MTU allows. If the TX
+ *          buffer does not have enough space, only part of the data is
+ *          accepted. The stream_ready callback is called when space is
+ *          freed in the TX buffer.
+ *
+ * @note This function requires CONFIG_BT_NUS_STREAM to be enabled and
+ *       @ref bt_nus_init to be called before the connection is established.
+ *
+ * @param[in] conn Pointer to connection object.
+ * @param[in] data Pointer to a data buffer.
+ * @param[in] len  Length of the data in the buffer.
+ *
+ * @return Number of bytes accepted. Otherwise, a negative value is returned.
+ */
+int bt_nus_stream_send(struct bt_conn *conn, const uint8_t *data, uint16_t len);
+
+/**@brief Get the free space in the TX buffer of a connection.
+ *
+ * @note This function requires CONFIG_BT_NUS_STREAM to be enabled.
+ *
+ * @param[in] conn Pointer to connection object.
+ *
+ * @return Number of bytes that can be queued using @ref bt_nus_stream_send.
+ *         Otherwise, a negative value is returned.
+ */
+int bt_nus_stream_space_get(struct bt_conn *conn);
+
 /**@brief Get maximum data length that can be used for @ref bt_nus_send.
  *
  * @param[in] conn Pointer to connection Object.
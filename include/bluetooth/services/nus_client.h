@@ -133,11 +133,15 @@ int bt_nus_client_init(struct bt_nus_client *nus,
  * @note This procedure is asynchronous. Therefore, the data to be sent must
  * remain valid while the function is active.
  *
+ * Only one write can be in progress at a time. The sent callback reports
+ * when the next write can be started.
+ *
  * @param[in,out] nus NUS Client instance.
  * @param[in] data Data to be transmitted.
  * @param[in] len Length of data.
  *
  * @retval 0 If the operation was successful.
+ * @retval -EALREADY If the previous write is still in progress.
  *           Otherwise, a negative error code is returned.
  */
 int bt_nus_client_send(struct bt_nus_client *nus, const uint8_t *data,
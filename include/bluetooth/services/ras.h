@@ -198,6 +198,20 @@ struct bt_ras_rd_buffer_cb {
 	sys_snode_t node;
 };
 
+/** @brief RAS Ranging Data buffer statistics of a connection. */
+struct bt_ras_rd_buffer_stats {
+	/** Number of complete procedures stored. */
+	uint32_t stored;
+	/** Number of stored procedures overwritten before the peer acknowledged them. */
+	uint32_t overwritten;
+	/** Number of procedures dropped because no buffer was available. */
+	uint32_t dropped_no_buffer;
+	/** Number of procedures dropped because they did not fit in a buffer. */
+	uint32_t dropped_no_space;
+	/** Number of procedures dropped because they were aborted. */
+	uint32_t dropped_aborted;
+};
+
 /** @brief RAS Ranging Data buffer structure.
  *
  *  Provides storage and metadata to store a complete Ranging Data body
@@ -306,6 +320,18 @@ struct ras_rd_buffer *bt_ras_rd_buffer_claim(struct bt_conn *conn, uint16_t rang
  */
 int bt_ras_rd_buffer_release(struct ras_rd_buffer *buf);
 
+/** @brief Get the ranging data buffer statistics of a connection.
+ *
+ *  The statistics are reset when a new connection is established.
+ *
+ *  @param conn Connection instance.
+ *  @param stats Statistics.
+ *
+ *  @retval 0 Success.
+ *  @retval -EINVAL Invalid connection or statistics pointer provided.
+ */
+int bt_ras_rd_buffer_stats_get(struct bt_conn *conn, struct bt_ras_rd_buffer_stats *stats);
+
 /** @brief Pull bytes from a ranging data buffer.
  *
  *  Utility method to consume up to max_data_len bytes from a buffer.
@@ -79,6 +79,7 @@ APP_EVENT_TYPE_DECLARE(sensor_state_event);
  * the array depends only on selected sensor. For example an accelerometer may report acceleration
  * in X, Y and Z axis as three fixed-point values. @ref sensor_event_get_data_cnt and @ref
  * sensor_event_get_data_ptr can be used to access the sensor data provided by a given sensor event.
+ * A single event may carry multiple consecutive samples, placed one after another.
  *
  * @note The sensor event related to the given sensor must use the same description as
  *       #sensor_state_event related to the sensor.
@@ -85,6 +85,26 @@ struct sm_sensor_config {
 	 * @brief Flag to indicate whether sensor should be suspended or not.
 	 */
 	bool suspend;
+	/**
+	 * @brief Number of samples per sensor event
+	 *
+	 * Samples are stored directly in the data of a sensor event and the event is
+	 * submitted once the given number of samples is collected. The samples are placed
+	 * one after another, each consisting of the data of all the sampled channels.
+	 * Value 0 or 1 means that every sample is submitted in a separate event.
+	 */
+	uint8_t samples_per_event;
+	/**
+	 * @brief FIFO watermark trigger configuration
+	 *
+	 * If set, the sensor is not sampled periodically. Instead, the sensor manager waits
+	 * for the trigger and then drains the sensor FIFO by fetching the number of samples
+	 * defined by @ref samples_per_event, which are submitted in a single sensor event.
+	 * The sensor driver must return consecutive FIFO entries on consecutive sample fetches
+	 * and the trigger should fire when the FIFO contains at least that many samples.
+	 * Cannot be used together with @ref trigger.
+	 */
+	const struct sensor_trigger *fifo_trigger;
 };
 
 #ifdef __cplusplus
@@ -167,6 +167,11 @@ int dfu_multi_image_register_writer(const struct dfu_image_writer *writer);
  *
  * A user shall NOT write any more chunks after any write results in a failure.
  *
+ * If @kconfig{CONFIG_DFU_MULTI_IMAGE_BUFFERED_WRITE} is enabled, the chunk is only queued
+ * for writing and the function returns as soon as the data is copied to an internal
+ * buffer. An error reported by an image writer is then returned by the subsequent call
+ * to this function or to @c dfu_multi_image_done.
+ *
  * @param[in] offset Offset of the chunk within the entire package.
  * @param[in] chunk Pointer to the chunk's data.
  * @param[in] chunk_size Size of the chunk.
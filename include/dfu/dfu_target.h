@@ -66,6 +66,9 @@ struct dfu_target {
 	int (*done)(bool successful);
 	int (*schedule_update)(int img_num);
 	int (*reset)();
+	/* Optional, targets that can receive data directly into their write buffer */
+	int (*write_buf_get)(void **buf, size_t *len);
+	int (*write_buf_commit)(size_t len);
 };
 
 /**
@@ -140,6 +143,33 @@ int dfu_target_offset_get(size_t *offset);
  **/
 int dfu_target_write(const void *const buf, size_t len);
 
+/**
+ * @brief Get a buffer to receive the next part of the firmware image into.
+ *
+ * Lets the caller place firmware data directly in the write buffer of the
+ * initialized DFU target, avoiding the copy done by @ref dfu_target_write.
+ * The received data must be committed with @ref dfu_target_write_buf_commit
+ * before the buffer is requested again or @ref dfu_target_write is called.
+ *
+ * @param[out] buf Buffer to receive data into.
+ * @param[out] len Number of bytes that can be received into @p buf.
+ *
+ * @retval 0 on success.
+ * @retval -EACCES if no DFU target is initialized.
+ * @retval -ENOTSUP if the DFU target does not support this.
+ * @return Other negative error code on failure.
+ */
+int dfu_target_write_buf_get(void **buf, size_t *len);
+
+/**
+ * @brief Commit data received into the buffer from @ref dfu_target_write_buf_get.
+ *
+ * @param[in] len Number of bytes received into the buffer.
+ *
+ * @return 0 on success, negative error code on failure.
+ */
+int dfu_target_write_buf_commit(size_t len);
+
 /**
  * @brief Release the resources that were needed for the current DFU
  *	  target.
@@ -65,6 +65,29 @@ int dfu_target_mcuboot_offset_get(size_t *offset);
  */
 int dfu_target_mcuboot_write(const void *const buf, size_t len);
 
+/**
+ * @brief Get the free part of the flash write buffer.
+ *
+ * See @ref dfu_target_write_buf_get.
+ *
+ * @param[out] buf Start of the free part of the write buffer.
+ * @param[out] len Number of bytes that can be written to @p buf.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dfu_target_mcuboot_write_buf_get(void **buf, size_t *len);
+
+/**
+ * @brief Commit firmware data written to the flash write buffer.
+ *
+ * See @ref dfu_target_write_buf_commit.
+ *
+ * @param[in] len Number of bytes written to the buffer.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dfu_target_mcuboot_write_buf_commit(size_t len);
+
 /**
  * @brief Deinitialize resources and finalize firmware upgrade if successful.
 
@@ -101,6 +101,44 @@ int dfu_target_stream_bytes_buffered_get(size_t *out);
  */
 int dfu_target_stream_write(const uint8_t *buf, size_t len);
 
+/**
+ * @brief Get the free part of the stream flash write buffer.
+ *
+ * Lets the caller receive firmware data directly into the write buffer
+ * instead of passing it to @ref dfu_target_stream_write, which copies it.
+ * The data must be committed with @ref dfu_target_stream_write_buf_commit
+ * before the buffer is requested again or any other data is written.
+ *
+ * Not supported with CONFIG_DFU_TARGET_STREAM_SYNCHRONOUS, as every write
+ * must then be flushed immediately.
+ *
+ * @param[out] buf Start of the free part of the write buffer.
+ * @param[out] len Number of bytes that can be written to @p buf, limited to
+ *                 the space left in the flash area.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p buf or @p len is NULL.
+ * @retval -EACCES if the stream is not initialized.
+ * @retval -ENOTSUP if CONFIG_DFU_TARGET_STREAM_SYNCHRONOUS is enabled.
+ * @retval -ENOMEM if the flash area is full.
+ */
+int dfu_target_stream_write_buf_get(uint8_t **buf, size_t *len);
+
+/**
+ * @brief Commit data written to the buffer from @ref dfu_target_stream_write_buf_get.
+ *
+ * The write buffer is written to flash once it is full.
+ *
+ * @param[in] len Number of bytes written to the buffer.
+ *
+ * @retval 0 on success.
+ * @retval -EACCES if the stream is not initialized.
+ * @retval -EINVAL if @p len exceeds the free part of the write buffer.
+ * @retval -ENOMEM if @p len exceeds the space left in the flash area.
+ * @return Other negative errno if the buffer could not be written to flash.
+ */
+int dfu_target_stream_write_buf_commit(size_t len);
+
 /**
  * @brief Release resources and finalize stream flash write if successful.
 
@@ -87,6 +87,9 @@ const char *ei_wrapper_get_classifier_label(size_t idx);
  *
  * Size of the added data must be divisible by input frame size.
  *
+ * If the input data buffer stores quantized values, the data is converted to
+ * fixed-point numbers while it is added to the buffer.
+ *
  * @param[in] data       Pointer to the buffer with input data.
  * @param[in] data_size  Size of the data (number of floating-point values).
  *
@@ -118,6 +121,10 @@ int ei_wrapper_clear_data(bool *cancelled);
  * If there is not enough data in the input buffer, the prediction start is
  * delayed until the missing data is added.
  *
+ * If the incremental feature extraction is enabled, the input window must be
+ * shifted by a multiple of the slice size used by the Edge Impulse library.
+ * Otherwise, the function returns -EINVAL.
+ *
  * @param[in] window_shift  Number of windows the input window is shifted before
  *                          prediction.
  * @param[in] frame_shift   Number of frames the input window is shifted before
@@ -175,6 +182,10 @@ int ei_wrapper_get_anomaly(float *anomaly);
  * If calculating the anomaly value is not supported, anomaly_time is set to
  * the value of -1.
  *
+ * If the incremental feature extraction is enabled, the returned times are
+ * the sums of times spent on processing all of the input slices passed to
+ * the library during the prediction.
+ *
  * @param[out] dsp_time            Pointer to the variable that is used to store
  *                                 the dsp time.
  * @param[out] classification_time Pointer to the variable that is used to store
@@ -64,6 +64,16 @@ enum location_req_mode {
 	LOCATION_REQ_MODE_FALLBACK = 0,
 	/** All requested methods are used sequentially. */
 	LOCATION_REQ_MODE_ALL,
+	/**
+	 * All requested methods are started at the same time.
+	 *
+	 * Wi-Fi and cellular scan results are combined into a single cloud request that runs
+	 * in parallel with GNSS. The first location that meets
+	 * @ref location_config.accuracy_target is returned and the other methods are cancelled.
+	 * If no location meets the target, the most accurate location is returned when all
+	 * methods have completed.
+	 */
+	LOCATION_REQ_MODE_CONCURRENT,
 };
 
 /** Event IDs. */
@@ -532,6 +542,8 @@ struct location_config {
 	 * these methods are handled together, if the following conditions are met:
 	 *   - Methods are one after the other in location request method list
 	 *   - @ref mode is @ref LOCATION_REQ_MODE_FALLBACK
+	 *
+	 * They are always combined if @ref mode is @ref LOCATION_REQ_MODE_CONCURRENT.
 	 */
 	struct location_method_config methods[CONFIG_LOCATION_METHODS_LIST_SIZE];
 
@@ -570,6 +582,21 @@ struct location_config {
 	 * location_config_defaults_set() function is called.
 	 */
 	enum location_req_mode mode;
+
+	/**
+	 * @brief Accuracy target (in meters) for @ref LOCATION_REQ_MODE_CONCURRENT.
+	 *
+	 * @details The first location with an accuracy of this value or better completes the
+	 * location request and the other methods are cancelled. Set to 0 to accept the first
+	 * location from any method.
+	 *
+	 * Default value is 100 meters. It is applied when
+	 * location_config_defaults_set() function is called and can be changed at build time
+	 * with @kconfig{CONFIG_LOCATION_REQUEST_DEFAULT_ACCURACY_TARGET} configuration.
+	 *
+	 * This is not used in other modes.
+	 */
+	uint32_t accuracy_target;
 };
 
 /**
@@ -946,6 +946,30 @@ struct dect_association_data {
 	struct in6_addr global_ipv6_addr;
 };
 
+/** @brief Data TX statistics. */
+struct dect_tx_stats {
+	/** Packets queued for transmission in the driver. */
+	uint32_t queued;
+
+	/** Packets handed over to the modem. */
+	uint32_t sent;
+
+	/** Packets dropped because the queue was full or the modem refused them. */
+	uint32_t dropped;
+
+	/** Packets currently waiting in the queue. */
+	uint16_t queue_depth;
+
+	/** Highest number of packets that have been waiting in the queue. */
+	uint16_t queue_depth_max;
+
+	/** Average time from queueing to the modem TX acknowledgment, in milliseconds. */
+	uint32_t latency_avg_ms;
+
+	/** Longest time from queueing to the modem TX acknowledgment, in milliseconds. */
+	uint32_t latency_max_ms;
+};
+
 /** @brief DECT NR+ status information. */
 struct dect_status_info {
 
@@ -976,6 +1000,9 @@ struct dect_status_info {
 
 	/** Modem firmware version */
 	char fw_version_str[100];
+
+	/** Data TX statistics, zeroed if not supported by the driver */
+	struct dect_tx_stats tx_stats;
 };
 
 /** @brief DECT NR+ HAL API. */
@@ -92,6 +92,11 @@ struct downloader_fragment {
 	const void *buf;
 	/** Length of fragment. */
 	size_t len;
+	/**
+	 * The fragment was received into the buffer given by the
+	 * @ref downloader_cfg.buf_get callback, and does not need to be copied.
+	 */
+	bool app_buf;
 };
 
 /**
@@ -129,6 +134,25 @@ struct downloader_evt {
  */
 typedef int (*downloader_callback_t)(const struct downloader_evt *event);
 
+/**
+ * @brief Downloader application buffer callback.
+ *
+ * Through this optional callback, the application can provide the buffer that the next
+ * fragment is received into, for example the write buffer of the flash it is stored in.
+ * This saves copying the fragment from the downloader buffer.
+ * Protocol headers are always received into the downloader buffer, so the callback is
+ * only used for the payload that follows them, and only by transports supporting it.
+ *
+ * The fragment is given in a @c DOWNLOADER_EVT_FRAGMENT event with
+ * @ref downloader_fragment.app_buf set.
+ *
+ * @param[out] buf Buffer to receive the next fragment into.
+ * @param[out] len Size of @p buf.
+ *
+ * @return Zero if a buffer is provided, non-zero to use the downloader buffer.
+ */
+typedef int (*downloader_buf_get_t)(void **buf, size_t *len);
+
 /**
  * @brief Downloader configuration options.
  */
@@ -139,6 +163,8 @@ struct downloader_cfg {
 	char *buf;
 	/** Downloader buffer size. */
 	size_t buf_size;
+	/** Optional application buffer callback. */
+	downloader_buf_get_t buf_get;
 };
 
 /**
@@ -33,6 +33,38 @@
  */
 int dl_transport_evt_data(struct downloader *dl, void *data, size_t len);
 
+/**
+ * @brief Get an application buffer to receive data into.
+ *
+ * Transports may call this function once the protocol header of a response is processed,
+ * to receive the payload directly into a buffer provided by the application.
+ * Data received into this buffer must be given to @ref dl_transport_evt_app_buf_data.
+ *
+ * @param dl Downloader instance.
+ * @param buf Application buffer.
+ * @param len Size of application buffer.
+ *
+ * @retval Zero if an application buffer is provided.
+ * @return Negative errno if the downloader buffer must be used.
+ */
+int dl_transport_app_buf_get(struct downloader *dl, void **buf, size_t *len);
+
+/**
+ * @brief Transport data event callback for data in an application buffer.
+ *
+ * This function is called by the transport to notify the downloader of data
+ * downloaded into the buffer from @ref dl_transport_app_buf_get.
+ *
+ * @param dl Downloader instance.
+ * @param data Downloaded data.
+ * @param len Length of downloaded data.
+ *
+ * @retval Zero if the fragment was accepted and the download can continue.
+ * @return Negative errno if the fragment was refused by the application and the download
+ *         should be aborted.
+ */
+int dl_transport_evt_app_buf_data(struct downloader *dl, void *data, size_t len);
+
 /**
  * Downloader transport API
  */
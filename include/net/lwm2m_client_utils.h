@@ -333,6 +333,85 @@ void lwm2m_utils_connection_manage(struct lwm2m_ctx *client,
 void lwm2m_utils_rai_event_cb(struct lwm2m_ctx *client,
 				      enum lwm2m_rd_client_event *client_event);
 
+#if defined(CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE)
+/** Statistics of the coalesced resource updates. */
+struct lwm2m_coalesce_stats {
+	/** Updates dropped because the value was within the step of the reported value. */
+	uint32_t suppressed;
+	/** Updates replaced by a newer value before the end of the coalescing window. */
+	uint32_t coalesced;
+	/** Values written to the LwM2M engine, which notifies the observers of the changes. */
+	uint32_t written;
+};
+
+/**
+ * @brief Set the minimum change of a resource value that is reported.
+ *
+ * An update of the resource is dropped if it differs from the last reported value by
+ * less than the step.
+ *
+ * @param path LwM2M path of the resource.
+ * @param step Minimum change, 0 to report every change.
+ *
+ * @return Zero if success, -ENOMEM if there is no room to track the resource.
+ */
+int lwm2m_coalesce_step_set(const struct lwm2m_obj_path *path, uint32_t step);
+
+/**
+ * @brief Update a resource value at the end of the coalescing window.
+ *
+ * The value is written to the LwM2M engine together with the other values updated
+ * within CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE_WINDOW_MS milliseconds.
+ *
+ * @param path LwM2M path of the resource.
+ * @param value New value.
+ *
+ * @return Zero if success, negative error code otherwise.
+ */
+int lwm2m_coalesce_set_u16(const struct lwm2m_obj_path *path, uint16_t value);
+
+/** @copydoc lwm2m_coalesce_set_u16 */
+int lwm2m_coalesce_set_u32(const struct lwm2m_obj_path *path, uint32_t value);
+
+/** @copydoc lwm2m_coalesce_set_u16 */
+int lwm2m_coalesce_set_s16(const struct lwm2m_obj_path *path, int16_t value);
+
+/** @copydoc lwm2m_coalesce_set_u16 */
+int lwm2m_coalesce_set_s32(const struct lwm2m_obj_path *path, int32_t value);
+
+/**
+ * @brief Write the pending resource values without waiting for the end of the window.
+ */
+void lwm2m_coalesce_flush(void);
+
+/**
+ * @brief Get the statistics of the coalesced resource updates.
+ *
+ * @param stats Statistics.
+ */
+void lwm2m_coalesce_stats_get(struct lwm2m_coalesce_stats *stats);
+#else
+static inline int lwm2m_coalesce_set_u16(const struct lwm2m_obj_path *path, uint16_t value)
+{
+	return lwm2m_set_u16(path, value);
+}
+
+static inline int lwm2m_coalesce_set_u32(const struct lwm2m_obj_path *path, uint32_t value)
+{
+	return lwm2m_set_u32(path, value);
+}
+
+static inline int lwm2m_coalesce_set_s16(const struct lwm2m_obj_path *path, int16_t value)
+{
+	return lwm2m_set_s16(path, value);
+}
+
+static inline int lwm2m_coalesce_set_s32(const struct lwm2m_obj_path *path, int32_t value)
+{
+	return lwm2m_set_s32(path, value);
+}
+#endif /* CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE */
+
 /* Advanced firmare object support */
 uint8_t lwm2m_adv_firmware_get_update_state(uint16_t obj_inst_id);
 void lwm2m_adv_firmware_set_update_state(uint16_t obj_inst_id, uint8_t state);
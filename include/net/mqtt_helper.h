@@ -98,7 +98,48 @@ struct mqtt_helper_conn_params {
 	 *  Leave as NULL if not specified.
 	 */
 	const char *if_name;
+
+	/** Request a persistent session by clearing the clean session flag in the CONNECT
+	 *  message. The broker then keeps the subscriptions and the QoS 1 messages sent to
+	 *  the client over a reconnection.
+	 */
+	bool persistent_session;
+};
+
+#if defined(CONFIG_MQTT_HELPER_STATS)
+/** @brief MQTT helper statistics.
+ *
+ *  The connection times and byte counts are for the latest connection and are reset
+ *  when a new connection is started.
+ */
+struct mqtt_helper_stats {
+	/** Number of connection attempts since the library was initialized. */
+	uint32_t connect_count;
+
+	/** Number of broker address lookups that were served from the DNS cache. */
+	uint32_t dns_cache_hits;
+
+	/** Time in milliseconds spent resolving the broker address. */
+	uint32_t dns_time_ms;
+
+	/** Time in milliseconds spent setting up the transport, including the TCP and
+	 *  TLS handshakes and sending the CONNECT message.
+	 */
+	uint32_t transport_connect_time_ms;
+
+	/** Time in milliseconds from the start of the transport setup until CONNACK. */
+	uint32_t connack_time_ms;
+
+	/** Number of topic and payload bytes in the PUBLISH messages that were sent. */
+	uint32_t tx_bytes;
+
+	/** Number of topic and payload bytes in the PUBLISH messages that were received. */
+	uint32_t rx_bytes;
+
+	/** Number of queued messages that were sent after CONNACK. */
+	uint32_t replayed_count;
 };
+#endif /* CONFIG_MQTT_HELPER_STATS */
 
 /** @brief Initialize the MQTT helper.
  *
@@ -136,9 +177,16 @@ int mqtt_helper_disconnect(void);
 int mqtt_helper_subscribe(struct mqtt_subscription_list *sub_list);
 
 /** @brief Publish an MQTT message.
+ *
+ *  With CONFIG_MQTT_HELPER_PUBLISH_QUEUE, a QoS 1 message is copied to a queue until it
+ *  is acknowledged. If the client is not connected, the message is sent after the next
+ *  CONNACK. If the connection is lost before the acknowledgment, the message is sent
+ *  again with the DUP flag set after the next CONNACK.
  *
  *  @retval 0 if successful.
  *  @retval -EOPNOTSUPP if operation is not supported in the current state.
+ *  @retval -ENOMEM if the message must be queued but the queue is full.
+ *  @retval -EMSGSIZE if the message must be queued but it is too large for the queue.
  *  @return Otherwise a negative error code.
  */
 int mqtt_helper_publish(const struct mqtt_publish_param *param);
@@ -152,8 +200,17 @@ int mqtt_helper_publish(const struct mqtt_publish_param *param);
  */
 uint16_t mqtt_helper_msg_id_get(void);
 
+#if defined(CONFIG_MQTT_HELPER_STATS)
+/** @brief Get the MQTT helper statistics.
+ *
+ *  @param[out] stats Statistics.
+ */
+void mqtt_helper_stats_get(struct mqtt_helper_stats *stats);
+#endif /* CONFIG_MQTT_HELPER_STATS */
+
 /** @brief Deinitialize library. Must be called when all MQTT operations are done to
  *	   release resources and allow for a new client. The client must be in a disconnected state.
+ *	   Messages in the publish queue are dropped.
  *
  *  @retval 0 if successful.
  *  @retval -EOPNOTSUPP if operation is not supported in the current state.
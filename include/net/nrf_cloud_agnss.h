@@ -78,6 +78,26 @@ void nrf_cloud_agnss_processed(struct nrf_modem_gnss_agnss_data_frame *received_
  */
 bool nrf_cloud_agnss_request_in_progress(void);
 
+#if defined(CONFIG_NRF_CLOUD_AGNSS_STORE)
+/** @brief Inject stored A-GNSS data and remove it from a request.
+ *
+ * Injects the stored GPS ephemerides, almanacs, UTC parameters and ionospheric
+ * corrections that are requested and still valid, and clears them from the request.
+ * The remaining request can then be passed to nRF Cloud.
+ *
+ * @param request A-GNSS data requested by GNSS. Updated to contain only the data
+ *                that was not injected.
+ *
+ * @retval -EINVAL request was NULL.
+ * @retval -ENODATA Current time is not known, nothing was injected.
+ * @return Number of injected A-GNSS data elements.
+ */
+int nrf_cloud_agnss_store_inject(struct nrf_modem_gnss_agnss_data_frame *request);
+
+/** @brief Remove all stored A-GNSS data. */
+void nrf_cloud_agnss_store_clear(void);
+#endif /* CONFIG_NRF_CLOUD_AGNSS_STORE */
+
 /** @} */
 
 #ifdef __cplusplus
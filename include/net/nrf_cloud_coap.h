@@ -499,6 +499,125 @@ int nrf_cloud_coap_bytes_send(uint8_t *buf, size_t buf_len, bool confirmable);
  */
 int nrf_cloud_coap_obj_send(struct nrf_cloud_obj *const obj, bool confirmable);
 
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+/**
+ * @brief Completion callback of an asynchronous request.
+ *
+ * @param[in] result 0 if the request succeeded, or if no response was received to a NON request.
+ *                   Negative values are device-side errors defined in errno.h.
+ *                   Positive values are cloud-side errors (CoAP result codes)
+ *                   defined in zephyr/net/coap.h.
+ * @param[in] user   User data of the request.
+ */
+typedef void (*nrf_cloud_coap_async_cb_t)(int result, void *user);
+
+/** @brief Asynchronous CoAP request. */
+struct nrf_cloud_coap_async_req {
+	/** CoAP method. */
+	enum coap_method method;
+	/** Resource path. */
+	const char *resource;
+	/** Optional query string; can be NULL. */
+	const char *query;
+	/** Payload. Must stay valid until the completion callback is called. */
+	const uint8_t *buf;
+	/** Payload length. */
+	size_t len;
+	/** Content format of the payload. */
+	enum coap_content_format fmt_out;
+	/** Content format of the expected response. Used only if response_expected is set. */
+	enum coap_content_format fmt_in;
+	/** Add an Accept option with fmt_in to the request. */
+	bool response_expected;
+	/** Use a CON request instead of a NON request. */
+	bool reliable;
+	/** Optional callback called for each block of the response; can be NULL. */
+	coap_client_response_cb_t response_cb;
+	/** Optional callback called once the request is completed; can be NULL. */
+	nrf_cloud_coap_async_cb_t done_cb;
+	/** User data passed to the callbacks. */
+	void *user;
+};
+
+/**
+ * @brief Queue a CoAP request and return without waiting for the response.
+ *
+ * Up to CONFIG_NRF_CLOUD_COAP_ASYNC_NSTART requests are sent to the server at the same time.
+ * The remaining requests are kept in a queue and sent in order as the earlier requests complete.
+ * The callbacks are called from the CoAP client thread or the system workqueue and must not block.
+ *
+ * @param[in] req Request. The structure is copied, but the buffers it points to
+ *                must stay valid until the completion callback is called.
+ *
+ * @retval 0 If the request was queued.
+ * @retval -EACCES Device does not have a valid nRF Cloud CoAP connection.
+ * @retval -ENOBUFS CONFIG_NRF_CLOUD_COAP_ASYNC_QUEUE_SIZE requests are already queued.
+ * @retval -ETXTBSY The resource path and the query do not fit in the request.
+ */
+int nrf_cloud_coap_async_request(const struct nrf_cloud_coap_async_req *req);
+
+/** @brief Batch of JSON messages sent to nRF Cloud in a single request. */
+struct nrf_cloud_coap_batch {
+	/** Buffer holding the JSON array of the messages. */
+	char *buf;
+	/** Size of the buffer. */
+	size_t size;
+	/** Length of the JSON array, excluding the closing bracket. */
+	size_t len;
+	/** Number of messages in the batch. */
+	size_t count;
+	/** The batch is being sent. */
+	bool busy;
+};
+
+/**
+ * @brief Initialize an empty batch of JSON messages.
+ *
+ * The function can also be used to reuse a batch after it was sent.
+ *
+ * @param[out] batch Batch.
+ * @param[in]  buf   Buffer for the messages.
+ * @param[in]  size  Size of the buffer.
+ *
+ * @retval 0 If successful.
+ * @retval -EINVAL The buffer is too small to hold an empty JSON array.
+ */
+int nrf_cloud_coap_batch_init(struct nrf_cloud_coap_batch *batch, char *buf, size_t size);
+
+/**
+ * @brief Add a JSON message to a batch.
+ *
+ * The message must be a JSON object in the format expected by the nRF Cloud d2c topic.
+ *
+ * @param[in,out] batch   Batch.
+ * @param[in]     message Null-terminated JSON message.
+ *
+ * @retval 0 If successful.
+ * @retval -EBUSY The batch is being sent.
+ * @retval -ENOMEM The message does not fit in the batch. Send the batch and add the message again.
+ */
+int nrf_cloud_coap_batch_json_add(struct nrf_cloud_coap_batch *batch, const char *message);
+
+/**
+ * @brief Send a batch of JSON messages to the d2c/bulk resource asynchronously.
+ *
+ * The batch cannot be modified until the completion callback is called.
+ * Use nrf_cloud_coap_batch_init() to reuse it afterwards.
+ *
+ * @param[in,out] batch       Batch.
+ * @param[in]     confirmable Select whether to use a CON or NON CoAP transfer.
+ * @param[in]     cb          Optional completion callback; can be NULL.
+ * @param[in]     user        User data passed to the callback.
+ *
+ * @retval 0 If the batch was queued.
+ * @retval -ENODATA The batch is empty.
+ * @retval -EBUSY The batch is already being sent.
+ * @return Other negative values are errors returned by nrf_cloud_coap_async_request().
+ */
+int nrf_cloud_coap_batch_send(struct nrf_cloud_coap_batch *batch, bool confirmable,
+			      nrf_cloud_coap_async_cb_t cb, void *user);
+#endif /* CONFIG_NRF_CLOUD_COAP_ASYNC */
+
 /** @} */
 
 #ifdef __cplusplus
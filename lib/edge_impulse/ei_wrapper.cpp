@@ -33,6 +33,28 @@ BUILD_ASSERT(CONFIG_EI_WRAPPER_THREAD_STACK_SIZE > 0);
 #define THREAD_PRIORITY 	CONFIG_EI_WRAPPER_THREAD_PRIORITY
 #define DEBUG_MODE		IS_ENABLED(CONFIG_EI_WRAPPER_DEBUG_MODE)
 
+#if CONFIG_EI_WRAPPER_DATA_BUF_INT16
+typedef int16_t buf_value_t;
+#define BUF_VALUE_MIN		INT16_MIN
+#define BUF_VALUE_MAX		INT16_MAX
+#elif CONFIG_EI_WRAPPER_DATA_BUF_INT8
+typedef int8_t buf_value_t;
+#define BUF_VALUE_MIN		INT8_MIN
+#define BUF_VALUE_MAX		INT8_MAX
+#else
+typedef float buf_value_t;
+#endif
+
+#if CONFIG_EI_WRAPPER_CONTINUOUS
+#define INPUT_SLICE_SIZE	EI_CLASSIFIER_SLICE_SIZE
+
+/* Continuous classification is supported only for single-axis impulses. */
+BUILD_ASSERT(INPUT_FRAME_SIZE == 1);
+BUILD_ASSERT(INPUT_WINDOW_SIZE % INPUT_SLICE_SIZE == 0);
+#else
+#define INPUT_SLICE_SIZE	INPUT_WINDOW_SIZE
+#endif
+
 enum state {
 	STATE_DISABLED,
 	STATE_WAITING_FOR_DATA,
@@ -41,10 +63,13 @@ enum state {
 };
 
 struct data_buffer {
-	float buf[DATA_BUFFER_SIZE];
+	buf_value_t buf[DATA_BUFFER_SIZE];
 	size_t process_idx;
 	size_t append_idx;
 	size_t wait_data_size;
+	/* Size of the window part that was not processed by the previous prediction. */
+	size_t new_data_size;
+	bool window_processed;
 	struct k_spinlock lock;
 	enum state state;
 };
@@ -58,6 +83,7 @@ static K_SEM_DEFINE(ei_sem, 0, 1);
 static struct data_buffer ei_input;
 static ei_impulse_result_t ei_result;
 static int cur_res_idx;
+static size_t slice_offset;
 static ei_wrapper_result_ready_cb user_cb;
 
 
@@ -65,6 +91,43 @@ BUILD_ASSERT(DATA_BUFFER_SIZE > INPUT_WINDOW_SIZE);
 BUILD_ASSERT(INPUT_WINDOW_SIZE % INPUT_FRAME_SIZE == 0);
 
 
+#if CONFIG_EI_WRAPPER_DATA_BUF_FLOAT
+static void values_store(buf_value_t *dst, const float *src, size_t len)
+{
+	memcpy(dst, src, len * sizeof(dst[0]));
+}
+
+static void values_load(float *dst, const buf_value_t *src, size_t len)
+{
+	memcpy(dst, src, len * sizeof(dst[0]));
+}
+#else
+#define QUANT_SCALE	((float)(1U << CONFIG_EI_WRAPPER_DATA_BUF_FRAC_BITS))
+
+static void values_store(buf_value_t *dst, const float *src, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		float val = roundf(src[i] * QUANT_SCALE);
+
+		if (!(val > BUF_VALUE_MIN)) {
+			/* Also handles NaN. */
+			dst[i] = (val < 0) ? BUF_VALUE_MIN : 0;
+		} else if (val > BUF_VALUE_MAX) {
+			dst[i] = BUF_VALUE_MAX;
+		} else {
+			dst[i] = (buf_value_t)val;
+		}
+	}
+}
+
+static void values_load(float *dst, const buf_value_t *src, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		dst[i] = src[i] * (1.0f / QUANT_SCALE);
+	}
+}
+#endif /* CONFIG_EI_WRAPPER_DATA_BUF_FLOAT */
+
 static size_t buf_get_collected_data_count(const struct data_buffer *b)
 {
 	if (b->append_idx >= b->process_idx) {
@@ -84,12 +147,13 @@ static size_t buf_calc_free_space(const struct data_buffer *b)
 	return ARRAY_SIZE(b->buf) - buf_get_collected_data_count(b) - 1;
 }
 
-static void buf_processing_end(struct data_buffer *b)
+static void buf_processing_end(struct data_buffer *b, bool processed)
 {
 	k_spinlock_key_t key = k_spin_lock(&b->lock);
 
 	__ASSERT_NO_MSG(b->state == STATE_PROCESSING);
 	b->state = STATE_READY;
+	b->window_processed = processed;
 
 	k_spin_unlock(&b->lock, key);
 }
@@ -111,6 +175,7 @@ static int buf_cleanup(struct data_buffer *b, bool *cancelled)
 		b->process_idx = 0;
 		b->append_idx = 0;
 		b->wait_data_size = 0;
+		b->window_processed = false;
 		b->state = STATE_READY;
 	}
 
@@ -157,11 +222,10 @@ static int buf_append(struct data_buffer *b, const float *data, size_t len,
 	if (looped) {
 		size_t copy_cnt = ARRAY_SIZE(b->buf) - cur_idx;
 
-		memcpy(&b->buf[cur_idx], data, copy_cnt * sizeof(b->buf[0]));
-		memcpy(&b->buf[0], data + copy_cnt,
-		      (len - copy_cnt) * sizeof(b->buf[0]));
+		values_store(&b->buf[cur_idx], data, copy_cnt);
+		values_store(&b->buf[0], data + copy_cnt, len - copy_cnt);
 	} else {
-		memcpy(&b->buf[cur_idx], data, len * sizeof(b->buf[0]));
+		values_store(&b->buf[cur_idx], data, len);
 	}
 
 	return 0;
@@ -181,15 +245,13 @@ static void buf_get(const struct data_buffer *b, float *b_res, size_t offset,
 	if ((read_end > ARRAY_SIZE(b->buf)) && (read_start < ARRAY_SIZE(b->buf))) {
 		size_t copy_cnt = ARRAY_SIZE(b->buf) - read_start;
 
-		memcpy(b_res, &b->buf[read_start],
-		       copy_cnt * sizeof(b->buf[0]));
-		memcpy(b_res + copy_cnt, &b->buf[0],
-		       (len - copy_cnt) * sizeof(b->buf[0]));
+		values_load(b_res, &b->buf[read_start], copy_cnt);
+		values_load(b_res + copy_cnt, &b->buf[0], len - copy_cnt);
 	} else {
 		if (read_start >= ARRAY_SIZE(b->buf)) {
 			read_start -= ARRAY_SIZE(b->buf);
 		}
-		memcpy(b_res, &b->buf[read_start], len * sizeof(b->buf[0]));
+		values_load(b_res, &b->buf[read_start], len);
 	}
 }
 
@@ -210,6 +272,15 @@ static int buf_processing_move(struct data_buffer *b, size_t move,
 
 	size_t max_move = buf_get_collected_data_count(b);
 
+	/* Features of the window part that was already processed are cached by the library.
+	 * If the window is not moved, the whole window must be processed again.
+	 */
+	if (b->window_processed && (move > 0)) {
+		b->new_data_size = MIN(move, INPUT_WINDOW_SIZE);
+	} else {
+		b->new_data_size = INPUT_WINDOW_SIZE;
+	}
+
 	b->process_idx += move;
 	if (b->process_idx >= ARRAY_SIZE(b->buf)) {
 		b->process_idx -= ARRAY_SIZE(b->buf);
@@ -291,6 +362,10 @@ int ei_wrapper_start_prediction(size_t window_shift, size_t frame_shift)
 	size_t sample_shift = window_shift * ei_wrapper_get_window_size() +
 			      frame_shift * ei_wrapper_get_frame_size();
 
+	if (IS_ENABLED(CONFIG_EI_WRAPPER_CONTINUOUS) && (sample_shift % INPUT_SLICE_SIZE)) {
+		return -EINVAL;
+	}
+
 	bool process_buf;
 	int err = buf_processing_move(&ei_input, sample_shift, &process_buf);
 
@@ -303,7 +378,7 @@ int ei_wrapper_start_prediction(size_t window_shift, size_t frame_shift)
 
 static int raw_feature_get_data(size_t offset, size_t length, float *out_ptr)
 {
-	buf_get(&ei_input, out_ptr, offset, length);
+	buf_get(&ei_input, out_ptr, slice_offset + offset, length);
 
 	return 0;
 }
@@ -312,11 +387,53 @@ static void processing_finished(int err)
 {
 	__ASSERT_NO_MSG(user_cb);
 
-	buf_processing_end(&ei_input);
+	buf_processing_end(&ei_input, !err);
 	cur_res_idx = -1;
 	user_cb(err);
 }
 
+#if CONFIG_EI_WRAPPER_CONTINUOUS
+static EI_IMPULSE_ERROR classifier_run(signal_t *features_signal)
+{
+	EI_IMPULSE_ERROR err = EI_IMPULSE_OK;
+	ei_impulse_result_timing_t timing = {};
+
+	__ASSERT_NO_MSG((ei_input.new_data_size > 0) &&
+			(ei_input.new_data_size % INPUT_SLICE_SIZE == 0));
+
+	if (ei_input.new_data_size == INPUT_WINDOW_SIZE) {
+		/* Drop the features cached for the previous window. */
+		run_classifier_init();
+	}
+
+	/* Pass only the slices that were added to the window. Timings are summed up. */
+	for (slice_offset = INPUT_WINDOW_SIZE - ei_input.new_data_size;
+	     slice_offset < INPUT_WINDOW_SIZE;
+	     slice_offset += INPUT_SLICE_SIZE) {
+		err = run_classifier_continuous(features_signal, &ei_result, DEBUG_MODE, false);
+		if (err) {
+			break;
+		}
+
+		timing.sampling += ei_result.timing.sampling;
+		timing.dsp += ei_result.timing.dsp;
+		timing.classification += ei_result.timing.classification;
+		timing.anomaly += ei_result.timing.anomaly;
+	}
+
+	ei_result.timing = timing;
+
+	return err;
+}
+#else
+static EI_IMPULSE_ERROR classifier_run(signal_t *features_signal)
+{
+	slice_offset = 0;
+
+	return run_classifier(features_signal, &ei_result, DEBUG_MODE);
+}
+#endif /* CONFIG_EI_WRAPPER_CONTINUOUS */
+
 static void edge_impulse_thread_fn(void)
 {
 	signal_t features_signal;
@@ -326,15 +443,14 @@ static void edge_impulse_thread_fn(void)
 		k_sem_take(&ei_sem, K_FOREVER);
 
 		features_signal.get_data = &raw_feature_get_data;
-		features_signal.total_length = INPUT_WINDOW_SIZE;
+		features_signal.total_length = INPUT_SLICE_SIZE;
 
 		if (IS_ENABLED(CONFIG_EI_WRAPPER_PROFILING)) {
 			start_time = k_uptime_get();
 		}
 
 		/* Invoke the impulse. */
-		EI_IMPULSE_ERROR err = run_classifier(&features_signal,
-						      &ei_result, DEBUG_MODE);
+		EI_IMPULSE_ERROR err = classifier_run(&features_signal);
 		if (IS_ENABLED(CONFIG_EI_WRAPPER_PROFILING)) {
 			int64_t delta = k_uptime_delta(&start_time);
 
@@ -0,0 +1,463 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#if defined(CONFIG_LOCATION_SERVICE_CLOUD_CACHE_PERSISTENT)
+#include <zephyr/settings/settings.h>
+#include <date_time.h>
+#endif
+
+#include "cloud_cache.h"
+
+LOG_MODULE_DECLARE(location, CONFIG_LOCATION_LOG_LEVEL);
+
+#define CLOUD_CACHE_FP_SIZE CONFIG_LOCATION_SERVICE_CLOUD_CACHE_FINGERPRINT_SIZE
+#define CLOUD_CACHE_TTL_MS ((int64_t)CONFIG_LOCATION_SERVICE_CLOUD_CACHE_TTL * MSEC_PER_SEC)
+
+#define CLOUD_CACHE_SETTINGS_KEY "location_cache"
+#define CLOUD_CACHE_SETTINGS_ENTRIES_KEY "entries"
+/* Incremented whenever the stored format changes, for example the layout of the entries */
+#define CLOUD_CACHE_SETTINGS_VERSION 1
+
+/* Locally administered MAC addresses are typically random and change over time */
+#define CLOUD_CACHE_MAC_LOCAL_BIT 0x02
+
+/** Tags that keep the hashes of different kinds of scan results apart. */
+enum cloud_cache_item {
+	CLOUD_CACHE_ITEM_SERVING_CELL = 1,
+	CLOUD_CACHE_ITEM_NEIGHBOR_CELL,
+	CLOUD_CACHE_ITEM_GCI_CELL,
+	CLOUD_CACHE_ITEM_AP,
+};
+
+/** Fingerprint of the scan results that a location was resolved from. */
+struct cloud_cache_fingerprint {
+	/** Hash of the serving cell, 0 if there is no cell data. */
+	uint32_t serving_cell;
+	/** Whether Wi-Fi access points were used. */
+	bool wifi;
+	/** Number of hashes in items. */
+	uint8_t count;
+	/**
+	 * Smallest hashes of the neighbor cells and access points in ascending order.
+	 * If there are more cells and access points than fit in, the similarity of two
+	 * fingerprints is estimated from this sample.
+	 */
+	uint32_t items[CLOUD_CACHE_FP_SIZE];
+};
+
+enum cloud_cache_entry_state {
+	CLOUD_CACHE_ENTRY_EMPTY,
+	/** Timestamp is the uptime when the entry was stored. */
+	CLOUD_CACHE_ENTRY_VALID,
+	/** Entry has been restored from settings and the timestamp is in UNIX time. */
+	CLOUD_CACHE_ENTRY_RESTORED,
+};
+
+struct cloud_cache_entry {
+	struct cloud_cache_fingerprint fp;
+	double latitude;
+	double longitude;
+	float accuracy;
+	int64_t timestamp;
+	enum cloud_cache_entry_state state;
+};
+
+/* The whole structure is stored to settings */
+static struct cloud_cache {
+	/** Version of the stored format, CLOUD_CACHE_SETTINGS_VERSION. */
+	uint32_t version;
+	struct cloud_cache_entry entries[CONFIG_LOCATION_SERVICE_CLOUD_CACHE_SIZE];
+} cache;
+
+static uint32_t cloud_cache_hash(enum cloud_cache_item tag, const void *data, size_t len)
+{
+	const uint8_t *bytes = data;
+	/* 32-bit FNV-1a */
+	uint32_t hash = (2166136261U ^ tag) * 16777619U;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = (hash ^ bytes[i]) * 16777619U;
+	}
+
+	/* 0 is reserved for a missing serving cell */
+	return hash != 0 ? hash : 1;
+}
+
+static uint32_t cloud_cache_cell_hash(enum cloud_cache_item tag, const struct lte_lc_cell *cell)
+{
+	const uint32_t key[] = { cell->mcc, cell->mnc, cell->tac, cell->id };
+
+	return cloud_cache_hash(tag, key, sizeof(key));
+}
+
+static void cloud_cache_fp_item_add(struct cloud_cache_fingerprint *fp, uint32_t hash)
+{
+	int i;
+
+	for (i = 0; i < fp->count; i++) {
+		if (fp->items[i] == hash) {
+			return;
+		}
+	}
+
+	if (fp->count == CLOUD_CACHE_FP_SIZE) {
+		if (hash > fp->items[fp->count - 1]) {
+			return;
+		}
+		/* Largest hash is dropped */
+		fp->count--;
+	}
+
+	for (i = fp->count; i > 0 && fp->items[i - 1] > hash; i--) {
+		fp->items[i] = fp->items[i - 1];
+	}
+	fp->items[i] = hash;
+	fp->count++;
+}
+
+static void cloud_cache_fp_create(
+	const struct lte_lc_cells_info *cell_data,
+	const struct wifi_scan_info *wifi_data,
+	struct cloud_cache_fingerprint *fp)
+{
+	memset(fp, 0, sizeof(*fp));
+
+	if (cell_data != NULL && cell_data->current_cell.id != LTE_LC_CELL_EUTRAN_ID_INVALID) {
+		fp->serving_cell = cloud_cache_cell_hash(
+			CLOUD_CACHE_ITEM_SERVING_CELL, &cell_data->current_cell);
+
+		for (int i = 0; i < cell_data->ncells_count; i++) {
+			const uint32_t key[] = {
+				cell_data->neighbor_cells[i].earfcn,
+				cell_data->neighbor_cells[i].phys_cell_id
+			};
+
+			cloud_cache_fp_item_add(
+				fp, cloud_cache_hash(CLOUD_CACHE_ITEM_NEIGHBOR_CELL, key, sizeof(key)));
+		}
+
+		for (int i = 0; i < cell_data->gci_cells_count; i++) {
+			cloud_cache_fp_item_add(
+				fp,
+				cloud_cache_cell_hash(CLOUD_CACHE_ITEM_GCI_CELL,
+						      &cell_data->gci_cells[i]));
+		}
+	}
+
+	if (wifi_data != NULL) {
+		for (int i = 0; i < wifi_data->cnt; i++) {
+			const struct wifi_scan_result *ap = &wifi_data->ap_info[i];
+
+			if (ap->mac_length != WIFI_MAC_ADDR_LEN ||
+			    (ap->mac[0] & CLOUD_CACHE_MAC_LOCAL_BIT)) {
+				continue;
+			}
+
+			fp->wifi = true;
+			cloud_cache_fp_item_add(
+				fp, cloud_cache_hash(CLOUD_CACHE_ITEM_AP, ap->mac, WIFI_MAC_ADDR_LEN));
+		}
+	}
+}
+
+static bool cloud_cache_fp_equal(
+	const struct cloud_cache_fingerprint *a,
+	const struct cloud_cache_fingerprint *b)
+{
+	return a->serving_cell == b->serving_cell &&
+	       a->wifi == b->wifi &&
+	       a->count == b->count &&
+	       memcmp(a->items, b->items, a->count * sizeof(a->items[0])) == 0;
+}
+
+/** Returns the Jaccard similarity of the neighbor cells and access points in percent. */
+static int cloud_cache_fp_similarity(
+	const struct cloud_cache_fingerprint *a,
+	const struct cloud_cache_fingerprint *b)
+{
+	int i = 0;
+	int j = 0;
+	int common = 0;
+
+	if (a->count == 0 && b->count == 0) {
+		return 100;
+	}
+
+	while (i < a->count && j < b->count) {
+		if (a->items[i] == b->items[j]) {
+			common++;
+			i++;
+			j++;
+		} else if (a->items[i] < b->items[j]) {
+			i++;
+		} else {
+			j++;
+		}
+	}
+
+	return common * 100 / (a->count + b->count - common);
+}
+
+/** Returns the similarity in percent, or -1 if the location is not usable for fp. */
+static int cloud_cache_entry_match(
+	const struct cloud_cache_entry *entry,
+	const struct cloud_cache_fingerprint *fp,
+	int64_t now)
+{
+	if (entry->state != CLOUD_CACHE_ENTRY_VALID ||
+	    now - entry->timestamp >= CLOUD_CACHE_TTL_MS ||
+	    entry->fp.serving_cell != fp->serving_cell ||
+	    entry->fp.wifi != fp->wifi) {
+		return -1;
+	}
+
+	return cloud_cache_fp_similarity(&entry->fp, fp);
+}
+
+#if defined(CONFIG_LOCATION_SERVICE_CLOUD_CACHE_PERSISTENT)
+static int cloud_cache_settings_set(
+	const char *key,
+	size_t len,
+	settings_read_cb read_cb,
+	void *cb_arg)
+{
+	ssize_t ret;
+
+	if (strcmp(key, CLOUD_CACHE_SETTINGS_ENTRIES_KEY) != 0) {
+		return -ENOENT;
+	}
+
+	if (len != sizeof(cache)) {
+		LOG_WRN("Stored location cache does not match the configuration, ignoring it");
+		return 0;
+	}
+
+	ret = read_cb(cb_arg, &cache, sizeof(cache));
+	if (ret < 0) {
+		LOG_ERR("Failed to read location cache, error: %d", (int)ret);
+		memset(&cache, 0, sizeof(cache));
+		return ret;
+	}
+
+	if (cache.version != CLOUD_CACHE_SETTINGS_VERSION) {
+		LOG_WRN("Stored location cache has version %u, ignoring it", cache.version);
+		memset(&cache, 0, sizeof(cache));
+		return 0;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(cache.entries); i++) {
+		if (cache.entries[i].state != CLOUD_CACHE_ENTRY_EMPTY) {
+			cache.entries[i].state = CLOUD_CACHE_ENTRY_RESTORED;
+		}
+	}
+
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(location_cache, CLOUD_CACHE_SETTINGS_KEY, NULL,
+			       cloud_cache_settings_set, NULL, NULL);
+
+/** Converts the timestamps of the restored entries to uptime once the current time is known. */
+static void cloud_cache_restored_convert(void)
+{
+	int64_t unix_time_ms;
+	int64_t uptime = k_uptime_get();
+
+	if (date_time_now(&unix_time_ms) != 0) {
+		return;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(cache.entries); i++) {
+		if (cache.entries[i].state == CLOUD_CACHE_ENTRY_RESTORED) {
+			cache.entries[i].timestamp = uptime - (unix_time_ms - cache.entries[i].timestamp);
+			cache.entries[i].state = CLOUD_CACHE_ENTRY_VALID;
+		}
+	}
+}
+
+static void cloud_cache_save(void)
+{
+	int err;
+	int64_t unix_time_ms;
+	int64_t uptime = k_uptime_get();
+
+	if (date_time_now(&unix_time_ms) != 0) {
+		LOG_DBG("Current time not known, location cache not stored");
+		return;
+	}
+
+	/* Timestamps are stored in UNIX time so that they remain valid over a reboot */
+	for (int i = 0; i < ARRAY_SIZE(cache.entries); i++) {
+		if (cache.entries[i].state == CLOUD_CACHE_ENTRY_VALID) {
+			cache.entries[i].timestamp = unix_time_ms - (uptime - cache.entries[i].timestamp);
+		}
+	}
+
+	cache.version = CLOUD_CACHE_SETTINGS_VERSION;
+	err = settings_save_one(CLOUD_CACHE_SETTINGS_KEY "/" CLOUD_CACHE_SETTINGS_ENTRIES_KEY,
+				&cache, sizeof(cache));
+	if (err) {
+		LOG_ERR("Failed to store location cache, error: %d", err);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(cache.entries); i++) {
+		if (cache.entries[i].state == CLOUD_CACHE_ENTRY_VALID) {
+			cache.entries[i].timestamp = uptime - (unix_time_ms - cache.entries[i].timestamp);
+		}
+	}
+}
+#endif /* CONFIG_LOCATION_SERVICE_CLOUD_CACHE_PERSISTENT */
+
+int cloud_cache_get(
+	const struct lte_lc_cells_info *cell_data,
+	const struct wifi_scan_info *wifi_data,
+	struct location_data *location)
+{
+	struct cloud_cache_fingerprint fp;
+	const struct cloud_cache_entry *best = NULL;
+	int best_similarity = -1;
+	int similarity;
+	int64_t now = k_uptime_get();
+
+	__ASSERT_NO_MSG(location != NULL);
+
+	cloud_cache_fp_create(cell_data, wifi_data, &fp);
+	if (fp.serving_cell == 0 && !fp.wifi) {
+		return -ENOENT;
+	}
+
+#if defined(CONFIG_LOCATION_SERVICE_CLOUD_CACHE_PERSISTENT)
+	cloud_cache_restored_convert();
+#endif
+
+	for (int i = 0; i < ARRAY_SIZE(cache.entries); i++) {
+		similarity = cloud_cache_entry_match(&cache.entries[i], &fp, now);
+		if (similarity < CONFIG_LOCATION_SERVICE_CLOUD_CACHE_SIMILARITY) {
+			continue;
+		}
+
+		/* The most similar and then the most recent location is used */
+		if (similarity > best_similarity ||
+		    (similarity == best_similarity && cache.entries[i].timestamp > best->timestamp)) {
+			best = &cache.entries[i];
+			best_similarity = similarity;
+		}
+	}
+
+	if (best == NULL) {
+		LOG_DBG("No matching location in cache");
+		return -ENOENT;
+	}
+
+	LOG_DBG("Location found in cache, similarity %d%%, age %llds",
+		best_similarity, (now - best->timestamp) / MSEC_PER_SEC);
+
+	location->latitude = best->latitude;
+	location->longitude = best->longitude;
+	location->accuracy = best->accuracy;
+
+	return 0;
+}
+
+void cloud_cache_add(
+	const struct lte_lc_cells_info *cell_data,
+	const struct wifi_scan_info *wifi_data,
+	const struct location_data *location)
+{
+	struct cloud_cache_fingerprint fp;
+	struct cloud_cache_entry *entry = NULL;
+	bool changed = true;
+	int64_t now = k_uptime_get();
+
+	__ASSERT_NO_MSG(location != NULL);
+
+	cloud_cache_fp_create(cell_data, wifi_data, &fp);
+	if (fp.serving_cell == 0 && !fp.wifi) {
+		return;
+	}
+
+#if defined(CONFIG_LOCATION_SERVICE_CLOUD_CACHE_PERSISTENT)
+	cloud_cache_restored_convert();
+#endif
+
+	/* Replace a location for a similar environment, an unused or expired entry,
+	 * or the oldest location, in this order.
+	 */
+	for (int i = 0; i < ARRAY_SIZE(cache.entries); i++) {
+		if (cloud_cache_entry_match(&cache.entries[i], &fp, now) >=
+		    CONFIG_LOCATION_SERVICE_CLOUD_CACHE_SIMILARITY) {
+			entry = &cache.entries[i];
+			break;
+		}
+	}
+
+	for (int i = 0; entry == NULL && i < ARRAY_SIZE(cache.entries); i++) {
+		if (cache.entries[i].state != CLOUD_CACHE_ENTRY_VALID ||
+		    now - cache.entries[i].timestamp >= CLOUD_CACHE_TTL_MS) {
+			entry = &cache.entries[i];
+		}
+	}
+
+	if (entry == NULL) {
+		entry = &cache.entries[0];
+		for (int i = 1; i < ARRAY_SIZE(cache.entries); i++) {
+			if (cache.entries[i].timestamp < entry->timestamp) {
+				entry = &cache.entries[i];
+			}
+		}
+	}
+
+	if (entry->state == CLOUD_CACHE_ENTRY_VALID) {
+		changed = !cloud_cache_fp_equal(&entry->fp, &fp) ||
+			  entry->latitude != location->latitude ||
+			  entry->longitude != location->longitude ||
+			  entry->accuracy != location->accuracy;
+	}
+
+	entry->fp = fp;
+	entry->latitude = location->latitude;
+	entry->longitude = location->longitude;
+	entry->accuracy = location->accuracy;
+	entry->timestamp = now;
+	entry->state = CLOUD_CACHE_ENTRY_VALID;
+
+	LOG_DBG("Location stored in cache, %d neighbor cells and access points", fp.count);
+
+#if defined(CONFIG_LOCATION_SERVICE_CLOUD_CACHE_PERSISTENT)
+	/* Flash is written only for a new or changed location, not for a refreshed timestamp */
+	if (changed) {
+		cloud_cache_save();
+	}
+#else
+	ARG_UNUSED(changed);
+#endif
+}
+
+int cloud_cache_init(void)
+{
+	memset(&cache, 0, sizeof(cache));
+
+#if defined(CONFIG_LOCATION_SERVICE_CLOUD_CACHE_PERSISTENT)
+	int err;
+
+	err = settings_subsys_init();
+	if (err) {
+		LOG_ERR("Failed to initialize settings subsystem, error: %d", err);
+		return err;
+	}
+
+	/* Cache is only an optimization, so the library is usable even if loading fails */
+	err = settings_load_subtree(CLOUD_CACHE_SETTINGS_KEY);
+	if (err) {
+		LOG_WRN("Failed to load location cache, error: %d", err);
+	}
+#endif
+
+	return 0;
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef CLOUD_CACHE_H_
+#define CLOUD_CACHE_H_
+
+#include <modem/location.h>
+#include <modem/lte_lc.h>
+#include <net/wifi_location_common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initialize the cloud location cache.
+ *
+ * Restores the cached locations from settings if
+ * CONFIG_LOCATION_SERVICE_CLOUD_CACHE_PERSISTENT is enabled.
+ *
+ * @return 0 on success, or negative error code on failure.
+ */
+int cloud_cache_init(void);
+
+/**
+ * @brief Find a cached location for the given scan results.
+ *
+ * A location matches if it has been resolved from the same kind of scan results,
+ * with the same serving cell, within CONFIG_LOCATION_SERVICE_CLOUD_CACHE_TTL
+ * and the neighbor cells and access points are similar enough.
+ *
+ * @param[in] cell_data Neighbor cell data, or NULL.
+ * @param[in] wifi_data Wi-Fi scanning results, or NULL.
+ * @param[out] location Cached location.
+ *
+ * @retval 0 Location found.
+ * @retval -ENOENT No matching location in the cache.
+ */
+int cloud_cache_get(
+	const struct lte_lc_cells_info *cell_data,
+	const struct wifi_scan_info *wifi_data,
+	struct location_data *location);
+
+/**
+ * @brief Store a location resolved by the cloud service for the given scan results.
+ *
+ * @param[in] cell_data Neighbor cell data, or NULL.
+ * @param[in] wifi_data Wi-Fi scanning results, or NULL.
+ * @param[in] location Location from the cloud service.
+ */
+void cloud_cache_add(
+	const struct lte_lc_cells_info *cell_data,
+	const struct wifi_scan_info *wifi_data,
+	const struct location_data *location);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CLOUD_CACHE_H_ */
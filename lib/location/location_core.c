@@ -40,6 +40,17 @@ K_THREAD_STACK_DEFINE(location_core_stack, LOCATION_CORE_STACK_SIZE);
 /** Work queue for location library. Location methods can run their tasks in it. */
 static struct k_work_q location_core_work_q;
 
+#if defined(CONFIG_LOCATION_CONCURRENT_MODE)
+#define LOCATION_CORE_CONCURRENT_STACK_SIZE CONFIG_LOCATION_CONCURRENT_WORKQUEUE_STACK_SIZE
+K_THREAD_STACK_DEFINE(location_core_concurrent_stack, LOCATION_CORE_CONCURRENT_STACK_SIZE);
+
+/**
+ * Work queue for the cloud location method in LOCATION_REQ_MODE_CONCURRENT so that
+ * the blocking scans and cloud request do not delay GNSS in location_core_work_q.
+ */
+static struct k_work_q location_core_concurrent_work_q;
+#endif
+
 /** Handler for periodic location requests. */
 static void location_core_periodic_work_fn(struct k_work *work);
 
@@ -178,6 +189,24 @@ static const struct location_method_api *location_method_api_get(enum location_m
 	return method_api;
 }
 
+static int location_core_method_index_get(enum location_method method)
+{
+	for (int i = 0; i < loc_req_info.methods_count; i++) {
+		if (loc_req_info.methods[i] == method) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+static bool location_core_concurrent_is_running(enum location_method method)
+{
+	int index = location_core_method_index_get(method);
+
+	return index >= 0 && atomic_test_bit(&loc_req_info.concurrent_running, index);
+}
+
 #if defined(CONFIG_LOG)
 
 static const char LOCATION_ACCURACY_LOW_STR[] = "low";
@@ -240,6 +269,16 @@ int location_core_init(void)
 		LOCATION_CORE_PRIORITY,
 		&cfg);
 
+#if defined(CONFIG_LOCATION_CONCURRENT_MODE)
+	cfg.name = "location_api_concurrent_workq";
+	k_work_queue_start(
+		&location_core_concurrent_work_q,
+		location_core_concurrent_stack,
+		K_THREAD_STACK_SIZEOF(location_core_concurrent_stack),
+		LOCATION_CORE_PRIORITY,
+		&cfg);
+#endif
+
 	return 0;
 }
 
@@ -255,6 +294,12 @@ int location_core_validate_params(const struct location_config *config)
 		return -EINVAL;
 	}
 
+	if (config->mode == LOCATION_REQ_MODE_CONCURRENT &&
+	    !IS_ENABLED(CONFIG_LOCATION_CONCURRENT_MODE)) {
+		LOG_ERR("LOCATION_REQ_MODE_CONCURRENT requires CONFIG_LOCATION_CONCURRENT_MODE");
+		return -EINVAL;
+	}
+
 	for (int i = 0; i < config->methods_count; i++) {
 		if (config->methods[i].method == LOCATION_METHOD_WIFI_CELLULAR) {
 			LOG_ERR("LOCATION_METHOD_WIFI_CELLULAR cannot be given in location config");
@@ -325,6 +370,81 @@ static void location_core_current_config_set(const struct location_config *confi
 	memcpy(&loc_req_info.config, config, sizeof(loc_req_info.config));
 }
 
+static void location_core_started_event_dispatch(enum location_method method)
+{
+	if (IS_ENABLED(CONFIG_LOCATION_DATA_DETAILS)) {
+		struct location_event_data request_started = {
+			.id = LOCATION_EVT_STARTED,
+			.method = method
+		};
+
+		location_utils_event_dispatch(&request_started);
+	}
+}
+
+/** Cancels the methods that are still running in LOCATION_REQ_MODE_CONCURRENT. */
+static int location_core_concurrent_cancel(void)
+{
+	int err = 0;
+	int ret;
+
+	for (int i = 0; i < loc_req_info.methods_count; i++) {
+		if (!atomic_test_and_clear_bit(&loc_req_info.concurrent_running, i)) {
+			continue;
+		}
+
+		LOG_DBG("Cancelling location method for '%s' method",
+			(char *)location_method_api_get(loc_req_info.methods[i])->method_string);
+
+		ret = location_method_api_get(loc_req_info.methods[i])->cancel();
+		if (ret != 0 && ret != -EPERM) {
+			err = ret;
+		}
+	}
+
+	atomic_clear(&loc_req_info.concurrent_reported);
+
+	return err;
+}
+
+/** Starts all methods at once in LOCATION_REQ_MODE_CONCURRENT. */
+static int location_core_concurrent_location_get(void)
+{
+	int err;
+	enum location_method requested_method;
+
+	location_core_current_event_data_init(loc_req_info.methods[0]);
+	atomic_clear(&loc_req_info.concurrent_running);
+	atomic_clear(&loc_req_info.concurrent_reported);
+
+	for (int i = 0; i < loc_req_info.methods_count; i++) {
+		requested_method = loc_req_info.methods[i];
+		LOG_DBG("Requesting location with '%s' method concurrently",
+			(char *)location_method_api_get(requested_method)->method_string);
+
+		memset(&loc_req_info.concurrent_event_data[i], 0,
+		       sizeof(loc_req_info.concurrent_event_data[i]));
+		atomic_set_bit(&loc_req_info.concurrent_running, i);
+
+		/* Cloud location method selects the scans based on the current method */
+		loc_req_info.current_method = requested_method;
+		err = location_method_api_get(requested_method)->location_get(&loc_req_info);
+		if (err != 0) {
+			atomic_clear_bit(&loc_req_info.concurrent_running, i);
+			(void)location_core_concurrent_cancel();
+			loc_req_info.current_method = loc_req_info.methods[0];
+			return err;
+		}
+
+		location_core_started_event_dispatch(requested_method);
+	}
+
+	/* The highest priority method is reported if none of the methods gives a result */
+	loc_req_info.current_method = loc_req_info.methods[0];
+
+	return 0;
+}
+
 static int location_core_location_get_pos(void)
 {
 	int err;
@@ -336,23 +456,24 @@ static int location_core_location_get_pos(void)
 		k_uptime_get() + loc_req_info.config.timeout : SYS_FOREVER_MS;
 	loc_req_info.execute_fallback = true;
 	loc_req_info.current_method_index = 0;
-	requested_method = loc_req_info.methods[loc_req_info.current_method_index];
-	LOG_DBG("Requesting location with '%s' method",
-		(char *)location_method_api_get(requested_method)->method_string);
-	location_core_current_event_data_init(requested_method);
 
-	err = location_method_api_get(requested_method)->location_get(&loc_req_info);
-	if (err != 0) {
-		return err;
-	}
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		err = location_core_concurrent_location_get();
+		if (err != 0) {
+			return err;
+		}
+	} else {
+		requested_method = loc_req_info.methods[loc_req_info.current_method_index];
+		LOG_DBG("Requesting location with '%s' method",
+			(char *)location_method_api_get(requested_method)->method_string);
+		location_core_current_event_data_init(requested_method);
 
-	if (IS_ENABLED(CONFIG_LOCATION_DATA_DETAILS)) {
-		struct location_event_data request_started = {
-			.id = LOCATION_EVT_STARTED,
-			.method = requested_method
-		};
+		err = location_method_api_get(requested_method)->location_get(&loc_req_info);
+		if (err != 0) {
+			return err;
+		}
 
-		location_utils_event_dispatch(&request_started);
+		location_core_started_event_dispatch(requested_method);
 	}
 
 	if (loc_req_info.config.timeout != SYS_FOREVER_MS &&
@@ -403,6 +524,9 @@ static void location_request_info_create(const struct location_config *config)
 			LOG_DBG("Wi-Fi and cellular methods are not one after the other "
 				"in method list so they are not combined");
 		}
+	} else if (loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		/* Wi-Fi and cellular are always combined into a single cloud request */
+		combine_wifi_cell = loc_req_info.cellular != NULL && loc_req_info.wifi != NULL;
 	}
 
 	/* Compose a list of methods that are really used, including combined internal method */
@@ -461,18 +585,57 @@ int location_core_location_get(const struct location_config *config)
 	return location_core_location_get_pos();
 }
 
-void location_core_event_cb_error(void)
+/** Stores the result of a method running in LOCATION_REQ_MODE_CONCURRENT. */
+static void location_core_concurrent_event_set(
+	enum location_method method,
+	enum location_event_id id,
+	const struct location_data *location)
+{
+	struct location_event_data *event_data;
+	int index = location_core_method_index_get(method);
+
+	if (index < 0 || !atomic_test_bit(&loc_req_info.concurrent_running, index)) {
+		LOG_DBG("Ignoring event %d from '%s' method that is not running",
+			id, (char *)location_method_api_get(method)->method_string);
+		return;
+	}
+
+	event_data = &loc_req_info.concurrent_event_data[index];
+	event_data->id = id;
+	event_data->method = method;
+	if (location) {
+		event_data->location = *location;
+	}
+
+	atomic_set_bit(&loc_req_info.concurrent_reported, index);
+
+	k_work_submit_to_queue(
+		location_core_work_queue_get(),
+		&location_event_cb_work);
+}
+
+void location_core_event_cb_error(enum location_method method)
 {
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		location_core_concurrent_event_set(method, LOCATION_EVT_ERROR, NULL);
+		return;
+	}
+
 	loc_req_info.current_event_data.id = LOCATION_EVT_ERROR;
 
-	location_core_event_cb(NULL);
+	location_core_event_cb(method, NULL);
 }
 
-void location_core_event_cb_timeout(void)
+void location_core_event_cb_timeout(enum location_method method)
 {
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		location_core_concurrent_event_set(method, LOCATION_EVT_TIMEOUT, NULL);
+		return;
+	}
+
 	loc_req_info.current_event_data.id = LOCATION_EVT_TIMEOUT;
 
-	location_core_event_cb(NULL);
+	location_core_event_cb(method, NULL);
 }
 
 #if defined(CONFIG_LOCATION_SERVICE_EXTERNAL) && defined(CONFIG_NRF_CLOUD_AGNSS)
@@ -510,18 +673,23 @@ void location_core_event_cb_pgps_request(const struct gps_pgps_request *request)
 #endif
 
 #if defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
-void location_core_event_cb_cloud_location_request(struct location_data_cloud *request)
+void location_core_event_cb_cloud_location_request(enum location_method method,
+						   struct location_data_cloud *request)
 {
 	struct location_event_data cloud_location_request_event_data = { 0 };
 
 	cloud_location_request_event_data.id = LOCATION_EVT_CLOUD_LOCATION_EXT_REQUEST;
+	cloud_location_request_event_data.method = method;
 
 #if defined(CONFIG_LOCATION_METHOD_CELLULAR) && defined(CONFIG_LOCATION_METHOD_WIFI)
-	/* For external service, we always determine Wi-Fi is used although it could be cellular */
-	cloud_location_request_event_data.method =
-		(request->wifi_data != NULL) ? LOCATION_METHOD_WIFI : LOCATION_METHOD_CELLULAR;
-#else
-	cloud_location_request_event_data.method = loc_req_info.current_method;
+	if (method == LOCATION_METHOD_WIFI_CELLULAR) {
+		/* For external service, we always determine Wi-Fi is used although it could be
+		 * cellular
+		 */
+		cloud_location_request_event_data.method =
+			(request->wifi_data != NULL) ? LOCATION_METHOD_WIFI
+						     : LOCATION_METHOD_CELLULAR;
+	}
 #endif
 	loc_req_info.current_event_data.method = cloud_location_request_event_data.method;
 
@@ -545,12 +713,32 @@ static bool location_core_is_cloud_method(int method)
 	return false;
 }
 
+/** Returns the cloud method running in LOCATION_REQ_MODE_CONCURRENT, or 0 if there is none. */
+static enum location_method location_core_concurrent_cloud_method_get(void)
+{
+	for (int i = 0; i < loc_req_info.methods_count; i++) {
+		if (location_core_is_cloud_method(loc_req_info.methods[i]) &&
+		    atomic_test_bit(&loc_req_info.concurrent_running, i)) {
+			return loc_req_info.methods[i];
+		}
+	}
+
+	return 0;
+}
+
 void location_core_cloud_location_ext_result_set(
 	enum location_ext_result result,
 	struct location_data *location)
 {
+	enum location_event_id id;
+	enum location_method cloud_method = loc_req_info.current_method;
+
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		cloud_method = location_core_concurrent_cloud_method_get();
+	}
+
 	if (k_sem_count_get(&location_core_sem) > 0 ||
-	    !location_core_is_cloud_method(loc_req_info.current_method)) {
+	    !location_core_is_cloud_method(cloud_method)) {
 		LOG_WRN("Cloud positioning result set called but no "
 			"cloud location request pending");
 		return;
@@ -562,18 +750,28 @@ void location_core_cloud_location_ext_result_set(
 
 	switch (result) {
 	case LOCATION_EXT_RESULT_SUCCESS:
-		loc_req_info.current_event_data.id = LOCATION_EVT_LOCATION;
-		loc_req_info.current_event_data.location = *location;
+		id = LOCATION_EVT_LOCATION;
 		break;
 	case LOCATION_EXT_RESULT_UNKNOWN:
-		loc_req_info.current_event_data.id = LOCATION_EVT_RESULT_UNKNOWN;
+		id = LOCATION_EVT_RESULT_UNKNOWN;
 		break;
 	case LOCATION_EXT_RESULT_ERROR:
 	default:
-		loc_req_info.current_event_data.id = LOCATION_EVT_ERROR;
+		id = LOCATION_EVT_ERROR;
 		break;
 	}
 
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		location_core_concurrent_event_set(
+			cloud_method, id, (id == LOCATION_EVT_LOCATION) ? location : NULL);
+		return;
+	}
+
+	loc_req_info.current_event_data.id = id;
+	if (id == LOCATION_EVT_LOCATION) {
+		loc_req_info.current_event_data.location = *location;
+	}
+
 	k_work_submit_to_queue(
 		location_core_work_queue_get(),
 		&location_event_cb_work);
@@ -601,6 +799,78 @@ static void location_core_event_details_get(struct location_event_data *event)
 #endif
 }
 
+static bool location_core_concurrent_accuracy_met(const struct location_event_data *event_data)
+{
+	return event_data->id == LOCATION_EVT_LOCATION &&
+	       (loc_req_info.config.accuracy_target == 0 ||
+		event_data->location.accuracy <= loc_req_info.config.accuracy_target);
+}
+
+/**
+ * Processes the results of the methods running in LOCATION_REQ_MODE_CONCURRENT.
+ *
+ * The most accurate location so far, or the latest failure if there is no location,
+ * is kept in loc_req_info.current_event_data.
+ *
+ * @return true if the location request is completed, false if waiting for more results.
+ */
+static bool location_core_concurrent_event_process(void)
+{
+	struct location_event_data *event_data;
+	struct location_event_data *result = &loc_req_info.current_event_data;
+	bool processed = false;
+
+	for (int i = 0; i < loc_req_info.methods_count; i++) {
+		if (!atomic_test_and_clear_bit(&loc_req_info.concurrent_reported, i) ||
+		    !atomic_test_and_clear_bit(&loc_req_info.concurrent_running, i)) {
+			continue;
+		}
+
+		processed = true;
+		event_data = &loc_req_info.concurrent_event_data[i];
+
+		if (event_data->method == loc_req_info.timer_method) {
+			k_work_cancel_delayable(&location_core_method_timeout_work);
+		}
+
+		LOG_DBG("Method '%s' completed with event %d",
+			(char *)location_method_api_get(event_data->method)->method_string,
+			event_data->id);
+
+		if (event_data->id == LOCATION_EVT_LOCATION) {
+			if (result->id != LOCATION_EVT_LOCATION ||
+			    event_data->location.accuracy < result->location.accuracy) {
+				*result = *event_data;
+				loc_req_info.current_method = event_data->method;
+			}
+		} else if (result->id != LOCATION_EVT_LOCATION) {
+			*result = *event_data;
+			loc_req_info.current_method = event_data->method;
+		}
+	}
+
+	if (location_core_concurrent_accuracy_met(result)) {
+		if (atomic_get(&loc_req_info.concurrent_running) != 0) {
+			LOG_INF("LOCATION_REQ_MODE_CONCURRENT: accuracy target met using '%s', "
+				"cancelling other methods",
+				(char *)location_method_api_get(
+					loc_req_info.current_method)->method_string);
+			(void)location_core_concurrent_cancel();
+		}
+		return true;
+	}
+
+	if (!loc_req_info.execute_fallback) {
+		/* Location request timeout expired and the methods have been cancelled */
+		if (result->id != LOCATION_EVT_LOCATION) {
+			result->id = LOCATION_EVT_TIMEOUT;
+		}
+		return true;
+	}
+
+	return processed && atomic_get(&loc_req_info.concurrent_running) == 0;
+}
+
 static void location_core_event_cb_fn(struct k_work *work)
 {
 	char latitude_str[12];
@@ -609,6 +879,12 @@ static void location_core_event_cb_fn(struct k_work *work)
 	enum location_method requested_method;
 	int err;
 
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT &&
+	    !location_core_concurrent_event_process()) {
+		/* Waiting for the other methods */
+		return;
+	}
+
 	k_work_cancel_delayable(&location_core_method_timeout_work);
 	loc_req_info.current_event_data.method = loc_req_info.current_method;
 
@@ -677,7 +953,8 @@ static void location_core_event_cb_fn(struct k_work *work)
 			 */
 			loc_req_info.current_method_index = 0;
 		}
-	} else if (loc_req_info.execute_fallback) {
+	} else if (loc_req_info.execute_fallback &&
+		   loc_req_info.config.mode != LOCATION_REQ_MODE_CONCURRENT) {
 		/* Get possible next method to be run */
 		loc_req_info.current_method_index++;
 		if (loc_req_info.current_method_index < loc_req_info.methods_count) {
@@ -742,8 +1019,15 @@ static void location_core_event_cb_fn(struct k_work *work)
 	}
 }
 
-void location_core_event_cb(const struct location_data *location)
+void location_core_event_cb(enum location_method method, const struct location_data *location)
 {
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		if (location) {
+			location_core_concurrent_event_set(method, LOCATION_EVT_LOCATION, location);
+		}
+		return;
+	}
+
 	if (location) {
 		loc_req_info.current_event_data.id = LOCATION_EVT_LOCATION;
 		loc_req_info.current_event_data.location = *location;
@@ -765,6 +1049,13 @@ struct k_work_q *location_core_work_queue_get(void)
 	return &location_core_work_q;
 }
 
+#if defined(CONFIG_LOCATION_CONCURRENT_MODE)
+struct k_work_q *location_core_concurrent_work_queue_get(void)
+{
+	return &location_core_concurrent_work_q;
+}
+#endif
+
 static void location_core_periodic_work_fn(struct k_work *work)
 {
 	ARG_UNUSED(work);
@@ -773,15 +1064,19 @@ static void location_core_periodic_work_fn(struct k_work *work)
 
 static void location_core_method_timeout_work_fn(struct k_work *work)
 {
-	enum location_method current_method =
-		loc_req_info.methods[loc_req_info.current_method_index];
+	enum location_method timer_method = loc_req_info.timer_method;
 
 	ARG_UNUSED(work);
 
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT &&
+	    !location_core_concurrent_is_running(timer_method)) {
+		return;
+	}
+
 	LOG_INF("Method specific timeout expired");
 
-	location_method_api_get(current_method)->timeout();
-	location_core_event_cb_timeout();
+	location_method_api_get(timer_method)->timeout();
+	location_core_event_cb_timeout(timer_method);
 }
 
 static void location_core_timeout_work_fn(struct k_work *work)
@@ -793,20 +1088,38 @@ static void location_core_timeout_work_fn(struct k_work *work)
 
 	LOG_INF("Timeout for entire location request expired");
 
+	if (loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		/* The best location so far is returned if there is one */
+		loc_req_info.execute_fallback = false;
+
+		for (int i = 0; i < loc_req_info.methods_count; i++) {
+			if (atomic_test_and_clear_bit(&loc_req_info.concurrent_running, i)) {
+				location_method_api_get(loc_req_info.methods[i])->timeout();
+			}
+		}
+
+		k_work_submit_to_queue(
+			location_core_work_queue_get(),
+			&location_event_cb_work);
+		return;
+	}
+
 	location_method_api_get(current_method)->timeout();
 	/* config->timeout needs to expire without fallbacks */
 
 	loc_req_info.current_event_data.id = LOCATION_EVT_TIMEOUT;
 	loc_req_info.execute_fallback = false;
 
-	location_core_event_cb(NULL);
+	location_core_event_cb(current_method, NULL);
 }
 
-void location_core_timer_start(int32_t timeout)
+void location_core_timer_start(enum location_method method, int32_t timeout)
 {
 	if (timeout != SYS_FOREVER_MS && timeout > 0) {
 		LOG_DBG("Starting timer with timeout=%d", timeout);
 
+		loc_req_info.timer_method = method;
+
 		/* Using different work queue that the actual methods are using.
 		 * In this case using system work queue while methods use location_core_work_q.
 		 * If timeout is handled in the same work queue as the methods use for
@@ -830,9 +1143,13 @@ int location_core_cancel(void)
 
 	/* Check if location has been requested using one of the methods */
 	if (current_method != 0) {
-		LOG_DBG("Cancelling location method for '%s' method",
-			(char *)location_method_api_get(current_method)->method_string);
-		err = location_method_api_get(current_method)->cancel();
+		if (loc_req_info.config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+			err = location_core_concurrent_cancel();
+		} else {
+			LOG_DBG("Cancelling location method for '%s' method",
+				(char *)location_method_api_get(current_method)->method_string);
+			err = location_method_api_get(current_method)->cancel();
+		}
 
 		/* -EPERM means method wasn't running and this is converted to no error.
 		 * This is normal in periodic mode.
@@ -38,6 +38,21 @@ struct location_request_info {
 	/** Uptime at the start of the positioning for the current method. */
 	int64_t elapsed_time_method_start_timestamp;
 
+	/** Method that started the method specific timer. */
+	enum location_method timer_method;
+
+	/**
+	 * Bitmask of the indices to the methods that are running in
+	 * LOCATION_REQ_MODE_CONCURRENT and have not been cancelled or processed their result.
+	 */
+	atomic_t concurrent_running;
+
+	/** Bitmask of the indices to the methods whose result has not been processed yet. */
+	atomic_t concurrent_reported;
+
+	/** Results of the methods running in LOCATION_REQ_MODE_CONCURRENT. */
+	struct location_event_data concurrent_event_data[CONFIG_LOCATION_METHODS_LIST_SIZE];
+
 	/**
 	 * Device uptime when location request timer expires.
 	 * This is used in cloud location method to calculate timeout for the cloud operation.
@@ -63,9 +78,9 @@ int location_core_validate_params(const struct location_config *config);
 int location_core_location_get(const struct location_config *config);
 int location_core_cancel(void);
 
-void location_core_event_cb(const struct location_data *location);
-void location_core_event_cb_error(void);
-void location_core_event_cb_timeout(void);
+void location_core_event_cb(enum location_method method, const struct location_data *location);
+void location_core_event_cb_error(enum location_method method);
+void location_core_event_cb_timeout(enum location_method method);
 #if defined(CONFIG_LOCATION_SERVICE_EXTERNAL) && defined(CONFIG_NRF_CLOUD_AGNSS)
 void location_core_event_cb_agnss_request(const struct nrf_modem_gnss_agnss_data_frame *request);
 #endif
@@ -74,14 +89,18 @@ void location_core_event_cb_pgps_request(const struct gps_pgps_request *request)
 #endif
 
 #if defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
-void location_core_event_cb_cloud_location_request(struct location_data_cloud *request);
+void location_core_event_cb_cloud_location_request(enum location_method method,
+						   struct location_data_cloud *request);
 void location_core_cloud_location_ext_result_set(
 	enum location_ext_result result,
 	struct location_data *location);
 #endif
 
 void location_core_config_log(const struct location_config *config);
-void location_core_timer_start(int32_t timeout);
+void location_core_timer_start(enum location_method method, int32_t timeout);
 struct k_work_q *location_core_work_queue_get(void);
+#if defined(CONFIG_LOCATION_CONCURRENT_MODE)
+struct k_work_q *location_core_concurrent_work_queue_get(void);
+#endif
 
 #endif /* LOCATION_CORE_H */
@@ -16,6 +16,9 @@
 #include "scan_cellular.h"
 #include "scan_wifi.h"
 #include "cloud_service.h"
+#if defined(CONFIG_LOCATION_SERVICE_CLOUD_CACHE)
+#include "cloud_cache.h"
+#endif
 
 LOG_MODULE_DECLARE(location, CONFIG_LOCATION_LOG_LEVEL);
 
@@ -38,6 +41,7 @@ struct method_cloud_location_start_work_args {
 	const struct location_wifi_config *wifi_config;
 	const struct location_cellular_config *cell_config;
 	int64_t locreq_timeout_uptime;
+	enum location_method method;
 };
 
 static struct method_cloud_location_start_work_args method_cloud_location_start_work;
@@ -103,7 +107,7 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 #endif
 	};
 
-	location_core_event_cb_cloud_location_request(&request);
+	location_core_event_cb_cloud_location_request(work_data->method, &request);
 	return;
 #else
 	struct location_data location;
@@ -114,6 +118,17 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 		.timeout_ms = SYS_FOREVER_MS
 	};
 
+#if defined(CONFIG_LOCATION_SERVICE_CLOUD_CACHE)
+	/* Location resolved earlier for a similar environment is used without a cloud request.
+	 * This also works when LTE is not available.
+	 */
+	if (cloud_cache_get(scan_cellular_info, scan_wifi_info, &location_result) == 0) {
+		location_utils_systime_to_location_datetime(&location_result.datetime);
+		location_core_event_cb(work_data->method, &location_result);
+		return;
+	}
+#endif
+
 	if (IS_ENABLED(CONFIG_LOCATION_METHOD_CELLULAR) && !location_utils_is_lte_available()) {
 		/* Not worth to start trying to fetch the location over LTE.
 		 * Thus, fail faster in this case and save the trying "costs".
@@ -146,16 +161,19 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 		location_result.latitude = location.latitude;
 		location_result.longitude = location.longitude;
 		location_result.accuracy = location.accuracy;
-		location_core_event_cb(&location_result);
+#if defined(CONFIG_LOCATION_SERVICE_CLOUD_CACHE)
+		cloud_cache_add(scan_cellular_info, scan_wifi_info, &location_result);
+#endif
+		location_core_event_cb(work_data->method, &location_result);
 	}
 
 #endif /* defined(CONFIG_LOCATION_SERVICE_EXTERNAL) */
 
 end:
 	if (err == -ETIMEDOUT) {
-		location_core_event_cb_timeout();
+		location_core_event_cb_timeout(work_data->method);
 	} else if (err) {
-		location_core_event_cb_error();
+		location_core_event_cb_error(work_data->method);
 	}
 	running = false;
 }
@@ -180,6 +198,8 @@ int method_cloud_location_cancel(void)
 
 int method_cloud_location_get(const struct location_request_info *request)
 {
+	struct k_work_q *work_q = location_core_work_queue_get();
+
 	__ASSERT_NO_MSG(request->cellular != NULL || request->wifi != NULL);
 
 	k_work_init(
@@ -199,12 +219,17 @@ int method_cloud_location_get(const struct location_request_info *request)
 	}
 
 	method_cloud_location_start_work.locreq_timeout_uptime = request->timeout_uptime;
-	k_work_submit_to_queue(
-		location_core_work_queue_get(),
-		&method_cloud_location_start_work.work_item);
-
+	method_cloud_location_start_work.method = request->current_method;
+#if defined(CONFIG_LOCATION_CONCURRENT_MODE)
+	/* Scans and cloud request must not block GNSS when it is run at the same time */
+	if (request->config.mode == LOCATION_REQ_MODE_CONCURRENT) {
+		work_q = location_core_concurrent_work_queue_get();
+	}
+#endif
 	running = true;
 
+	k_work_submit_to_queue(work_q, &method_cloud_location_start_work.work_item);
+
 	return 0;
 }
 
@@ -224,5 +249,9 @@ int method_cloud_location_init(void)
 {
 	running = false;
 
+#if defined(CONFIG_LOCATION_SERVICE_CLOUD_CACHE)
+	return cloud_cache_init();
+#else
 	return 0;
+#endif
 }
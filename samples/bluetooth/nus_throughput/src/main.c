@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file
+ *  @brief Nordic UART Service streaming throughput sample
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/bluetooth/gatt.h>
+#include <zephyr/bluetooth/hci.h>
+
+#include <bluetooth/services/nus.h>
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(nus_throughput, LOG_LEVEL_INF);
+
+#define DEVICE_NAME CONFIG_BT_DEVICE_NAME
+#define DEVICE_NAME_LEN (sizeof(DEVICE_NAME) - 1)
+
+#define CHUNK_SIZE CONFIG_NUS_THROUGHPUT_CHUNK_SIZE
+#define REPORT_INTERVAL K_MSEC(CONFIG_NUS_THROUGHPUT_REPORT_INTERVAL_MS)
+
+struct peer {
+	struct bt_conn *conn;
+	/* Number of bytes accepted by the stream since the last report. */
+	atomic_t bytes;
+};
+
+static struct peer peers[CONFIG_BT_MAX_CONN];
+static uint8_t chunk[CHUNK_SIZE];
+
+static K_SEM_DEFINE(stream_sem, 0, 1);
+
+static void adv_work_handler(struct k_work *work);
+static K_WORK_DEFINE(adv_work, adv_work_handler);
+
+static const struct bt_data ad[] = {
+	BT_DATA_BYTES(BT_DATA_FLAGS, (BT_LE_AD_GENERAL | BT_LE_AD_NO_BREDR)),
+	BT_DATA(BT_DATA_NAME_COMPLETE, DEVICE_NAME, DEVICE_NAME_LEN),
+};
+
+static const struct bt_data sd[] = {
+	BT_DATA_BYTES(BT_DATA_UUID128_ALL, BT_UUID_NUS_VAL),
+};
+
+static void adv_work_handler(struct k_work *work)
+{
+	int err;
+
+	err = bt_le_adv_start(BT_LE_ADV_CONN_FAST_2, ad, ARRAY_SIZE(ad), sd, ARRAY_SIZE(sd));
+	if (err && (err != -EALREADY)) {
+		LOG_ERR("Advertising failed to start (err %d)", err);
+		return;
+	}
+
+	LOG_INF("Advertising started");
+}
+
+static void mtu_exchange_cb(struct bt_conn *conn, uint8_t err,
+			    struct bt_gatt_exchange_params *params)
+{
+	LOG_INF("MTU exchange %s, NUS payload %u bytes", err ? "failed" : "done",
+		bt_nus_get_mtu(conn));
+}
+
+static struct bt_gatt_exchange_params exchange_params[CONFIG_BT_MAX_CONN];
+
+static void connected(struct bt_conn *conn, uint8_t err)
+{
+	struct peer *peer = &peers[bt_conn_index(conn)];
+
+	if (err) {
+		LOG_ERR("Connection failed, err 0x%02x %s", err, bt_hci_err_to_str(err));
+		return;
+	}
+
+	peer->conn = bt_conn_ref(conn);
+	atomic_set(&peer->bytes, 0);
+
+	LOG_INF("Peer %u connected", bt_conn_index(conn));
+
+	err = bt_conn_le_phy_update(conn, BT_CONN_LE_PHY_PARAM_2M);
+	if (err) {
+		LOG_WRN("PHY update failed (err %d)", err);
+	}
+
+	err = bt_conn_le_data_len_update(conn, BT_LE_DATA_LEN_PARAM_MAX);
+	if (err) {
+		LOG_WRN("Data length update failed (err %d)", err);
+	}
+
+	exchange_params[bt_conn_index(conn)].func = mtu_exchange_cb;
+	err = bt_gatt_exchange_mtu(conn, &exchange_params[bt_conn_index(conn)]);
+	if (err) {
+		LOG_WRN("MTU exchange failed (err %d)", err);
+	}
+}
+
+static void disconnected(struct bt_conn *conn, uint8_t reason)
+{
+	struct peer *peer = &peers[bt_conn_index(conn)];
+
+	LOG_INF("Peer %u disconnected, reason 0x%02x %s", bt_conn_index(conn), reason,
+		bt_hci_err_to_str(reason));
+
+	if (peer->conn) {
+		bt_conn_unref(peer->conn);
+		peer->conn = NULL;
+	}
+}
+
+static void recycled(void)
+{
+	/* Advertise again to accept more peers. */
+	k_work_submit(&adv_work);
+}
+
+BT_CONN_CB_DEFINE(conn_callbacks) = {
+	.connected = connected,
+	.disconnected = disconnected,
+	.recycled = recycled,
+};
+
+static void send_enabled(enum bt_nus_send_status status)
+{
+	if (status == BT_NUS_SEND_STATUS_ENABLED) {
+		k_sem_give(&stream_sem);
+	}
+}
+
+static void stream_ready(struct bt_conn *conn)
+{
+	k_sem_give(&stream_sem);
+}
+
+static struct bt_nus_cb nus_cb = {
+	.send_enabled = send_enabled,
+	.stream_ready = stream_ready,
+};
+
+static void report(int64_t elapsed_ms)
+{
+	uint32_t total = 0;
+	uint32_t peer_count = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(peers); i++) {
+		uint32_t bytes = atomic_clear(&peers[i].bytes);
+
+		if (!peers[i].conn) {
+			continue;
+		}
+
+		LOG_INF("Peer %u: %u KB/s", i,
+			(uint32_t)((uint64_t)bytes * MSEC_PER_SEC / 1024 / elapsed_ms));
+		total += bytes;
+		peer_count++;
+	}
+
+	LOG_INF("Total with %u peers: %u KB/s", peer_count,
+		(uint32_t)((uint64_t)total * MSEC_PER_SEC / 1024 / elapsed_ms));
+}
+
+int main(void)
+{
+	int64_t report_time;
+	int err;
+
+	LOG_INF("Starting NUS throughput sample");
+
+	for (size_t i = 0; i < sizeof(chunk); i++) {
+		chunk[i] = (uint8_t)i;
+	}
+
+	err = bt_nus_init(&nus_cb);
+	if (err) {
+		LOG_ERR("Failed to initialize NUS (err %d)", err);
+		return 0;
+	}
+
+	err = bt_enable(NULL);
+	if (err) {
+		LOG_ERR("Bluetooth init failed (err %d)", err);
+		return 0;
+	}
+
+	k_work_submit(&adv_work);
+
+	report_time = k_uptime_get();
+
+	while (true) {
+		bool all_blocked = true;
+
+		/* Keep the stream of every subscribed peer full. */
+		for (size_t i = 0; i < ARRAY_SIZE(peers); i++) {
+			int accepted;
+
+			if (!peers[i].conn) {
+				continue;
+			}
+
+			accepted = bt_nus_stream_send(peers[i].conn, chunk, sizeof(chunk));
+			if (accepted > 0) {
+				atomic_add(&peers[i].bytes, accepted);
+			}
+
+			if (accepted == sizeof(chunk)) {
+				all_blocked = false;
+			}
+		}
+
+		if (all_blocked) {
+			/* Wait until a stream has space, or a peer subscribes. */
+			k_sem_take(&stream_sem, REPORT_INTERVAL);
+		}
+
+		if (k_uptime_get() - report_time >= CONFIG_NUS_THROUGHPUT_REPORT_INTERVAL_MS) {
+			report(k_uptime_delta(&report_time));
+		}
+	}
+
+	return 0;
+}
@@ -20,6 +20,9 @@
 #include <bluetooth/services/throughput.h>
 #include <bluetooth/scan.h>
 #include <bluetooth/gatt_dm.h>
+#if defined(CONFIG_BT_CTLR_SDC_RX_STATS)
+#include <bluetooth/ctlr_sdc_rx_stats.h>
+#endif
 
 #include <zephyr/shell/shell_uart.h>
 
@@ -411,12 +414,34 @@ static void throughput_received(const struct bt_throughput_metrics *met)
 	}
 }
 
+static void rx_stats_print(void)
+{
+#if defined(CONFIG_BT_CTLR_SDC_RX_STATS)
+	struct bt_ctlr_sdc_rx_stats stats;
+	uint32_t pkt_count;
+
+	bt_ctlr_sdc_rx_stats_get(&stats);
+	bt_ctlr_sdc_rx_stats_reset();
+
+	pkt_count = stats.evt_count + stats.acl_count + stats.iso_count;
+
+	printk("[local] HCI RX: %u events, %u ACL (%u zero-copy), %u ISO packets\n",
+	       stats.evt_count, stats.acl_count, stats.acl_zero_copy_count, stats.iso_count);
+	printk("[local] HCI RX: %u events discarded, %u stalls on host buffers\n",
+	       stats.evt_discarded_count, stats.no_buf_count);
+	printk("[local] HCI RX latency: avg %llu us, max %u us\n",
+	       pkt_count ? (stats.latency_total_us / pkt_count) : 0, stats.latency_max_us);
+#endif
+}
+
 static void throughput_send(const struct bt_throughput_metrics *met)
 {
 	printk("\n[local] received %u bytes (%u KB)"
 		" in %u GATT writes at %u bps\n",
 		met->write_len, met->write_len / 1024,
 		met->write_count, met->write_rate);
+
+	rx_stats_print();
 }
 
 static const struct bt_throughput_cb throughput_cb = {
@@ -93,7 +93,8 @@ static const char location_get_usage_str[] =
 	"  -m, --method, [str]         Location method: 'gnss', 'cellular' or 'wifi'. Multiple\n"
 	"                              '--method' parameters may be given to indicate list of\n"
 	"                              methods in priority order.\n"
-	"  --mode, [str]               Location request mode: 'fallback' (default) or 'all'.\n"
+	"  --mode, [str]               Location request mode: 'fallback' (default), 'all' or\n"
+	"                              'concurrent'.\n"
 	"  --interval, [int]           Position update interval in seconds\n"
 	"                              (default: 0 = single position)\n"
 	"  -t, --timeout, [float]      Timeout for the entire location request in seconds.\n"
@@ -624,6 +625,8 @@ static int cmd_location_get(const struct shell *shell, size_t argc, char **argv)
 				req_mode = LOCATION_REQ_MODE_FALLBACK;
 			} else if (strcmp(sys_getopt_optarg, "all") == 0) {
 				req_mode = LOCATION_REQ_MODE_ALL;
+			} else if (strcmp(sys_getopt_optarg, "concurrent") == 0) {
+				req_mode = LOCATION_REQ_MODE_CONCURRENT;
 			} else {
 				mosh_error(
 					"Unknown location request mode (%s) was given. See usage:",
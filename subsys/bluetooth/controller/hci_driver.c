@@ -15,9 +15,13 @@
 #include <zephyr/kernel.h>
 #include <soc.h>
 #include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/ring_buffer.h>
 #include <zephyr/sys/util.h>
 #include <stdbool.h>
+#include <string.h>
 #include <zephyr/sys/__assert.h>
+#include <zephyr/spinlock.h>
 
 #include <sdc.h>
 #include <sdc_soc.h>
@@ -32,6 +36,10 @@
 #include "radio_nrf5_txp.h"
 #include "cs_antenna_switch.h"
 
+#if defined(CONFIG_BT_CTLR_SDC_RX_STATS)
+#include <bluetooth/ctlr_sdc_rx_stats.h>
+#endif
+
 #define DT_DRV_COMPAT nordic_bt_hci_sdc
 
 #define LOG_LEVEL CONFIG_BT_HCI_DRIVER_LOG_LEVEL
@@ -369,8 +377,77 @@ static struct {
 	uint8_t buf[HCI_RX_BUF_SIZE];
 	/* Type of the HCI packet the buffer contains. */
 	sdc_hci_msg_type_t type;
+	/* Pointer to the HCI packet, either in buf or in acl_buf. */
+	uint8_t *msg;
+#if defined(CONFIG_BT_CTLR_SDC_RX_ACL_ZERO_COPY)
+	/* Host ACL buffer the HCI packets are fetched into. */
+	struct net_buf *acl_buf;
+	/* Host ACL buffer cannot hold all HCI packets, zero-copy is not used. */
+	bool acl_buf_too_small;
+#endif
+#if defined(CONFIG_BT_CTLR_SDC_RX_STATS)
+	/* Cycle counter value at which the HCI packet was fetched. */
+	uint32_t fetch_cycles;
+#endif
 } rx_hci_msg;
 
+#if defined(CONFIG_BT_CTLR_SDC_RX_STATS)
+static struct bt_ctlr_sdc_rx_stats rx_stats;
+static struct k_spinlock rx_stats_lock;
+
+#define RX_STATS_INC(_field)                                                                       \
+	do {                                                                                       \
+		K_SPINLOCK(&rx_stats_lock) {                                                       \
+			rx_stats._field++;                                                         \
+		}                                                                                  \
+	} while (0)
+
+/* Called only for the packets passed to the host, not for the dropped ones. */
+static void rx_stats_packet_passed(sdc_hci_msg_type_t msg_type, uint32_t fetch_cycles)
+{
+	uint32_t latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - fetch_cycles);
+
+	K_SPINLOCK(&rx_stats_lock) {
+		if (msg_type == SDC_HCI_MSG_TYPE_EVT) {
+			rx_stats.evt_count++;
+		} else if (msg_type == SDC_HCI_MSG_TYPE_DATA) {
+			rx_stats.acl_count++;
+		} else if (msg_type == SDC_HCI_MSG_TYPE_ISO) {
+			rx_stats.iso_count++;
+		}
+
+		rx_stats.latency_max_us = MAX(rx_stats.latency_max_us, latency_us);
+		rx_stats.latency_total_us += latency_us;
+	}
+}
+
+void bt_ctlr_sdc_rx_stats_get(struct bt_ctlr_sdc_rx_stats *stats)
+{
+	K_SPINLOCK(&rx_stats_lock) {
+		*stats = rx_stats;
+	}
+}
+
+void bt_ctlr_sdc_rx_stats_reset(void)
+{
+	K_SPINLOCK(&rx_stats_lock) {
+		memset(&rx_stats, 0, sizeof(rx_stats));
+	}
+}
+#else
+#define RX_STATS_INC(_field)
+#define rx_stats_packet_passed(_msg_type, _fetch_cycles)
+#endif /* CONFIG_BT_CTLR_SDC_RX_STATS */
+
+static inline uint32_t rx_msg_fetch_cycles(void)
+{
+#if defined(CONFIG_BT_CTLR_SDC_RX_STATS)
+	return rx_hci_msg.fetch_cycles;
+#else
+	return 0;
+#endif
+}
+
 static void bt_buf_rx_freed_cb(enum bt_buf_type type_mask)
 {
 	if (((rx_hci_msg.type == SDC_HCI_MSG_TYPE_EVT && (type_mask & BT_BUF_EVT) != 0u) ||
@@ -481,12 +558,33 @@ static int hci_driver_send(const struct device *dev, struct net_buf *buf)
 	return err;
 }
 
+static bool msg_in_acl_buf(const uint8_t *hci_buf)
+{
+#if defined(CONFIG_BT_CTLR_SDC_RX_ACL_ZERO_COPY)
+	return rx_hci_msg.acl_buf && (hci_buf == net_buf_tail(rx_hci_msg.acl_buf));
+#else
+	return false;
+#endif
+}
+
 static int data_packet_process(const struct device *dev, uint8_t *hci_buf)
 {
-	struct net_buf *data_buf = bt_buf_get_rx(BT_BUF_ACL_IN, K_NO_WAIT);
+	struct net_buf *data_buf;
 	struct bt_hci_acl_hdr *hdr = (void *)hci_buf;
 	uint16_t hf, handle, len;
 	uint8_t flags, pb, bc;
+	bool zero_copy = msg_in_acl_buf(hci_buf);
+
+#if defined(CONFIG_BT_CTLR_SDC_RX_ACL_ZERO_COPY)
+	if (zero_copy) {
+		/* The packet was fetched directly into the host buffer. */
+		data_buf = rx_hci_msg.acl_buf;
+		rx_hci_msg.acl_buf = NULL;
+	} else
+#endif
+	{
+		data_buf = bt_buf_get_rx(BT_BUF_ACL_IN, K_NO_WAIT);
+	}
 
 	if (!data_buf) {
 		LOG_DBG("No data buffer available");
@@ -510,11 +608,17 @@ static int data_packet_process(const struct device *dev, uint8_t *hci_buf)
 	LOG_DBG("Data: handle (0x%02x), PB(%01d), BC(%01d), len(%u)", handle,
 	       pb, bc, len);
 
-	net_buf_add_mem(data_buf, &hci_buf[0], len + sizeof(*hdr));
+	if (zero_copy) {
+		net_buf_add(data_buf, len + sizeof(*hdr));
+		RX_STATS_INC(acl_zero_copy_count);
+	} else {
+		net_buf_add_mem(data_buf, &hci_buf[0], len + sizeof(*hdr));
+	}
 
 	struct hci_driver_data *driver_data = dev->data;
 
 	driver_data->recv_func(dev, data_buf);
+	rx_stats_packet_passed(SDC_HCI_MSG_TYPE_DATA, rx_msg_fetch_cycles());
 
 	return 0;
 }
@@ -543,36 +647,46 @@ static int iso_data_packet_process(const struct device *dev, uint8_t *hci_buf)
 	struct hci_driver_data *driver_data = dev->data;
 
 	(void)driver_data->recv_func(dev, data_buf);
+	rx_stats_packet_passed(SDC_HCI_MSG_TYPE_ISO, rx_msg_fetch_cycles());
 
 	return 0;
 }
 
-static bool event_packet_is_discardable(const uint8_t *hci_buf)
+static bool adv_report_is_legacy(const uint8_t *hci_buf)
 {
 	struct bt_hci_evt_hdr *hdr = (void *)hci_buf;
+	struct bt_hci_evt_le_meta_event *me = (void *)&hci_buf[2];
 
-	switch (hdr->evt) {
-	case BT_HCI_EVT_LE_META_EVENT: {
-		struct bt_hci_evt_le_meta_event *me = (void *)&hci_buf[2];
+	if (hdr->evt != BT_HCI_EVT_LE_META_EVENT) {
+		return false;
+	}
 
-		switch (me->subevent) {
-		case BT_HCI_EVT_LE_ADVERTISING_REPORT:
-			return true;
+	switch (me->subevent) {
+	case BT_HCI_EVT_LE_ADVERTISING_REPORT:
+		return true;
 #if defined(CONFIG_BT_EXT_ADV)
-		case BT_HCI_EVT_LE_EXT_ADVERTISING_REPORT:
-		{
-			const struct bt_hci_evt_le_ext_advertising_report *ext_adv =
-				(void *)&hci_buf[3];
-
-			return (ext_adv->num_reports == 1) &&
-				   ((ext_adv->adv_info->evt_type &
-					 BT_HCI_LE_ADV_EVT_TYPE_LEGACY) != 0);
-		}
+	case BT_HCI_EVT_LE_EXT_ADVERTISING_REPORT:
+	{
+		const struct bt_hci_evt_le_ext_advertising_report *ext_adv =
+			(void *)&hci_buf[3];
+
+		return (ext_adv->num_reports == 1) &&
+			   ((ext_adv->adv_info->evt_type &
+				 BT_HCI_LE_ADV_EVT_TYPE_LEGACY) != 0);
+	}
 #endif
-		default:
-			return false;
-		}
+	default:
+		return false;
 	}
+}
+
+static bool event_packet_is_discardable(const uint8_t *hci_buf)
+{
+	struct bt_hci_evt_hdr *hdr = (void *)hci_buf;
+
+	switch (hdr->evt) {
+	case BT_HCI_EVT_LE_META_EVENT:
+		return adv_report_is_legacy(hci_buf);
 	case BT_HCI_EVT_VENDOR:
 	{
 		uint8_t subevent = hci_buf[2];
@@ -595,7 +709,7 @@ static bool event_packet_is_discardable(const uint8_t *hci_buf)
 	}
 }
 
-static int event_packet_process(const struct device *dev, uint8_t *hci_buf)
+static int event_packet_process(const struct device *dev, uint8_t *hci_buf, uint32_t fetch_cycles)
 {
 	bool discardable = event_packet_is_discardable(hci_buf);
 	struct bt_hci_evt_hdr *hdr = (void *)hci_buf;
@@ -636,6 +750,10 @@ static int event_packet_process(const struct device *dev, uint8_t *hci_buf)
 	if (!evt_buf) {
 		if (discardable) {
 			LOG_DBG("Discarding event");
+			RX_STATS_INC(evt_discarded_count);
+			if (hdr->evt == BT_HCI_EVT_LE_META_EVENT) {
+				RX_STATS_INC(adv_discarded_count);
+			}
 			return 0;
 		}
 
@@ -648,10 +766,255 @@ static int event_packet_process(const struct device *dev, uint8_t *hci_buf)
 	struct hci_driver_data *driver_data = dev->data;
 
 	(void)driver_data->recv_func(dev, evt_buf);
+	rx_stats_packet_passed(SDC_HCI_MSG_TYPE_EVT, fetch_cycles);
 
 	return 0;
 }
 
+#if defined(CONFIG_BT_CTLR_SDC_RX_ADV_RATE_LIMIT) && (CONFIG_BT_CTLR_SDC_RX_ADV_RATE_LIMIT > 0)
+#define ADV_RATE_LIMIT CONFIG_BT_CTLR_SDC_RX_ADV_RATE_LIMIT
+#endif
+
+#if defined(CONFIG_BT_CTLR_SDC_RX_ADV_LANE) || defined(CONFIG_BT_CTLR_SDC_RX_ADV_DUP_FILTER) || \
+	defined(ADV_RATE_LIMIT)
+#define ADV_REPORT_FILTER 1
+#endif
+
+#if defined(CONFIG_BT_CTLR_SDC_RX_ADV_DUP_FILTER)
+/* Identification of the advertising data received from an advertiser. */
+struct adv_report_key {
+	const bt_addr_le_t *addr;
+	uint16_t evt_type;
+	uint32_t data_hash;
+};
+
+/* Advertising data last passed to the host for an advertiser. */
+static struct adv_dup_entry {
+	bt_addr_le_t addr;
+	uint16_t evt_type;
+	bool valid;
+	uint32_t data_hash;
+	uint32_t time;
+} adv_dup_cache[CONFIG_BT_CTLR_SDC_RX_ADV_DUP_FILTER_SIZE];
+
+static bool adv_report_key_get(const uint8_t *hci_buf, struct adv_report_key *key)
+{
+	struct bt_hci_evt_le_meta_event *me = (void *)&hci_buf[2];
+
+	if (me->subevent == BT_HCI_EVT_LE_ADVERTISING_REPORT) {
+		const struct bt_hci_evt_le_advertising_report *report = (void *)&hci_buf[3];
+		const struct bt_hci_evt_le_advertising_info *info = &report->adv_info[0];
+
+		if (report->num_reports != 1) {
+			return false;
+		}
+
+		key->addr = &info->addr;
+		key->evt_type = info->evt_type;
+		key->data_hash = crc32_ieee(info->data, info->length);
+
+		return true;
+	}
+
+#if defined(CONFIG_BT_EXT_ADV)
+	if (me->subevent == BT_HCI_EVT_LE_EXT_ADVERTISING_REPORT) {
+		const struct bt_hci_evt_le_ext_advertising_report *report = (void *)&hci_buf[3];
+		const struct bt_hci_evt_le_ext_advertising_info *info = &report->adv_info[0];
+
+		key->addr = &info->addr;
+		key->evt_type = sys_le16_to_cpu(info->evt_type);
+		key->data_hash = crc32_ieee(info->data, info->length);
+
+		return true;
+	}
+#endif
+
+	return false;
+}
+
+/* Find the cache entry of the advertiser, or the entry to be replaced if the advertiser
+ * is not tracked. Sets is_dup if the report repeats the data passed to the host recently.
+ */
+static struct adv_dup_entry *adv_dup_entry_find(const struct adv_report_key *key, bool *is_dup)
+{
+	uint32_t now = k_uptime_get_32();
+	struct adv_dup_entry *victim = NULL;
+
+	*is_dup = false;
+
+	for (size_t i = 0; i < ARRAY_SIZE(adv_dup_cache); i++) {
+		struct adv_dup_entry *entry = &adv_dup_cache[i];
+
+		if (!entry->valid) {
+			victim = victim ? victim : entry;
+			continue;
+		}
+
+		if ((entry->evt_type == key->evt_type) && bt_addr_le_eq(&entry->addr, key->addr)) {
+			*is_dup = (entry->data_hash == key->data_hash) &&
+				  ((now - entry->time) < CONFIG_BT_CTLR_SDC_RX_ADV_DUP_FILTER_TIMEOUT_MS);
+			return entry;
+		}
+
+		if (!victim || (victim->valid && ((now - entry->time) > (now - victim->time)))) {
+			victim = entry;
+		}
+	}
+
+	return victim;
+}
+
+static void adv_dup_entry_update(struct adv_dup_entry *entry, const struct adv_report_key *key)
+{
+	bt_addr_le_copy(&entry->addr, key->addr);
+	entry->evt_type = key->evt_type;
+	entry->data_hash = key->data_hash;
+	entry->time = k_uptime_get_32();
+	entry->valid = true;
+}
+#endif /* CONFIG_BT_CTLR_SDC_RX_ADV_DUP_FILTER */
+
+#if defined(ADV_RATE_LIMIT)
+/* Token bucket in thousandths of a report, filled at ADV_RATE_LIMIT reports per second. */
+static uint32_t adv_rate_tokens = ADV_RATE_LIMIT * MSEC_PER_SEC;
+static uint32_t adv_rate_time;
+
+static bool adv_report_rate_limited(void)
+{
+	uint32_t now = k_uptime_get_32();
+	uint32_t elapsed = MIN(now - adv_rate_time, MSEC_PER_SEC);
+
+	adv_rate_time = now;
+	adv_rate_tokens = MIN(adv_rate_tokens + elapsed * ADV_RATE_LIMIT,
+			      ADV_RATE_LIMIT * MSEC_PER_SEC);
+
+	if (adv_rate_tokens < MSEC_PER_SEC) {
+		return true;
+	}
+
+	adv_rate_tokens -= MSEC_PER_SEC;
+	return false;
+}
+#endif /* ADV_RATE_LIMIT */
+
+#if defined(CONFIG_BT_CTLR_SDC_RX_ADV_LANE)
+/* Maximum size of a legacy advertising report event. */
+#define ADV_LANE_MSG_MAX_LEN 64
+
+/* Queued advertising report events, stored back to back. With the statistics enabled, each
+ * event is preceded by the cycle counter value at which it was fetched.
+ */
+RING_BUF_DECLARE(adv_lane, CONFIG_BT_CTLR_SDC_RX_ADV_LANE_SIZE);
+
+#if defined(CONFIG_BT_CTLR_SDC_RX_STATS)
+#define ADV_LANE_ENTRY_HDR_LEN sizeof(uint32_t)
+#else
+#define ADV_LANE_ENTRY_HDR_LEN 0
+#endif
+
+static void adv_lane_pass_one(const struct device *dev)
+{
+	uint8_t buf[ADV_LANE_MSG_MAX_LEN];
+	struct bt_hci_evt_hdr *hdr = (void *)buf;
+	uint32_t fetch_cycles = 0;
+	uint32_t len;
+
+	len = ring_buf_get(&adv_lane, (uint8_t *)&fetch_cycles, ADV_LANE_ENTRY_HDR_LEN);
+	__ASSERT_NO_MSG(len == ADV_LANE_ENTRY_HDR_LEN);
+
+	len = ring_buf_get(&adv_lane, buf, sizeof(*hdr));
+	__ASSERT_NO_MSG(len == sizeof(*hdr));
+
+	len = ring_buf_get(&adv_lane, &buf[sizeof(*hdr)], hdr->len);
+	__ASSERT_NO_MSG(len == hdr->len);
+
+	/* Advertising reports are discardable, so the host never stalls them. */
+	(void)event_packet_process(dev, buf, fetch_cycles);
+}
+
+static void adv_lane_flush(const struct device *dev)
+{
+	while (!ring_buf_is_empty(&adv_lane)) {
+		adv_lane_pass_one(dev);
+	}
+}
+
+static void adv_lane_put(const struct device *dev, uint8_t *hci_buf)
+{
+	struct bt_hci_evt_hdr *hdr = (void *)hci_buf;
+	uint32_t fetch_cycles = rx_msg_fetch_cycles();
+	uint32_t len = hdr->len + sizeof(*hdr);
+
+	if (len > ADV_LANE_MSG_MAX_LEN) {
+		adv_lane_flush(dev);
+		(void)event_packet_process(dev, hci_buf, fetch_cycles);
+		return;
+	}
+
+	while (ring_buf_space_get(&adv_lane) < (ADV_LANE_ENTRY_HDR_LEN + len)) {
+		adv_lane_pass_one(dev);
+	}
+
+	ring_buf_put(&adv_lane, (uint8_t *)&fetch_cycles, ADV_LANE_ENTRY_HDR_LEN);
+	ring_buf_put(&adv_lane, hci_buf, len);
+	RX_STATS_INC(adv_deferred_count);
+}
+
+static void adv_lane_reset(void)
+{
+	ring_buf_reset(&adv_lane);
+}
+#else
+static inline void adv_lane_flush(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+}
+
+static inline void adv_lane_reset(void)
+{
+}
+#endif /* CONFIG_BT_CTLR_SDC_RX_ADV_LANE */
+
+#if defined(ADV_REPORT_FILTER)
+/* Drop, defer or pass a legacy advertising report. */
+static void adv_report_process(const struct device *dev, uint8_t *hci_buf)
+{
+#if defined(CONFIG_BT_CTLR_SDC_RX_ADV_DUP_FILTER)
+	struct adv_report_key key;
+	struct adv_dup_entry *entry = NULL;
+	bool is_dup;
+
+	if (adv_report_key_get(hci_buf, &key)) {
+		entry = adv_dup_entry_find(&key, &is_dup);
+		if (is_dup) {
+			RX_STATS_INC(adv_duplicate_count);
+			return;
+		}
+	}
+#endif
+
+#if defined(ADV_RATE_LIMIT)
+	if (adv_report_rate_limited()) {
+		RX_STATS_INC(adv_rate_limited_count);
+		return;
+	}
+#endif
+
+#if defined(CONFIG_BT_CTLR_SDC_RX_ADV_DUP_FILTER)
+	if (entry) {
+		adv_dup_entry_update(entry, &key);
+	}
+#endif
+
+#if defined(CONFIG_BT_CTLR_SDC_RX_ADV_LANE)
+	adv_lane_put(dev, hci_buf);
+#else
+	/* Advertising reports are discardable, so the host never stalls them. */
+	(void)event_packet_process(dev, hci_buf, rx_msg_fetch_cycles());
+#endif
+}
+#endif /* ADV_REPORT_FILTER */
+
 static int fetch_hci_msg(uint8_t *p_hci_buffer, sdc_hci_msg_type_t *msg_type)
 {
 	int errcode;
@@ -670,8 +1033,15 @@ static int process_hci_msg(const struct device *dev, uint8_t *p_hci_buffer,
 {
 	int err;
 
+#if defined(ADV_REPORT_FILTER)
+	if ((msg_type == SDC_HCI_MSG_TYPE_EVT) && adv_report_is_legacy(p_hci_buffer)) {
+		adv_report_process(dev, p_hci_buffer);
+		return 0;
+	}
+#endif
+
 	if (msg_type == SDC_HCI_MSG_TYPE_EVT) {
-		err = event_packet_process(dev, p_hci_buffer);
+		err = event_packet_process(dev, p_hci_buffer, rx_msg_fetch_cycles());
 	} else if (msg_type == SDC_HCI_MSG_TYPE_DATA) {
 		err = data_packet_process(dev, p_hci_buffer);
 	} else if (msg_type == SDC_HCI_MSG_TYPE_ISO) {
@@ -687,26 +1057,62 @@ static int process_hci_msg(const struct device *dev, uint8_t *p_hci_buffer,
 	return err;
 }
 
+static uint8_t *rx_msg_buf_get(void)
+{
+#if defined(CONFIG_BT_CTLR_SDC_RX_ACL_ZERO_COPY)
+	if (!rx_hci_msg.acl_buf && !rx_hci_msg.acl_buf_too_small) {
+		rx_hci_msg.acl_buf = bt_buf_get_rx(BT_BUF_ACL_IN, K_NO_WAIT);
+
+		if (rx_hci_msg.acl_buf &&
+		    (net_buf_tailroom(rx_hci_msg.acl_buf) < HCI_RX_BUF_SIZE)) {
+			LOG_WRN("ACL buffer too small for zero-copy receive. %zu < %u",
+				net_buf_tailroom(rx_hci_msg.acl_buf), HCI_RX_BUF_SIZE);
+			net_buf_unref(rx_hci_msg.acl_buf);
+			rx_hci_msg.acl_buf = NULL;
+			rx_hci_msg.acl_buf_too_small = true;
+		}
+	}
+
+	if (rx_hci_msg.acl_buf) {
+		return net_buf_tail(rx_hci_msg.acl_buf);
+	}
+#endif
+
+	return &rx_hci_msg.buf[0];
+}
+
 void hci_driver_receive_process(void)
 {
 	const struct device *dev = DEVICE_DT_GET(DT_DRV_INST(0));
 	int err;
 
-	if (rx_hci_msg.type == SDC_HCI_MSG_TYPE_NONE &&
-	    fetch_hci_msg(&rx_hci_msg.buf[0], &rx_hci_msg.type) != 0) {
-		return;
-	}
+	for (size_t i = 0; i < CONFIG_BT_CTLR_SDC_RX_BATCH_COUNT; i++) {
+		if (rx_hci_msg.type == SDC_HCI_MSG_TYPE_NONE) {
+			rx_hci_msg.msg = rx_msg_buf_get();
 
-	err = process_hci_msg(dev, &rx_hci_msg.buf[0], rx_hci_msg.type);
-	if (err == -ENOBUFS) {
-		/* If we got -ENOBUFS, wait for the signal from the host. */
-		return;
-	} else if (err) {
-		LOG_ERR("Unknown error when processing hci message %d", err);
-		k_panic();
-	}
+			if (fetch_hci_msg(rx_hci_msg.msg, &rx_hci_msg.type) != 0) {
+				/* No other packets pending, pass the deferred advertising reports. */
+				adv_lane_flush(dev);
+				return;
+			}
 
-	rx_hci_msg.type = SDC_HCI_MSG_TYPE_NONE;
+#if defined(CONFIG_BT_CTLR_SDC_RX_STATS)
+			rx_hci_msg.fetch_cycles = k_cycle_get_32();
+#endif
+		}
+
+		err = process_hci_msg(dev, rx_hci_msg.msg, rx_hci_msg.type);
+		if (err == -ENOBUFS) {
+			/* If we got -ENOBUFS, wait for the signal from the host. */
+			RX_STATS_INC(no_buf_count);
+			return;
+		} else if (err) {
+			LOG_ERR("Unknown error when processing hci message %d", err);
+			k_panic();
+		}
+
+		rx_hci_msg.type = SDC_HCI_MSG_TYPE_NONE;
+	}
 
 	/* Let other threads of same priority run in between. */
 	receive_signal_raise();
@@ -1512,6 +1918,18 @@ static int hci_driver_close(const struct device *dev)
 
 	bt_buf_rx_freed_cb_set(NULL);
 
+	/* The packets fetched from the disabled controller are not passed to the host. */
+	rx_hci_msg.type = SDC_HCI_MSG_TYPE_NONE;
+	adv_lane_reset();
+
+#if defined(CONFIG_BT_CTLR_SDC_RX_ACL_ZERO_COPY)
+	/* Return the preallocated buffer to the host. */
+	if (rx_hci_msg.acl_buf) {
+		net_buf_unref(rx_hci_msg.acl_buf);
+		rx_hci_msg.acl_buf = NULL;
+	}
+#endif
+
 	return err;
 }
 
@@ -10,6 +10,13 @@
 
 #include <bluetooth/gatt_dm.h>
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+#include <stdio.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/settings/settings.h>
+#endif
+
 LOG_MODULE_REGISTER(bt_gatt_dm, CONFIG_BT_GATT_DM_LOG_LEVEL);
 
 /* Available sizes: 128, 512, 2048... */
@@ -92,6 +99,25 @@ struct bt_gatt_dm {
 
 	/* Work item used for discovery callbacks. */
 	struct k_work discover_work;
+
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	/* Work item used for restoring the service from the cache. */
+	struct k_work cache_work;
+	/* Parameters of the Database Hash read. */
+	struct bt_gatt_read_params read_params;
+	/* Database Hash of the peer. */
+	uint8_t db_hash[16];
+	/* Indicates that the Database Hash was read from the peer. */
+	bool db_hash_valid;
+	/* Indicates that the attributes were restored from the cache. */
+	bool from_cache;
+	/* Local identity of the connection. */
+	uint8_t local_id;
+	/* Identity address of the bonded peer. */
+	bt_addr_le_t peer_addr;
+	/* Uptime at the start of the discovery. */
+	int64_t start_time;
+#endif
 };
 
 /* Currently only one instance is supported */
@@ -268,9 +294,26 @@ static struct bt_gatt_dm_attr *attr_find_by_handle(
 	return NULL;
 }
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+static struct bt_gatt_dm_cache_stats cache_stats;
+
+static void cache_store(struct bt_gatt_dm *dm);
+#endif
+
 static void discovery_complete(struct bt_gatt_dm *dm)
 {
 	LOG_DBG("Discovery complete.");
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	if (dm->db_hash_valid) {
+		if (!dm->from_cache) {
+			cache_store(dm);
+		}
+
+		cache_stats.last_ready_time_ms = (uint32_t)(k_uptime_get() - dm->start_time);
+		LOG_DBG("Service ready in %u ms (%s)", cache_stats.last_ready_time_ms,
+			dm->from_cache ? "cached" : "discovered");
+	}
+#endif
 	atomic_set_bit(dm->state_flags, STATE_ATTRS_RELEASE_PENDING);
 	if (dm->callback->completed) {
 		dm->callback->completed(dm, dm->context);
@@ -298,6 +341,15 @@ static void discovery_complete_error(struct bt_gatt_dm *dm, int err)
 	}
 }
 
+static void dm_work_submit(struct k_work *work)
+{
+#if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
+	k_work_submit_to_queue(&bt_gatt_dm_wq, work);
+#else
+	k_work_submit(work);
+#endif
+}
+
 static void gatt_discover_work(struct k_work *work)
 {
 	struct bt_gatt_dm *dm = CONTAINER_OF(work, struct bt_gatt_dm, discover_work);
@@ -315,6 +367,453 @@ static void gatt_discover_work(struct k_work *work)
 	}
 }
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+
+#define CACHE_SUBTREE "bt_dm"
+/* "bt_dm/" + identity + "/" + 12 address digits + address type + "/" + UUID string */
+#define CACHE_KEY_LEN (sizeof(CACHE_SUBTREE) + 4 + 14 + BT_UUID_STR_LEN)
+/* Handle, permissions and UUID of the attribute followed by the largest attribute value:
+ * service end handle and UUID or characteristic value handle, properties and UUID.
+ */
+#define CACHE_ATTR_MAX_LEN (2 * (sizeof(uint16_t) + sizeof(uint8_t) + 1 + BT_UUID_SIZE_128))
+#define CACHE_DATA_MAX_LEN \
+	(sizeof(((struct bt_gatt_dm *)0)->db_hash) + sizeof(uint16_t) + \
+	 CONFIG_BT_GATT_DM_MAX_ATTRS * CACHE_ATTR_MAX_LEN)
+
+NET_BUF_SIMPLE_DEFINE_STATIC(cache_buf, CACHE_DATA_MAX_LEN);
+
+/* The entry is written to the settings storage from the work queue, so it is serialized
+ * into a separate buffer that is owned by the store work until it completes.
+ */
+NET_BUF_SIMPLE_DEFINE_STATIC(cache_store_buf, CACHE_DATA_MAX_LEN);
+static char cache_store_key[CACHE_KEY_LEN];
+static atomic_t cache_store_busy;
+
+union cache_uuid {
+	struct bt_uuid uuid;
+	struct bt_uuid_16 u16;
+	struct bt_uuid_32 u32;
+	struct bt_uuid_128 u128;
+};
+
+static void cache_addr_key(char *key, size_t key_len, uint8_t id, const bt_addr_le_t *addr)
+{
+	snprintf(key, key_len, CACHE_SUBTREE "/%u/%02x%02x%02x%02x%02x%02x%u", id,
+		 addr->a.val[5], addr->a.val[4], addr->a.val[3],
+		 addr->a.val[2], addr->a.val[1], addr->a.val[0], addr->type);
+}
+
+static void cache_key(struct bt_gatt_dm *dm, char *key, size_t key_len)
+{
+	size_t len;
+
+	cache_addr_key(key, key_len, dm->local_id, &dm->peer_addr);
+	len = strlen(key);
+	key[len++] = '/';
+	bt_uuid_to_str(&dm->svc_uuid.uuid, &key[len], key_len - len);
+}
+
+static bool cache_usable(struct bt_gatt_dm *dm)
+{
+	struct bt_conn_info info;
+
+	/* Only services searched by UUID are cached. The Database Hash can only be trusted
+	 * across connections if the peer is bonded.
+	 */
+	if (!dm->search_svc_by_uuid) {
+		return false;
+	}
+
+	if (bt_conn_get_info(dm->conn, &info) || (info.type != BT_CONN_TYPE_LE)) {
+		return false;
+	}
+
+	if (!bt_le_bond_exists(info.id, info.le.dst)) {
+		return false;
+	}
+
+	dm->local_id = info.id;
+	bt_addr_le_copy(&dm->peer_addr, info.le.dst);
+
+	return true;
+}
+
+static void cache_uuid_add(struct net_buf_simple *buf, const struct bt_uuid *uuid)
+{
+	net_buf_simple_add_u8(buf, uuid->type);
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		net_buf_simple_add_le16(buf, BT_UUID_16(uuid)->val);
+		break;
+	case BT_UUID_TYPE_32:
+		net_buf_simple_add_le32(buf, BT_UUID_32(uuid)->val);
+		break;
+	case BT_UUID_TYPE_128:
+		net_buf_simple_add_mem(buf, BT_UUID_128(uuid)->val, BT_UUID_SIZE_128);
+		break;
+	default:
+		__ASSERT(false, "Unsupported UUID type.");
+		break;
+	}
+}
+
+static int cache_uuid_pull(struct net_buf_simple *buf, union cache_uuid *uuid)
+{
+	if (buf->len < sizeof(uint8_t)) {
+		return -EINVAL;
+	}
+
+	uuid->uuid.type = net_buf_simple_pull_u8(buf);
+
+	switch (uuid->uuid.type) {
+	case BT_UUID_TYPE_16:
+		if (buf->len < sizeof(uint16_t)) {
+			return -EINVAL;
+		}
+		uuid->u16.val = net_buf_simple_pull_le16(buf);
+		break;
+	case BT_UUID_TYPE_32:
+		if (buf->len < sizeof(uint32_t)) {
+			return -EINVAL;
+		}
+		uuid->u32.val = net_buf_simple_pull_le32(buf);
+		break;
+	case BT_UUID_TYPE_128:
+		if (buf->len < BT_UUID_SIZE_128) {
+			return -EINVAL;
+		}
+		memcpy(uuid->u128.val, net_buf_simple_pull_mem(buf, BT_UUID_SIZE_128),
+		       BT_UUID_SIZE_128);
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static void cache_store_work_fn(struct k_work *work)
+{
+	int err;
+
+	ARG_UNUSED(work);
+
+	err = settings_save_one(cache_store_key, cache_store_buf.data, cache_store_buf.len);
+	if (err) {
+		LOG_WRN("Failed to store discovery cache (err %d)", err);
+	} else {
+		LOG_DBG("Stored %u bytes of discovery cache", cache_store_buf.len);
+		cache_stats.stores++;
+	}
+
+	atomic_clear(&cache_store_busy);
+}
+
+static K_WORK_DEFINE(cache_store_work, cache_store_work_fn);
+
+static void cache_store(struct bt_gatt_dm *dm)
+{
+	struct net_buf_simple *buf = &cache_store_buf;
+
+	/* Discovery completes in the Bluetooth RX context, so the flash write is deferred.
+	 * If the previous entry is still being written, this one is skipped and stored
+	 * after the next discovery.
+	 */
+	if (!atomic_cas(&cache_store_busy, 0, 1)) {
+		LOG_DBG("Discovery cache store in progress, skipping");
+		return;
+	}
+
+	net_buf_simple_reset(buf);
+	net_buf_simple_add_mem(buf, dm->db_hash, sizeof(dm->db_hash));
+	net_buf_simple_add_le16(buf, dm->cur_attr_id);
+
+	for (size_t i = 0; i < dm->cur_attr_id; i++) {
+		const struct bt_gatt_dm_attr *attr = &dm->attrs[i];
+		const struct bt_gatt_service_val *service_val;
+		const struct bt_gatt_chrc *chrc;
+
+		net_buf_simple_add_le16(buf, attr->handle);
+		net_buf_simple_add_u8(buf, attr->perm);
+		cache_uuid_add(buf, attr->uuid);
+
+		service_val = bt_gatt_dm_attr_service_val(attr);
+		if (service_val) {
+			net_buf_simple_add_le16(buf, service_val->end_handle);
+			cache_uuid_add(buf, service_val->uuid);
+			continue;
+		}
+
+		chrc = bt_gatt_dm_attr_chrc_val(attr);
+		if (chrc) {
+			net_buf_simple_add_le16(buf, chrc->value_handle);
+			net_buf_simple_add_u8(buf, chrc->properties);
+			cache_uuid_add(buf, chrc->uuid);
+		}
+	}
+
+	cache_key(dm, cache_store_key, sizeof(cache_store_key));
+
+	dm_work_submit(&cache_store_work);
+}
+
+static int cache_load_cb(const char *key, size_t len, settings_read_cb read_cb,
+			 void *cb_arg, void *param)
+{
+	ssize_t ret;
+
+	ARG_UNUSED(param);
+
+	if (settings_name_next(key, NULL) != 0) {
+		return 0;
+	}
+
+	net_buf_simple_reset(&cache_buf);
+	if (len > net_buf_simple_tailroom(&cache_buf)) {
+		return -ENOMEM;
+	}
+
+	ret = read_cb(cb_arg, cache_buf.data, len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	net_buf_simple_add(&cache_buf, ret);
+
+	return 0;
+}
+
+static int cache_attr_restore(struct bt_gatt_dm *dm, struct net_buf_simple *buf)
+{
+	union cache_uuid uuid;
+	union cache_uuid val_uuid;
+	struct bt_gatt_attr attr = {
+		.uuid = &uuid.uuid,
+	};
+	struct bt_gatt_dm_attr *cur_attr;
+	int err;
+
+	if (buf->len < sizeof(uint16_t) + sizeof(uint8_t)) {
+		return -EINVAL;
+	}
+
+	attr.handle = net_buf_simple_pull_le16(buf);
+	attr.perm = net_buf_simple_pull_u8(buf);
+
+	err = cache_uuid_pull(buf, &uuid);
+	if (err) {
+		return err;
+	}
+
+	if (!bt_uuid_cmp(&uuid.uuid, BT_UUID_GATT_PRIMARY) ||
+	    !bt_uuid_cmp(&uuid.uuid, BT_UUID_GATT_SECONDARY)) {
+		struct bt_gatt_service_val *service_val;
+
+		cur_attr = attr_store(dm, &attr, sizeof(*service_val));
+		if (!cur_attr || (buf->len < sizeof(uint16_t))) {
+			return -ENOMEM;
+		}
+
+		service_val = bt_gatt_dm_attr_service_val(cur_attr);
+		service_val->end_handle = net_buf_simple_pull_le16(buf);
+
+		err = cache_uuid_pull(buf, &val_uuid);
+		if (err) {
+			return err;
+		}
+
+		service_val->uuid = uuid_store(dm, &val_uuid.uuid);
+		if (!service_val->uuid) {
+			return -ENOMEM;
+		}
+
+		dm->discover_params.end_handle = service_val->end_handle;
+	} else if (!bt_uuid_cmp(&uuid.uuid, BT_UUID_GATT_CHRC)) {
+		struct bt_gatt_chrc *chrc;
+
+		cur_attr = attr_store(dm, &attr, sizeof(*chrc));
+		if (!cur_attr || (buf->len < sizeof(uint16_t) + sizeof(uint8_t))) {
+			return -ENOMEM;
+		}
+
+		chrc = bt_gatt_dm_attr_chrc_val(cur_attr);
+		chrc->value_handle = net_buf_simple_pull_le16(buf);
+		chrc->properties = net_buf_simple_pull_u8(buf);
+
+		err = cache_uuid_pull(buf, &val_uuid);
+		if (err) {
+			return err;
+		}
+
+		chrc->uuid = uuid_store(dm, &val_uuid.uuid);
+		if (!chrc->uuid) {
+			return -ENOMEM;
+		}
+	} else {
+		cur_attr = attr_store(dm, &attr, 0);
+		if (!cur_attr) {
+			return -ENOMEM;
+		}
+	}
+
+	return 0;
+}
+
+static bool cache_restore(struct bt_gatt_dm *dm)
+{
+	char key[CACHE_KEY_LEN];
+	uint16_t attr_count;
+	int err;
+
+	cache_key(dm, key, sizeof(key));
+
+	net_buf_simple_reset(&cache_buf);
+	err = settings_load_subtree_direct(key, cache_load_cb, NULL);
+	if (err || (cache_buf.len < sizeof(dm->db_hash) + sizeof(uint16_t))) {
+		return false;
+	}
+
+	if (memcmp(net_buf_simple_pull_mem(&cache_buf, sizeof(dm->db_hash)), dm->db_hash,
+		   sizeof(dm->db_hash))) {
+		LOG_DBG("Database Hash changed, discovery cache is outdated");
+		return false;
+	}
+
+	attr_count = net_buf_simple_pull_le16(&cache_buf);
+	if ((attr_count == 0) || (attr_count > ARRAY_SIZE(dm->attrs))) {
+		return false;
+	}
+
+	for (size_t i = 0; i < attr_count; i++) {
+		err = cache_attr_restore(dm, &cache_buf);
+		if (err) {
+			LOG_WRN("Invalid discovery cache (err %d)", err);
+			svc_attr_memory_release(dm);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void gatt_cache_work(struct k_work *work)
+{
+	struct bt_gatt_dm *dm = CONTAINER_OF(work, struct bt_gatt_dm, cache_work);
+	int err;
+
+	if (dm->db_hash_valid && cache_restore(dm)) {
+		LOG_DBG("Service restored from the discovery cache");
+		cache_stats.hits++;
+		dm->from_cache = true;
+		discovery_complete(dm);
+		return;
+	}
+
+	cache_stats.misses++;
+
+	err = bt_gatt_discover(dm->conn, &dm->discover_params);
+	if (err) {
+		LOG_ERR("Discover failed, error: %d.", err);
+		discovery_complete_error(dm, err);
+	}
+}
+
+static uint8_t db_hash_read_cb(struct bt_conn *conn, uint8_t err,
+			       struct bt_gatt_read_params *params,
+			       const void *data, uint16_t length)
+{
+	struct bt_gatt_dm *dm = CONTAINER_OF(params, struct bt_gatt_dm, read_params);
+
+	if (!err && data && (length == sizeof(dm->db_hash))) {
+		memcpy(dm->db_hash, data, sizeof(dm->db_hash));
+		dm->db_hash_valid = true;
+	} else if (err) {
+		LOG_DBG("Database Hash read failed (err %u)", err);
+	}
+
+	dm_work_submit(&dm->cache_work);
+
+	return BT_GATT_ITER_STOP;
+}
+
+static int cache_discover_start(struct bt_gatt_dm *dm)
+{
+	dm->read_params.func = db_hash_read_cb;
+	dm->read_params.handle_count = 0;
+	dm->read_params.by_uuid.uuid = BT_UUID_GATT_DB_HASH;
+	dm->read_params.by_uuid.start_handle = BT_ATT_FIRST_ATTRIBUTE_HANDLE;
+	dm->read_params.by_uuid.end_handle = BT_ATT_LAST_ATTRIBUTE_HANDLE;
+
+	return bt_gatt_read(dm->conn, &dm->read_params);
+}
+
+static int cache_bond_key_cb(const char *key, size_t len, settings_read_cb read_cb,
+			     void *cb_arg, void *param)
+{
+	char *name = param;
+
+	ARG_UNUSED(read_cb);
+	ARG_UNUSED(cb_arg);
+
+	/* Skip deleted entries. */
+	if (!key || (len == 0)) {
+		return 0;
+	}
+
+	strncpy(name, key, CACHE_KEY_LEN - 1);
+	name[CACHE_KEY_LEN - 1] = '\0';
+
+	/* Stop the iteration, entries are deleted one by one. */
+	return 1;
+}
+
+static void bond_deleted(uint8_t id, const bt_addr_le_t *peer)
+{
+	char subtree[CACHE_KEY_LEN];
+	char key[CACHE_KEY_LEN];
+	char name[CACHE_KEY_LEN];
+	int len;
+
+	if (bt_addr_le_eq(peer, BT_ADDR_LE_ANY)) {
+		snprintf(subtree, sizeof(subtree), CACHE_SUBTREE "/%u", id);
+	} else {
+		cache_addr_key(subtree, sizeof(subtree), id, peer);
+	}
+
+	while (true) {
+		name[0] = '\0';
+		(void)settings_load_subtree_direct(subtree, cache_bond_key_cb, name);
+		if (name[0] == '\0') {
+			break;
+		}
+
+		len = snprintf(key, sizeof(key), "%s/%s", subtree, name);
+		if ((len < 0) || (len >= sizeof(key)) || settings_delete(key)) {
+			LOG_WRN("Failed to delete discovery cache entry");
+			break;
+		}
+	}
+}
+
+static struct bt_conn_auth_info_cb cache_auth_info_cb = {
+	.bond_deleted = bond_deleted,
+};
+
+static int gatt_dm_cache_init(void)
+{
+	return bt_conn_auth_info_cb_register(&cache_auth_info_cb);
+}
+
+SYS_INIT(gatt_dm_cache_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
+void bt_gatt_dm_cache_stats_get(struct bt_gatt_dm_cache_stats *stats)
+{
+	*stats = cache_stats;
+}
+
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 static uint8_t discovery_process_service(struct bt_gatt_dm *dm,
 				      const struct bt_gatt_attr *attr,
 				      struct bt_gatt_discover_params *params)
@@ -679,6 +1178,24 @@ int bt_gatt_dm_start(struct bt_conn *conn,
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
 	k_work_init(&dm->discover_work, gatt_discover_work);
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	k_work_init(&dm->cache_work, gatt_cache_work);
+	dm->db_hash_valid = false;
+	dm->from_cache = false;
+	dm->start_time = k_uptime_get();
+
+	if (cache_usable(dm)) {
+		/* The discovery is started once the Database Hash is read. */
+		err = cache_discover_start(dm);
+		if (!err) {
+			return 0;
+		}
+
+		LOG_WRN("Database Hash read failed, error: %d.", err);
+		cache_stats.misses++;
+	}
+#endif
+
 	err = bt_gatt_discover(conn, &dm->discover_params);
 	if (err) {
 		LOG_ERR("Discover failed, error: %d.", err);
@@ -740,6 +1257,9 @@ int bt_gatt_dm_data_release(struct bt_gatt_dm *dm)
 	}
 
 	k_work_cancel(&dm->discover_work);
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	k_work_cancel(&dm->cache_work);
+#endif
 	svc_attr_memory_release(dm);
 	atomic_clear_bit(dm->state_flags, STATE_ATTRS_LOCKED);
 
@@ -5,6 +5,8 @@
  */
 
 #include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
 #include <bluetooth/gatt_pool.h>
 #include <zephyr/logging/log.h>
 
@@ -12,228 +14,343 @@ LOG_MODULE_REGISTER(bt_gatt_pool, CONFIG_BT_GATT_POOL_LOG_LEVEL);
 
 
 struct svc_el_pool {
+	const char *name;
 	void *elements;
 	atomic_t *locks;
+	size_t el_size;
+	size_t el_cnt;
+	/* Reference counts of the shared UUIDs, NULL if the elements are not shared. */
+	uint8_t *refs;
+#if CONFIG_BT_GATT_POOL_STATS != 0
+	atomic_t used;
+	atomic_t max_used;
+#endif
 };
 
+#define SVC_EL_POOL_INIT(_name, _tab, _locks, _refs)                           \
+	{                                                                      \
+		.name = _name,                                                 \
+		.elements = _tab,                                              \
+		.locks = _locks,                                               \
+		.el_size = sizeof(_tab[0]),                                    \
+		.el_cnt = ARRAY_SIZE(_tab),                                    \
+		.refs = _refs,                                                 \
+	}
+
+#define SVC_EL_POOL_EMPTY(_name) { .name = _name }
+
+#if CONFIG_BT_GATT_POOL_UUID_DEDUP
+#define UUID_REFS_DEFINE(_name, _cnt) static uint8_t _name[_cnt]
+#define UUID_REFS(_name) _name
+#else
+#define UUID_REFS_DEFINE(_name, _cnt)
+#define UUID_REFS(_name) NULL
+#endif
+
 #if CONFIG_BT_GATT_UUID16_POOL_SIZE != 0
 static struct bt_uuid_16 uuid_16_tab[CONFIG_BT_GATT_UUID16_POOL_SIZE];
 static ATOMIC_DEFINE(uuid_16_locks, ARRAY_SIZE(uuid_16_tab));
-#define BT_UUID_16_TAB uuid_16_tab
-#define BT_UUID_16_LOCKS uuid_16_locks
+UUID_REFS_DEFINE(uuid_16_refs, ARRAY_SIZE(uuid_16_tab));
+static struct svc_el_pool uuid_16_pool =
+	SVC_EL_POOL_INIT("UUID16s", uuid_16_tab, uuid_16_locks, UUID_REFS(uuid_16_refs));
 #else
-#define BT_UUID_16_TAB NULL
-#define BT_UUID_16_LOCKS NULL
+static struct svc_el_pool uuid_16_pool = SVC_EL_POOL_EMPTY("UUID16s");
 #endif
 
 #if CONFIG_BT_GATT_UUID32_POOL_SIZE != 0
 static struct bt_uuid_32 uuid_32_tab[CONFIG_BT_GATT_UUID32_POOL_SIZE];
 static ATOMIC_DEFINE(uuid_32_locks, ARRAY_SIZE(uuid_32_tab));
-#define BT_UUID_32_TAB uuid_32_tab
-#define BT_UUID_32_LOCKS uuid_32_locks
+UUID_REFS_DEFINE(uuid_32_refs, ARRAY_SIZE(uuid_32_tab));
+static struct svc_el_pool uuid_32_pool =
+	SVC_EL_POOL_INIT("UUID32s", uuid_32_tab, uuid_32_locks, UUID_REFS(uuid_32_refs));
 #else
-#define BT_UUID_32_TAB NULL
-#define BT_UUID_32_LOCKS NULL
+static struct svc_el_pool uuid_32_pool = SVC_EL_POOL_EMPTY("UUID32s");
 #endif
 
 #if CONFIG_BT_GATT_UUID128_POOL_SIZE != 0
 static struct bt_uuid_128 uuid_128_tab[CONFIG_BT_GATT_UUID128_POOL_SIZE];
 static ATOMIC_DEFINE(uuid_128_locks, ARRAY_SIZE(uuid_128_tab));
-#define BT_UUID_128_TAB uuid_128_tab
-#define BT_UUID_128_LOCKS uuid_128_locks
+UUID_REFS_DEFINE(uuid_128_refs, ARRAY_SIZE(uuid_128_tab));
+static struct svc_el_pool uuid_128_pool =
+	SVC_EL_POOL_INIT("UUID128s", uuid_128_tab, uuid_128_locks, UUID_REFS(uuid_128_refs));
 #else
-#define BT_UUID_128_TAB NULL
-#define BT_UUID_128_LOCKS NULL
+static struct svc_el_pool uuid_128_pool = SVC_EL_POOL_EMPTY("UUID128s");
 #endif
 
 #if CONFIG_BT_GATT_CHRC_POOL_SIZE != 0
 static struct bt_gatt_chrc chrc_tab[CONFIG_BT_GATT_CHRC_POOL_SIZE];
 static ATOMIC_DEFINE(chrc_locks, ARRAY_SIZE(chrc_tab));
-#define BT_GATT_CHRC_TAB chrc_tab
-#define BT_GATT_CHRC_LOCKS chrc_locks
+static struct svc_el_pool chrc_pool =
+	SVC_EL_POOL_INIT("chrc descriptors", chrc_tab, chrc_locks, NULL);
 #else
-#define BT_GATT_CHRC_TAB NULL
-#define BT_GATT_CHRC_LOCKS NULL
+static struct svc_el_pool chrc_pool = SVC_EL_POOL_EMPTY("chrc descriptors");
 #endif
 
-static struct svc_el_pool uuid_16_pool = {
-	.elements = BT_UUID_16_TAB,
-	.locks = BT_UUID_16_LOCKS,
-};
-static struct svc_el_pool uuid_32_pool = {
-	.elements = BT_UUID_32_TAB,
-	.locks = BT_UUID_32_LOCKS,
-};
-static struct svc_el_pool uuid_128_pool = {
-	.elements = BT_UUID_128_TAB,
-	.locks = BT_UUID_128_LOCKS,
+#if CONFIG_BT_GATT_POOL_UUID_DEDUP
+/* Serializes the lookup of a shared UUID with the release of its last reference. */
+static struct k_spinlock uuid_lock;
+#endif
+
+#if CONFIG_BT_GATT_POOL_ATTR_SLABS
+#define ATTR_SLAB_DEFINE(_name, _attr_cnt, _cnt)                               \
+	K_MEM_SLAB_DEFINE_STATIC(_name, sizeof(struct bt_gatt_attr) * (_attr_cnt), \
+				 _cnt, sizeof(void *))
+
+#if CONFIG_BT_GATT_POOL_ATTR_SLAB_SMALL_COUNT != 0
+ATTR_SLAB_DEFINE(attr_slab_small, CONFIG_BT_GATT_POOL_ATTR_SLAB_SMALL_SIZE,
+		 CONFIG_BT_GATT_POOL_ATTR_SLAB_SMALL_COUNT);
+#endif
+#if CONFIG_BT_GATT_POOL_ATTR_SLAB_MEDIUM_COUNT != 0
+ATTR_SLAB_DEFINE(attr_slab_medium, CONFIG_BT_GATT_POOL_ATTR_SLAB_MEDIUM_SIZE,
+		 CONFIG_BT_GATT_POOL_ATTR_SLAB_MEDIUM_COUNT);
+#endif
+#if CONFIG_BT_GATT_POOL_ATTR_SLAB_LARGE_COUNT != 0
+ATTR_SLAB_DEFINE(attr_slab_large, CONFIG_BT_GATT_POOL_ATTR_SLAB_LARGE_SIZE,
+		 CONFIG_BT_GATT_POOL_ATTR_SLAB_LARGE_COUNT);
+#endif
+
+struct attr_slab_class {
+	struct k_mem_slab *slab;
+	size_t attr_cnt;
 };
-static struct svc_el_pool chrc_pool = {
-	.elements = BT_GATT_CHRC_TAB,
-	.locks = BT_GATT_CHRC_LOCKS,
+
+/* Size classes in ascending order of the number of attributes. */
+static const struct attr_slab_class attr_slab_classes[] = {
+#if CONFIG_BT_GATT_POOL_ATTR_SLAB_SMALL_COUNT != 0
+	{ &attr_slab_small, CONFIG_BT_GATT_POOL_ATTR_SLAB_SMALL_SIZE },
+#endif
+#if CONFIG_BT_GATT_POOL_ATTR_SLAB_MEDIUM_COUNT != 0
+	{ &attr_slab_medium, CONFIG_BT_GATT_POOL_ATTR_SLAB_MEDIUM_SIZE },
+#endif
+#if CONFIG_BT_GATT_POOL_ATTR_SLAB_LARGE_COUNT != 0
+	{ &attr_slab_large, CONFIG_BT_GATT_POOL_ATTR_SLAB_LARGE_SIZE },
+#endif
 };
+#endif /* CONFIG_BT_GATT_POOL_ATTR_SLABS */
 
 static struct bt_uuid const * const uuid_primary = BT_UUID_GATT_PRIMARY;
 static struct bt_uuid const * const uuid_chrc = BT_UUID_GATT_CHRC;
 static struct bt_uuid const * const uuid_ccc = BT_UUID_GATT_CCC;
 
-#define EL_IN_POOL_VERIFY(pool, el)                                            \
-	do {                                                                   \
-		__ASSERT(pool != NULL, "Pool is uninitialized");               \
-		__ASSERT(((uint32_t)el >= (uint32_t)pool) &&                         \
-			     (((uint32_t)el) < (((uint32_t)pool) + sizeof(pool))),   \
-			 "Element does not belong to the pool");               \
-	} while ((0))
-
-#define ADDR_2_INDEX(pool, el)                                                 \
-	((((uint32_t)el) - ((uint32_t)pool)) / (sizeof(pool[0])))
+static void *el_addr(struct svc_el_pool *el_pool, size_t ind)
+{
+	return (uint8_t *)el_pool->elements + ind * el_pool->el_size;
+}
 
-static size_t free_element_find(struct svc_el_pool *el_pool, size_t el_cnt)
+static size_t el_index(struct svc_el_pool *el_pool, void const *el)
 {
-	__ASSERT((el_pool->elements != NULL) && (el_pool->locks != NULL),
-		 "Pool uninitialized");
+	size_t offset = (uint8_t const *)el - (uint8_t const *)el_pool->elements;
 
-	for (size_t i = 0; i < el_cnt; i++) {
-		if (!atomic_test_and_set_bit(el_pool->locks, i)) {
-			return i;
-		}
-	}
-	return el_cnt;
+	__ASSERT(el_pool->elements != NULL, "Pool is uninitialized");
+	__ASSERT(((uint8_t const *)el >= (uint8_t const *)el_pool->elements) &&
+		 (offset < el_pool->el_size * el_pool->el_cnt) &&
+		 ((offset % el_pool->el_size) == 0),
+		 "Element does not belong to the pool");
+
+	return offset / el_pool->el_size;
 }
 
-static int uuid_16_get(struct bt_uuid **uuid, struct svc_el_pool *uuid_pool)
+static void el_stats_take(struct svc_el_pool *el_pool)
 {
-	size_t ind = free_element_find(uuid_pool,
-				       CONFIG_BT_GATT_UUID16_POOL_SIZE);
+#if CONFIG_BT_GATT_POOL_STATS != 0
+	atomic_val_t used = atomic_inc(&el_pool->used) + 1;
+	atomic_val_t max_used = atomic_get(&el_pool->max_used);
 
-	if (ind >= CONFIG_BT_GATT_UUID16_POOL_SIZE) {
-		LOG_ERR("No more UUID16s in the pool!");
-		return -ENOMEM;
+	while ((used > max_used) &&
+	       !atomic_cas(&el_pool->max_used, max_used, used)) {
+		max_used = atomic_get(&el_pool->max_used);
 	}
+#endif
+}
 
-	*uuid = (struct bt_uuid *)
-		&((struct bt_uuid_16 *) uuid_pool->elements)[ind];
-	return 0;
+static void el_stats_release(struct svc_el_pool *el_pool)
+{
+#if CONFIG_BT_GATT_POOL_STATS != 0
+	atomic_dec(&el_pool->used);
+#endif
 }
 
-static int uuid_32_get(struct bt_uuid **uuid, struct svc_el_pool *uuid_pool)
+static size_t free_element_find(struct svc_el_pool *el_pool)
 {
-	size_t ind = free_element_find(uuid_pool,
-				       CONFIG_BT_GATT_UUID32_POOL_SIZE);
+	size_t el_cnt = el_pool->el_cnt;
 
-	if (ind >= CONFIG_BT_GATT_UUID32_POOL_SIZE) {
-		LOG_ERR("No more UUID32s in the pool!");
-		return -ENOMEM;
+	if (el_cnt == 0) {
+		return 0;
 	}
 
-	*uuid = (struct bt_uuid *)
-		&((struct bt_uuid_32 *) uuid_pool->elements)[ind];
-	return 0;
+	__ASSERT((el_pool->elements != NULL) && (el_pool->locks != NULL),
+		 "Pool uninitialized");
+
+	/* Claim the lowest clear bit of each bitmap word instead of testing
+	 * the bits one by one.
+	 */
+	for (size_t word = 0; word < ATOMIC_BITMAP_SIZE(el_cnt); word++) {
+		atomic_val_t val = atomic_get(&el_pool->locks[word]);
+
+		while (~val) {
+			unsigned int bit = __builtin_ctzl(~(unsigned long)val);
+			size_t ind = word * ATOMIC_BITS + bit;
+
+			if (ind >= el_cnt) {
+				break;
+			}
+
+			if (atomic_cas(&el_pool->locks[word], val,
+				       val | ((atomic_val_t)1 << bit))) {
+				el_stats_take(el_pool);
+				return ind;
+			}
+
+			val = atomic_get(&el_pool->locks[word]);
+		}
+	}
+
+	return el_cnt;
 }
 
-static int uuid_128_get(struct bt_uuid **uuid, struct svc_el_pool *uuid_pool)
+static void *el_get(struct svc_el_pool *el_pool)
 {
-	size_t ind = free_element_find(uuid_pool,
-				       CONFIG_BT_GATT_UUID128_POOL_SIZE);
+	size_t ind = free_element_find(el_pool);
 
-	if (ind >= CONFIG_BT_GATT_UUID128_POOL_SIZE) {
-		LOG_ERR("No more UUID128s in the pool!");
-		return -ENOMEM;
+	if (ind >= el_pool->el_cnt) {
+		LOG_ERR("No more %s in the pool!", el_pool->name);
+		return NULL;
 	}
 
-	*uuid = (struct bt_uuid *)
-		&((struct bt_uuid_128 *) uuid_pool->elements)[ind];
-	return 0;
+	return el_addr(el_pool, ind);
 }
 
-static int chrc_get(struct bt_gatt_chrc **chrc)
+static void el_release(struct svc_el_pool *el_pool, void const *el)
 {
-	size_t ind = free_element_find(&chrc_pool,
-				       CONFIG_BT_GATT_CHRC_POOL_SIZE);
+	atomic_clear_bit(el_pool->locks, el_index(el_pool, el));
+	el_stats_release(el_pool);
+}
 
-	if (ind >= CONFIG_BT_GATT_CHRC_POOL_SIZE) {
-		LOG_ERR("No more chrc descriptors in the pool!");
+static int chrc_get(struct bt_gatt_chrc **chrc)
+{
+	*chrc = el_get(&chrc_pool);
+	if (!*chrc) {
 		return -ENOMEM;
 	}
 
-	*chrc = &((struct bt_gatt_chrc *) chrc_pool.elements)[ind];
 	return 0;
 }
 
 static void chrc_release(struct bt_gatt_chrc const *chrc)
 {
-	EL_IN_POOL_VERIFY(BT_GATT_CHRC_TAB, chrc);
-	atomic_clear_bit(chrc_pool.locks,
-			 ADDR_2_INDEX(BT_GATT_CHRC_TAB, chrc));
+	el_release(&chrc_pool, chrc);
 }
 
+static struct svc_el_pool *uuid_pool_get(uint8_t type)
+{
+	switch (type) {
+	case BT_UUID_TYPE_16:
+		return &uuid_16_pool;
+	case BT_UUID_TYPE_32:
+		return &uuid_32_pool;
+	case BT_UUID_TYPE_128:
+		return &uuid_128_pool;
+	default:
+		return NULL;
+	}
+}
+
+#if CONFIG_BT_GATT_POOL_UUID_DEDUP
+static struct bt_uuid *uuid_shared_find(struct svc_el_pool *uuid_pool,
+					struct bt_uuid const *src_uuid)
+{
+	for (size_t word = 0; word < ATOMIC_BITMAP_SIZE(uuid_pool->el_cnt); word++) {
+		unsigned long val = atomic_get(&uuid_pool->locks[word]);
+
+		while (val) {
+			unsigned int bit = __builtin_ctzl(val);
+			size_t ind = word * ATOMIC_BITS + bit;
+			struct bt_uuid *uuid = el_addr(uuid_pool, ind);
+
+			val &= val - 1;
+
+			/* A saturated element is not shared any further. */
+			if ((uuid_pool->refs[ind] != UINT8_MAX) &&
+			    !bt_uuid_cmp(uuid, src_uuid)) {
+				uuid_pool->refs[ind]++;
+				return uuid;
+			}
+		}
+	}
+
+	return NULL;
+}
+#endif
+
 static int uuid_register(struct bt_uuid **dest_uuid,
 			 struct bt_uuid const *src_uuid)
 {
-	int ret = -EINVAL;
+	struct svc_el_pool *uuid_pool = uuid_pool_get(src_uuid->type);
+	struct bt_uuid *uuid;
 
 	__ASSERT(*dest_uuid == NULL, "Overriding attribute UUID!");
 
-	switch (src_uuid->type) {
-	case BT_UUID_TYPE_16:
-		ret = uuid_16_get(dest_uuid, &uuid_16_pool);
-		if (!ret) {
-			memcpy(*dest_uuid, src_uuid, sizeof(struct bt_uuid_16));
-		}
-		break;
+	if (!uuid_pool) {
+		LOG_ERR("Unknown UUID type");
+		return -EINVAL;
+	}
 
-	case BT_UUID_TYPE_32:
-		ret = uuid_32_get(dest_uuid, &uuid_32_pool);
-		if (!ret) {
-			memcpy(*dest_uuid, src_uuid, sizeof(struct bt_uuid_32));
-		}
-		break;
+#if CONFIG_BT_GATT_POOL_UUID_DEDUP
+	k_spinlock_key_t key = k_spin_lock(&uuid_lock);
 
-	case BT_UUID_TYPE_128:
-		ret = uuid_128_get(dest_uuid, &uuid_128_pool);
-		if (!ret) {
-			memcpy(*dest_uuid, src_uuid,
-			       sizeof(struct bt_uuid_128));
-		}
-		break;
+	uuid = uuid_shared_find(uuid_pool, src_uuid);
+	if (uuid) {
+		k_spin_unlock(&uuid_lock, key);
+		*dest_uuid = uuid;
+		return 0;
+	}
+#endif
 
-	default:
-		LOG_ERR("Unknown UUID type");
-		break;
+	uuid = el_get(uuid_pool);
+	if (uuid) {
+		memcpy(uuid, src_uuid, uuid_pool->el_size);
+#if CONFIG_BT_GATT_POOL_UUID_DEDUP
+		uuid_pool->refs[el_index(uuid_pool, uuid)] = 1;
+#endif
 	}
-	return ret;
+
+#if CONFIG_BT_GATT_POOL_UUID_DEDUP
+	k_spin_unlock(&uuid_lock, key);
+#endif
+
+	if (!uuid) {
+		return -ENOMEM;
+	}
+
+	*dest_uuid = uuid;
+	return 0;
 }
 
 static void uuid_unregister(struct bt_uuid const *uuid)
 {
-	switch (uuid->type) {
-	case BT_UUID_TYPE_16:
-		EL_IN_POOL_VERIFY(BT_UUID_16_TAB, uuid);
-#if CONFIG_BT_GATT_UUID16_POOL_SIZE != 0
-		atomic_clear_bit(uuid_16_pool.locks,
-				 ADDR_2_INDEX(BT_UUID_16_TAB, uuid));
-#endif
-		break;
+	struct svc_el_pool *uuid_pool = uuid_pool_get(uuid->type);
 
-	case BT_UUID_TYPE_32:
-		EL_IN_POOL_VERIFY(BT_UUID_32_TAB, uuid);
-#if CONFIG_BT_GATT_UUID32_POOL_SIZE != 0
-		atomic_clear_bit(uuid_32_pool.locks,
-				 ADDR_2_INDEX(BT_UUID_32_TAB, uuid));
-#endif
-		break;
+	if (!uuid_pool) {
+		__ASSERT(false, "Unknown UUID type");
+		return;
+	}
 
-	case BT_UUID_TYPE_128:
-		EL_IN_POOL_VERIFY(BT_UUID_128_TAB, uuid);
-#if CONFIG_BT_GATT_UUID128_POOL_SIZE != 0
-		atomic_clear_bit(uuid_128_pool.locks,
-				 ADDR_2_INDEX(BT_UUID_128_TAB, uuid));
-#endif
-		break;
+#if CONFIG_BT_GATT_POOL_UUID_DEDUP
+	size_t ind = el_index(uuid_pool, uuid);
+	k_spinlock_key_t key = k_spin_lock(&uuid_lock);
 
-	default:
-		__ASSERT(false, "Unknown UUID type");
+	__ASSERT_NO_MSG(uuid_pool->refs[ind] != 0);
+
+	if (--uuid_pool->refs[ind] != 0) {
+		k_spin_unlock(&uuid_lock, key);
+		return;
 	}
+
+	el_release(uuid_pool, uuid);
+	k_spin_unlock(&uuid_lock, key);
+#else
+	el_release(uuid_pool, uuid);
+#endif
 }
 
 /** @brief Free a single attribute.
@@ -418,63 +535,103 @@ void bt_gatt_pool_free(struct bt_gatt_pool *gp)
 	gp->svc.attr_count = 0;
 }
 
-
-#if CONFIG_BT_GATT_POOL_STATS != 0
-static size_t mask_print(atomic_t *mask, size_t mask_size)
+#if CONFIG_BT_GATT_POOL_ATTR_SLABS
+int bt_gatt_pool_attrs_alloc(struct bt_gatt_pool *gp, size_t attr_count)
 {
-	size_t used_el_cnt = 0;
+	void *attrs;
+
+	if (!gp || gp->svc.attrs || !attr_count) {
+		LOG_ERR("Invalid attribute");
+		return -EINVAL;
+	}
+
+	/* Use the smallest size class that can hold the requested number of attributes
+	 * and fall back to a larger one if it is exhausted.
+	 */
+	for (size_t i = 0; i < ARRAY_SIZE(attr_slab_classes); i++) {
+		const struct attr_slab_class *size_class = &attr_slab_classes[i];
 
-	for (size_t i = 0; i < mask_size; i++) {
-		uint32_t state_part = mask[mask_size - i - 1];
+		if (size_class->attr_cnt < attr_count) {
+			continue;
+		}
+
+		if (k_mem_slab_alloc(size_class->slab, &attrs, K_NO_WAIT)) {
+			continue;
+		}
 
-		printk("%08X", state_part);
-		used_el_cnt += popcount(state_part);
+		memset(attrs, 0, sizeof(struct bt_gatt_attr) * size_class->attr_cnt);
+
+		gp->svc.attrs = attrs;
+		gp->svc.attr_count = 0;
+		gp->attr_array_size = size_class->attr_cnt;
+		gp->attr_slab = size_class->slab;
+
+		return 0;
 	}
-	return used_el_cnt;
+
+	LOG_ERR("No attribute array for %zu attributes in the pool!", attr_count);
+	return -ENOMEM;
 }
 
-void bt_gatt_pool_stats_print(void)
+void bt_gatt_pool_attrs_free(struct bt_gatt_pool *gp)
 {
-	size_t used_el_cnt;
+	if (!gp || !gp->attr_slab) {
+		LOG_ERR("Attribute array was not allocated from the pool");
+		return;
+	}
 
-#if CONFIG_BT_GATT_UUID16_POOL_SIZE != 0
-	printk("UUID 16 Pool. Locked elements mask:\n");
+	bt_gatt_pool_free(gp);
 
-	used_el_cnt = mask_print(BT_UUID_16_LOCKS,
-				 ARRAY_SIZE(BT_UUID_16_LOCKS));
+	k_mem_slab_free(gp->attr_slab, gp->svc.attrs);
 
-	printk("\nPool element usage: %d out of %d\n\n", used_el_cnt,
-	       CONFIG_BT_GATT_UUID16_POOL_SIZE);
-#endif
+	gp->svc.attrs = NULL;
+	gp->attr_array_size = 0;
+	gp->attr_slab = NULL;
+}
+#endif /* CONFIG_BT_GATT_POOL_ATTR_SLABS */
 
-#if CONFIG_BT_GATT_UUID32_POOL_SIZE != 0
-	printk("UUID 32 Pool. Locked elements mask:\n");
+#if CONFIG_BT_GATT_POOL_STATS != 0
+static void el_pool_stats_get(struct svc_el_pool *el_pool,
+			      struct bt_gatt_pool_el_stats *stats)
+{
+	stats->size = el_pool->el_cnt;
+	stats->used = atomic_get(&el_pool->used);
+	stats->max_used = atomic_get(&el_pool->max_used);
+}
 
-	used_el_cnt = mask_print(BT_UUID_32_LOCKS,
-				 ARRAY_SIZE(BT_UUID_32_LOCKS));
+void bt_gatt_pool_stats_get(struct bt_gatt_pool_stats *stats)
+{
+	el_pool_stats_get(&uuid_16_pool, &stats->uuid_16);
+	el_pool_stats_get(&uuid_32_pool, &stats->uuid_32);
+	el_pool_stats_get(&uuid_128_pool, &stats->uuid_128);
+	el_pool_stats_get(&chrc_pool, &stats->chrc);
+}
 
-	printk("\nPool element usage: %d out of %d\n\n", used_el_cnt,
-	       CONFIG_BT_GATT_UUID32_POOL_SIZE);
-#endif
+static void el_pool_stats_print(struct svc_el_pool *el_pool)
+{
+	struct bt_gatt_pool_el_stats stats;
 
-#if CONFIG_BT_GATT_UUID128_POOL_SIZE != 0
-	printk("UUID 128 Pool. Locked elements mask:\n");
+	if (el_pool->el_cnt == 0) {
+		return;
+	}
 
-	used_el_cnt = mask_print(BT_UUID_128_LOCKS,
-				 ARRAY_SIZE(BT_UUID_128_LOCKS));
+	el_pool_stats_get(el_pool, &stats);
 
-	printk("\nPool element usage: %d out of %d\n\n", used_el_cnt,
-	       CONFIG_BT_GATT_UUID128_POOL_SIZE);
-#endif
+	printk("Pool of %s. Locked elements mask:\n", el_pool->name);
 
-#if CONFIG_BT_GATT_CHRC_POOL_SIZE != 0
-	printk("Characteristic Pool. Locked elements mask:\n");
+	for (size_t i = ATOMIC_BITMAP_SIZE(el_pool->el_cnt); i > 0; i--) {
+		printk("%08lX", (unsigned long)atomic_get(&el_pool->locks[i - 1]));
+	}
 
-	used_el_cnt = mask_print(BT_GATT_CHRC_LOCKS,
-				 ARRAY_SIZE(BT_GATT_CHRC_LOCKS));
+	printk("\nPool element usage: %u out of %u, maximum %u\n\n",
+	       stats.used, stats.size, stats.max_used);
+}
 
-	printk("\nPool element usage: %d out of %d\n\n", used_el_cnt,
-	       CONFIG_BT_GATT_CHRC_POOL_SIZE);
-#endif
+void bt_gatt_pool_stats_print(void)
+{
+	el_pool_stats_print(&uuid_16_pool);
+	el_pool_stats_print(&uuid_32_pool);
+	el_pool_stats_print(&uuid_128_pool);
+	el_pool_stats_print(&chrc_pool);
 }
 #endif /* CONFIG_BT_GATT_POOL_STATS */
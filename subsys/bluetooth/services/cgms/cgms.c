@@ -356,13 +356,11 @@ BT_GATT_SERVICE_DEFINE(cgms_svc,
 				BT_GATT_PERM_READ_AUTHEN | BT_GATT_PERM_WRITE_AUTHEN),
 );
 
-static void bt_cgms_notify_meas(struct bt_conn *conn, void *data)
+static void meas_encode(const struct cgms_meas *meas, struct net_buf_simple *meas_buf)
 {
-	struct cgms_meas *meas = (struct cgms_meas *)data;
 	uint8_t meas_size;
-	struct net_buf_simple *meas_buf = NET_BUF_SIMPLE(CGMS_MEAS_LENGTH);
 
-	net_buf_simple_init(meas_buf, sizeof(meas_size));
+	net_buf_simple_reserve(meas_buf, sizeof(meas_size));
 
 	net_buf_simple_add_u8(meas_buf, meas->flag);
 	net_buf_simple_add_le16(meas_buf, meas->glucose_concentration);
@@ -379,6 +377,15 @@ static void bt_cgms_notify_meas(struct bt_conn *conn, void *data)
 
 	meas_size = meas_buf->len + 1;
 	net_buf_simple_push_u8(meas_buf, meas_size);
+}
+
+static void bt_cgms_notify_meas(struct bt_conn *conn, void *data)
+{
+	struct cgms_meas *meas = (struct cgms_meas *)data;
+	struct net_buf_simple *meas_buf = NET_BUF_SIMPLE(CGMS_MEAS_LENGTH);
+
+	net_buf_simple_init(meas_buf, 0);
+	meas_encode(meas, meas_buf);
 
 	/* If conn is NULL, it implies this is a periodic notification.
 	 * Send it to all peers.
@@ -387,11 +394,11 @@ static void bt_cgms_notify_meas(struct bt_conn *conn, void *data)
 	 */
 	if (conn == NULL) {
 		bt_gatt_notify(NULL, &cgms_svc.attrs[CGMS_SVC_MEAS_ATTR_IDX],
-			meas_buf->data, meas_size);
+			meas_buf->data, meas_buf->len);
 	} else if (bt_gatt_is_subscribed(conn, &cgms_svc.attrs[CGMS_SVC_MEAS_ATTR_IDX],
 			BT_GATT_CCC_NOTIFY)) {
 		bt_gatt_notify(conn, &cgms_svc.attrs[CGMS_SVC_MEAS_ATTR_IDX],
-			meas_buf->data, meas_size);
+			meas_buf->data, meas_buf->len);
 	} else {
 		LOG_INF("Client disabled the measurement notification");
 	}
@@ -408,10 +415,42 @@ int cgms_racp_send_response(struct bt_conn *peer, struct net_buf_simple *rsp)
 	return bt_gatt_indicate(peer, &indicate_data);
 }
 
-int cgms_racp_send_record(struct bt_conn *peer, struct cgms_meas *entry)
+int cgms_racp_send_records(struct bt_conn *peer, const struct cgms_meas *entries, size_t count)
 {
-	bt_cgms_notify_meas(peer, entry);
-	return 0;
+	struct bt_gatt_notify_params params[CONFIG_BT_CGMS_RACP_REPORT_BATCH_SIZE];
+	struct net_buf_simple meas_buf[CONFIG_BT_CGMS_RACP_REPORT_BATCH_SIZE];
+	uint8_t meas_data[CONFIG_BT_CGMS_RACP_REPORT_BATCH_SIZE][CGMS_MEAS_LENGTH];
+
+	if (count > ARRAY_SIZE(params)) {
+		return -EINVAL;
+	}
+
+	if (!bt_gatt_is_subscribed(peer, &cgms_svc.attrs[CGMS_SVC_MEAS_ATTR_IDX],
+			BT_GATT_CCC_NOTIFY)) {
+		LOG_INF("Client disabled the measurement notification");
+		return 0;
+	}
+
+	memset(params, 0, sizeof(params));
+
+	for (size_t i = 0; i < count; i++) {
+		net_buf_simple_init_with_data(&meas_buf[i], meas_data[i], sizeof(meas_data[i]));
+		net_buf_simple_reset(&meas_buf[i]);
+		meas_encode(&entries[i], &meas_buf[i]);
+
+		params[i].attr = &cgms_svc.attrs[CGMS_SVC_MEAS_ATTR_IDX];
+		params[i].data = meas_buf[i].data;
+		params[i].len = meas_buf[i].len;
+	}
+
+	if (count == 1) {
+		return bt_gatt_notify_cb(peer, &params[0]);
+	}
+
+	/* The records are sent in a single Multiple Handle Value Notification if it is
+	 * supported by both devices.
+	 */
+	return bt_gatt_notify_multiple(peer, count, params);
 }
 
 int cgms_socp_send_response(struct bt_conn *peer, struct net_buf_simple *rsp)
@@ -516,7 +555,11 @@ int bt_cgms_init(struct bt_cgms_init_param *init_params)
 	}
 	cgms_inst.cb.session_state_changed = init_params->cb->session_state_changed;
 
-	cgms_racp_init();
+	rc = cgms_racp_init();
+	if (rc) {
+		LOG_WRN("Cannot initialize measurement record database.");
+		return rc;
+	}
 
 	k_work_init_delayable(&report_meas_work, report_meas);
 	rc = k_work_reschedule(&report_meas_work, K_MINUTES(cgms_inst.comm_interval));
@@ -529,6 +572,12 @@ int bt_cgms_init(struct bt_cgms_init_param *init_params)
 	k_timer_start(&session_expiry_timer, K_HOURS(cgms_inst.srt), K_NO_WAIT);
 
 	/* Start a session and notify the application. */
+	rc = cgms_racp_session_start();
+	if (rc) {
+		LOG_WRN("Cannot start a session of measurement records.");
+		return rc;
+	}
+
 	cgms_inst.local_start_time = k_uptime_get_32();
 	atomic_clear_bit(&cgms_inst.status, CGMS_STATUS_POS_SESSION_STOPPED);
 	if (cgms_inst.cb.session_state_changed) {
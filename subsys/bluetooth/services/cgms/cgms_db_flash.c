@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/logging/log.h>
+
+#include "cgms_internal.h"
+
+LOG_MODULE_DECLARE(cgms, CONFIG_BT_CGMS_LOG_LEVEL);
+
+#define CGMS_STORAGE_AREA FIXED_PARTITION_ID(cgms_storage)
+
+/* Record layout: sequence number (4), session (2), flag (1), glucose concentration (2),
+ * time offset (2), warning, calibration and temperature, and status annunciation (3),
+ * CRC-8 (1).
+ */
+#define RECORD_LEN     15
+#define RECORD_CRC_OFF (RECORD_LEN - 1)
+#define SLOT_MIN_SIZE  16
+#define SLOT_MAX_SIZE  32
+
+/* Maximum number of unreadable slots skipped within the stored records. */
+#define SKIPPED_MAX 4
+
+/*
+ * The records are stored in fixed-size slots. The record with the sequence number N is always
+ * stored in the slot N modulo the number of slots, so any record can be located without
+ * scanning the flash. A flash page is erased before its first slot is written, which drops
+ * the oldest records stored in that page.
+ *
+ * A slot that does not hold a valid record, for example because its write was interrupted by
+ * a reset, is skipped. The stored records are the valid ones between the oldest and the newest
+ * record, excluding the skipped slots.
+ */
+static const struct flash_area *fa;
+static uint32_t page_size;
+static uint32_t slot_size;
+static uint32_t slots_per_page;
+static uint32_t slot_total;
+static uint8_t erased_val;
+
+/* Sequence number of the oldest record. */
+static uint32_t first_seq;
+/* Sequence number of the next record to be written. */
+static uint32_t next_seq;
+/* Number of slots starting from the next one that are known to be erased. */
+static uint32_t erased_slots;
+/* Sequence numbers of the skipped slots between the oldest and the next record, ascending. */
+static uint32_t skipped[SKIPPED_MAX];
+static uint32_t skipped_count;
+
+static off_t slot_offset(uint32_t seq)
+{
+	uint32_t slot = seq % slot_total;
+
+	return (slot / slots_per_page) * page_size + (slot % slots_per_page) * slot_size;
+}
+
+/* Drop the skipped slots that are no longer between the oldest and the next record. */
+static void skipped_trim(void)
+{
+	uint32_t i = 0;
+
+	while ((i < skipped_count) && (skipped[i] <= first_seq)) {
+		if (skipped[i] == first_seq) {
+			first_seq++;
+		}
+		i++;
+	}
+
+	memmove(skipped, &skipped[i], (skipped_count - i) * sizeof(skipped[0]));
+	skipped_count -= i;
+}
+
+/* Skip the slot with the given sequence number. If there are too many skipped slots, the
+ * records older than the oldest skipped slot are dropped.
+ */
+static void skipped_add(uint32_t seq)
+{
+	if (skipped_count == SKIPPED_MAX) {
+		first_seq = skipped[0] + 1;
+		skipped_trim();
+	}
+
+	skipped[skipped_count++] = seq;
+	skipped_trim();
+}
+
+/* Get the sequence number of the record with the given index. */
+static uint32_t index_to_seq(uint32_t index)
+{
+	uint32_t seq = first_seq + index;
+
+	for (uint32_t i = 0; (i < skipped_count) && (skipped[i] <= seq); i++) {
+		seq++;
+	}
+
+	return seq;
+}
+
+static void record_encode(uint8_t *buf, uint32_t seq, const struct cgms_meas *meas)
+{
+	memset(buf, erased_val, slot_size);
+
+	sys_put_le32(seq, &buf[0]);
+	sys_put_le16(meas->session, &buf[4]);
+	buf[6] = meas->flag;
+	sys_put_le16(meas->glucose_concentration, &buf[7]);
+	sys_put_le16(meas->time_offset, &buf[9]);
+	buf[11] = meas->sensor_status_annunciation.warning;
+	buf[12] = meas->sensor_status_annunciation.calib_temp;
+	buf[13] = meas->sensor_status_annunciation.status;
+	buf[RECORD_CRC_OFF] = crc8_ccitt(0xff, buf, RECORD_CRC_OFF);
+}
+
+static bool record_is_erased(const uint8_t *buf)
+{
+	for (size_t i = 0; i < RECORD_LEN; i++) {
+		if (buf[i] != erased_val) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool record_is_valid(const uint8_t *buf)
+{
+	return crc8_ccitt(0xff, buf, RECORD_CRC_OFF) == buf[RECORD_CRC_OFF];
+}
+
+static void record_decode(const uint8_t *buf, struct cgms_meas *meas)
+{
+	meas->session = sys_get_le16(&buf[4]);
+	meas->flag = buf[6];
+	meas->glucose_concentration = sys_get_le16(&buf[7]);
+	meas->time_offset = sys_get_le16(&buf[9]);
+	meas->sensor_status_annunciation.warning = buf[11];
+	meas->sensor_status_annunciation.calib_temp = buf[12];
+	meas->sensor_status_annunciation.status = buf[13];
+}
+
+static int slot_read(uint32_t seq, uint8_t *buf)
+{
+	return flash_area_read(fa, slot_offset(seq), buf, RECORD_LEN);
+}
+
+static bool slot_holds(const uint8_t *buf, uint32_t seq)
+{
+	return record_is_valid(buf) && (sys_get_le32(buf) == seq);
+}
+
+static int storage_recover(void)
+{
+	uint8_t buf[RECORD_LEN];
+	uint32_t found[SKIPPED_MAX];
+	uint32_t found_count = 0;
+	uint32_t max_seq = 0;
+	bool empty = true;
+	uint32_t seq;
+	int err;
+
+	first_seq = 0;
+	next_seq = 0;
+	erased_slots = 0;
+	skipped_count = 0;
+
+	/* Find the newest valid record. */
+	for (uint32_t slot = 0; slot < slot_total; slot++) {
+		err = slot_read(slot, buf);
+		if (err) {
+			return err;
+		}
+
+		if (record_is_erased(buf) || !record_is_valid(buf)) {
+			continue;
+		}
+
+		seq = sys_get_le32(buf);
+		if (((seq % slot_total) == slot) && (empty || (seq > max_seq))) {
+			max_seq = seq;
+			empty = false;
+		}
+	}
+
+	if (empty) {
+		return 0;
+	}
+
+	/* Go back from the newest record as long as the records are continuous. Unreadable
+	 * slots are skipped, for example if a write was interrupted. An erased slot or a
+	 * record of an older round means that the older records were dropped or that an erase
+	 * operation was interrupted.
+	 */
+	first_seq = max_seq;
+
+	for (seq = max_seq; (seq > 0) && ((max_seq - seq + 1) < slot_total); seq--) {
+		err = slot_read(seq - 1, buf);
+		if (err) {
+			return err;
+		}
+
+		if (slot_holds(buf, seq - 1)) {
+			first_seq = seq - 1;
+			continue;
+		}
+
+		if (record_is_erased(buf) || record_is_valid(buf) ||
+		    (found_count == SKIPPED_MAX)) {
+			break;
+		}
+
+		found[found_count++] = seq - 1;
+	}
+
+	/* The skipped slots older than the oldest record are not part of the stored records. */
+	while ((found_count > 0) && (found[found_count - 1] < first_seq)) {
+		found_count--;
+	}
+
+	for (uint32_t i = 0; i < found_count; i++) {
+		skipped[i] = found[found_count - 1 - i];
+	}
+	skipped_count = found_count;
+
+	/* The remaining slots of the page that is currently written must be erased before they
+	 * are written. A slot with an interrupted write is skipped.
+	 */
+	next_seq = max_seq + 1;
+
+	for (seq = next_seq; (seq % slots_per_page) != 0; seq++) {
+		err = slot_read(seq, buf);
+		if (err) {
+			return err;
+		}
+
+		if (!record_is_erased(buf)) {
+			while (next_seq <= seq) {
+				skipped_add(next_seq++);
+			}
+		}
+	}
+
+	erased_slots = (next_seq % slots_per_page) ?
+		       (slots_per_page - next_seq % slots_per_page) : 0;
+
+	if (skipped_count > 0) {
+		LOG_WRN("Skipped %u unreadable record slots", skipped_count);
+	}
+
+	LOG_DBG("Recovered %u records", cgms_db_count());
+
+	return 0;
+}
+
+int cgms_db_init(void)
+{
+	struct flash_pages_info info;
+	int err;
+
+	err = flash_area_open(CGMS_STORAGE_AREA, &fa);
+	if (err) {
+		return err;
+	}
+
+	err = flash_get_page_info_by_offs(flash_area_get_device(fa), fa->fa_off, &info);
+	if (err) {
+		return err;
+	}
+
+	page_size = info.size;
+	slot_size = ROUND_UP(SLOT_MIN_SIZE, flash_area_align(fa));
+	erased_val = flash_area_erased_val(fa);
+
+	if ((slot_size > SLOT_MAX_SIZE) || (page_size % slot_size) ||
+	    (fa->fa_size % page_size) || (fa->fa_size < 2 * page_size)) {
+		LOG_ERR("Unsupported cgms_storage partition layout");
+		return -EINVAL;
+	}
+
+	slots_per_page = page_size / slot_size;
+	slot_total = (fa->fa_size / page_size) * slots_per_page;
+
+	err = storage_recover();
+	if (err) {
+		LOG_WRN("Measurement record storage cleared");
+		return cgms_db_clear();
+	}
+
+	return 0;
+}
+
+int cgms_db_add(const struct cgms_meas *meas)
+{
+	uint8_t buf[SLOT_MAX_SIZE];
+	off_t offset = slot_offset(next_seq);
+	int err;
+
+	if (erased_slots == 0) {
+		__ASSERT_NO_MSG((offset % page_size) == 0);
+
+		err = flash_area_erase(fa, offset, page_size);
+		if (err) {
+			return err;
+		}
+
+		erased_slots = slots_per_page;
+
+		/* Drop the records that were stored in the erased page. */
+		if ((next_seq - first_seq + slots_per_page) > slot_total) {
+			first_seq = next_seq + slots_per_page - slot_total;
+			skipped_trim();
+		}
+	}
+
+	record_encode(buf, next_seq, meas);
+
+	err = flash_area_write(fa, offset, buf, slot_size);
+	if (err) {
+		return err;
+	}
+
+	erased_slots--;
+	next_seq++;
+
+	return 0;
+}
+
+int cgms_db_clear(void)
+{
+	int err;
+
+	err = flash_area_erase(fa, 0, fa->fa_size);
+	if (err) {
+		return err;
+	}
+
+	first_seq = 0;
+	next_seq = 0;
+	erased_slots = slot_total;
+	skipped_count = 0;
+
+	return 0;
+}
+
+uint32_t cgms_db_count(void)
+{
+	return next_seq - first_seq - skipped_count;
+}
+
+int cgms_db_read(uint32_t index, struct cgms_meas *meas, uint32_t count)
+{
+	uint8_t buf[RECORD_LEN];
+	uint32_t seq;
+	uint32_t skip;
+	int err;
+
+	if (index >= cgms_db_count()) {
+		return 0;
+	}
+
+	count = MIN(count, cgms_db_count() - index);
+	seq = index_to_seq(index);
+
+	/* First skipped slot after the record that is read. */
+	skip = 0;
+	while ((skip < skipped_count) && (skipped[skip] < seq)) {
+		skip++;
+	}
+
+	for (uint32_t i = 0; i < count; i++, seq++) {
+		while ((skip < skipped_count) && (skipped[skip] == seq)) {
+			skip++;
+			seq++;
+		}
+
+		err = slot_read(seq, buf);
+		if (err) {
+			return err;
+		}
+
+		if (!slot_holds(buf, seq)) {
+			return -EIO;
+		}
+
+		record_decode(buf, &meas[i]);
+	}
+
+	return count;
+}
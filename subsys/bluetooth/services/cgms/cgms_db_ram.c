@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#include "cgms_internal.h"
+
+/* The number of measurement that can be stored */
+#define RECORD_NUM CONFIG_BT_CGMS_MAX_MEASUREMENT_RECORD
+
+static struct cgms_meas records[RECORD_NUM];
+/* Position of the oldest record in the ring buffer. */
+static uint32_t oldest;
+static uint32_t record_count;
+
+int cgms_db_init(void)
+{
+	return cgms_db_clear();
+}
+
+int cgms_db_add(const struct cgms_meas *meas)
+{
+	records[(oldest + record_count) % RECORD_NUM] = *meas;
+
+	if (record_count < RECORD_NUM) {
+		record_count++;
+	} else {
+		oldest = (oldest + 1) % RECORD_NUM;
+	}
+
+	return 0;
+}
+
+int cgms_db_clear(void)
+{
+	oldest = 0;
+	record_count = 0;
+
+	return 0;
+}
+
+uint32_t cgms_db_count(void)
+{
+	return record_count;
+}
+
+int cgms_db_read(uint32_t index, struct cgms_meas *meas, uint32_t count)
+{
+	if (index >= record_count) {
+		return 0;
+	}
+
+	count = MIN(count, record_count - index);
+
+	for (uint32_t i = 0; i < count; i++) {
+		meas[i] = records[(oldest + index + i) % RECORD_NUM];
+	}
+
+	return count;
+}
@@ -78,6 +78,10 @@ struct cgms_meas {
 	/* Sensor Status Annunciation.*/
 	/* Variable length, can include Status, Cal/Temp, and Warning. */
 	struct cgms_sensor_annunc sensor_status_annunciation;
+	/* Session the record belongs to. It is not transmitted, the stored records are
+	 * ordered by the session and the time offset.
+	 */
+	uint16_t session;
 };
 
 struct cgms_feature {
@@ -144,8 +148,8 @@ int cgms_racp_recv_request(struct bt_conn *peer, const uint8_t *req_data, uint16
 /* Function for sending RACP response. */
 int cgms_racp_send_response(struct bt_conn *peer, struct net_buf_simple *rsp);
 
-/* Function for sending RACP records. */
-int cgms_racp_send_record(struct bt_conn *peer, struct cgms_meas *entry);
+/* Function for sending a batch of RACP records. */
+int cgms_racp_send_records(struct bt_conn *peer, const struct cgms_meas *entries, size_t count);
 
 /* Function for retrieving the newest RACP records. */
 int cgms_racp_meas_get_latest(struct cgms_meas *meas);
@@ -153,10 +157,36 @@ int cgms_racp_meas_get_latest(struct cgms_meas *meas);
 /* Function for adding RACP records. */
 int cgms_racp_meas_add(struct cgms_meas meas);
 
+/* Function for starting a new session of RACP records.
+ * The records of the previous sessions are kept.
+ */
+int cgms_racp_session_start(void);
+
+/* Function for initializing the measurement record database.
+ * The database functions are not thread-safe, the RACP module serializes the access.
+ */
+int cgms_db_init(void);
+
+/* Function for adding a record to the database. The oldest record is overwritten if
+ * the database is full.
+ */
+int cgms_db_add(const struct cgms_meas *meas);
+
+/* Function for removing all records from the database. */
+int cgms_db_clear(void);
+
+/* Function for retrieving the number of records in the database. */
+uint32_t cgms_db_count(void);
+
+/* Function for reading consecutive records from the database.
+ * The index 0 refers to the oldest record. Returns the number of records read.
+ */
+int cgms_db_read(uint32_t index, struct cgms_meas *meas, uint32_t count);
+
 /* Function for initializing RACP module.
  * It must be called before using any RACP function.
  */
-void cgms_racp_init(void);
+int cgms_racp_init(void);
 
 #ifdef __cplusplus
 }
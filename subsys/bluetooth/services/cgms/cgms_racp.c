@@ -5,7 +5,6 @@
  */
 #include <zephyr/types.h>
 #include <zephyr/kernel.h>
-#include <zephyr/sys/slist.h>
 #include <string.h>
 #include <zephyr/logging/log.h>
 
@@ -19,8 +18,14 @@ LOG_MODULE_DECLARE(cgms, CONFIG_BT_CGMS_LOG_LEVEL);
 #define RACP_Q_PRIORITY 1
 K_THREAD_STACK_DEFINE(racp_q_stack_area, RACP_Q_STACK_SIZE);
 
-/* The number of measurement that can be stored */
-#define RECORD_NUM       CONFIG_BT_CGMS_MAX_MEASUREMENT_RECORD
+/* The number of records read from the database and notified at once */
+#define REPORT_BATCH_SIZE CONFIG_BT_CGMS_RACP_REPORT_BATCH_SIZE
+
+/* Retries of a batch that could not be notified due to lack of buffers. The delay grows
+ * with every attempt.
+ */
+#define REPORT_RETRY_MAX 10
+#define REPORT_RETRY_DELAY_MS 20
 
 /**@brief Record Access Control Point opcodes. */
 enum racp_opcode {
@@ -65,13 +70,6 @@ enum racp_rsp_code {
 	RACP_RESPONSE_OPERAND_UNSUPPORTED = 9,
 };
 
-/* structure of a record in db  */
-struct cgms_meas_db_entry {
-	sys_snode_t node;
-	bool used;
-	struct cgms_meas meas;
-};
-
 /** structure of racp task */
 struct racp_task {
 	struct k_work item;
@@ -80,25 +78,126 @@ struct racp_task {
 	uint8_t req_buf[CGMS_RACP_MAX_LENGTH];
 };
 
-static struct cgms_meas_db_entry cgms_meas_db_entry_pool[RECORD_NUM];
-
 static struct k_mutex lock;
 
-static sys_slist_t database;
-
 static struct k_work_q racp_work_q;
 
 static struct racp_task report_record_task;
 
-static struct cgms_meas_db_entry *entry_alloc(void)
+/* Session of the records that are currently added. */
+static uint16_t session;
+
+/* Number of records added, used to detect the records overwritten during a report. */
+static uint32_t records_added;
+
+/* Compare the ordering key of the record with the given session and time offset.
+ * The session counter can wrap around, only a few sessions are stored at a time.
+ */
+static int record_key_cmp(const struct cgms_meas *meas, uint16_t key_session,
+			  uint16_t time_offset)
+{
+	int16_t session_diff = (int16_t)(meas->session - key_session);
+
+	if (session_diff != 0) {
+		return session_diff;
+	}
+
+	return (int)meas->time_offset - (int)time_offset;
+}
+
+/* Find the index of the first record of the current session with the time offset greater
+ * than or equal to the given one. The records are stored in the order of non-decreasing
+ * session and time offset, so a binary search is used.
+ */
+static int record_find_time_offset(uint16_t time_offset, uint32_t *index)
 {
-	for (int i = 0; i < ARRAY_SIZE(cgms_meas_db_entry_pool); i++) {
-		if (!cgms_meas_db_entry_pool[i].used) {
-			cgms_meas_db_entry_pool[i].used = true;
-			return &cgms_meas_db_entry_pool[i];
+	struct cgms_meas meas;
+	uint32_t low = 0;
+	uint32_t high = cgms_db_count();
+	uint32_t mid;
+	int rc;
+
+	while (low < high) {
+		mid = low + (high - low) / 2;
+
+		rc = cgms_db_read(mid, &meas, 1);
+		if (rc != 1) {
+			return rc < 0 ? rc : -EIO;
+		}
+
+		if (record_key_cmp(&meas, session, time_offset) < 0) {
+			low = mid + 1;
+		} else {
+			high = mid;
 		}
 	}
-	return NULL;
+
+	*index = low;
+
+	return 0;
+}
+
+static int records_batch_send(struct bt_conn *peer, const struct cgms_meas *batch,
+			      size_t count)
+{
+	int rc;
+
+	rc = cgms_racp_send_records(peer, batch, count);
+
+	/* Running out of buffers is transient, the batch is sent again once the
+	 * previous notifications are transmitted. The lock is released while waiting
+	 * so that new measurements can still be added.
+	 */
+	for (int retry = 0; (rc == -ENOMEM) && (retry < REPORT_RETRY_MAX); retry++) {
+		k_mutex_unlock(&lock);
+		k_sleep(K_MSEC(REPORT_RETRY_DELAY_MS * (retry + 1)));
+		k_mutex_lock(&lock, K_FOREVER);
+
+		rc = cgms_racp_send_records(peer, batch, count);
+	}
+
+	return rc;
+}
+
+static int records_send(struct bt_conn *peer, uint32_t index, uint32_t count)
+{
+	struct cgms_meas batch[REPORT_BATCH_SIZE];
+	uint32_t db_count;
+	uint32_t added;
+	uint32_t dropped;
+	int rc;
+
+	while (count > 0) {
+		rc = cgms_db_read(index, batch, MIN(count, ARRAY_SIZE(batch)));
+		if (rc <= 0) {
+			return rc < 0 ? rc : -EIO;
+		}
+
+		index += rc;
+		count -= rc;
+
+		db_count = cgms_db_count();
+		added = records_added;
+
+		rc = records_batch_send(peer, batch, rc);
+		if (rc != 0) {
+			return rc;
+		}
+
+		/* The records added while the lock was released may have overwritten the
+		 * oldest ones, which shifts the index of the records that are not sent yet.
+		 */
+		dropped = db_count + (records_added - added) - cgms_db_count();
+		if (dropped > index) {
+			LOG_WRN("%u records overwritten during the report", dropped - index);
+			count -= MIN(count, dropped - index);
+			index = 0;
+		} else {
+			index -= dropped;
+		}
+	}
+
+	return 0;
 }
 
 static int generic_handler(struct bt_conn *peer, uint8_t opcode, uint8_t response_code)
@@ -113,40 +212,37 @@ static int generic_handler(struct bt_conn *peer, uint8_t opcode, uint8_t respons
 	return cgms_racp_send_response(peer, &rsp);
 }
 
-static int report_recs_all_handler(struct bt_conn *peer)
+static int report_recs_range_handler(struct bt_conn *peer, uint32_t index, uint32_t count)
 {
 	int rc;
-	struct cgms_meas_db_entry *entry;
-	sys_snode_t *record_node;
 
-	/* Check if database is empty */
-	if (sys_slist_is_empty(&database)) {
+	if (count == 0) {
 		return generic_handler(peer, RACP_OPCODE_REPORT_RECS,
 				RACP_RESPONSE_NO_RECORDS_FOUND);
 	}
 
-	SYS_SLIST_FOR_EACH_NODE(&database, record_node) {
-		entry = CONTAINER_OF(record_node, struct cgms_meas_db_entry, node);
-		rc = cgms_racp_send_record(peer, &entry->meas);
-		if (rc != 0) {
-			LOG_WRN("Error occurs when transmitting record: %d", rc);
-			return generic_handler(peer, RACP_OPCODE_REPORT_RECS,
-					RACP_RESPONSE_PROCEDURE_NOT_DONE);
-		}
-
+	rc = records_send(peer, index, count);
+	if (rc != 0) {
+		LOG_WRN("Error occurs when transmitting record: %d", rc);
+		return generic_handler(peer, RACP_OPCODE_REPORT_RECS,
+				RACP_RESPONSE_PROCEDURE_NOT_DONE);
 	}
 
 	return generic_handler(peer, RACP_OPCODE_REPORT_RECS, RACP_RESPONSE_SUCCESS);
 }
 
+static int report_recs_all_handler(struct bt_conn *peer)
+{
+	return report_recs_range_handler(peer, 0, cgms_db_count());
+}
+
 static int report_recs_greater_or_equal_handler(struct bt_conn *peer,
 					struct net_buf_simple *operand)
 {
 	int rc;
 	enum racp_operand_filter filter;
 	uint16_t time_offset_limit;
-	struct cgms_meas_db_entry *entry;
-	sys_snode_t *record_node;
+	uint32_t index;
 
 	/* In this case, the length of operand is at least 3 bytes,
 	 * 1 for filter type, another 2 for filter value.
@@ -164,74 +260,26 @@ static int report_recs_greater_or_equal_handler(struct bt_conn *peer,
 
 	time_offset_limit = net_buf_simple_pull_le16(operand);
 
-	/* Check if database is empty */
-	if (sys_slist_is_empty(&database)) {
-		return generic_handler(peer, RACP_OPCODE_REPORT_RECS,
-				RACP_RESPONSE_NO_RECORDS_FOUND);
-	}
-
-	entry = CONTAINER_OF(sys_slist_peek_tail(&database), struct cgms_meas_db_entry, node);
-	/* If the latest one has a smaller time offset than threshold, no record is found */
-	if (entry->meas.time_offset < time_offset_limit) {
+	rc = record_find_time_offset(time_offset_limit, &index);
+	if (rc != 0) {
+		LOG_WRN("Error occurs when searching records: %d", rc);
 		return generic_handler(peer, RACP_OPCODE_REPORT_RECS,
-				RACP_RESPONSE_NO_RECORDS_FOUND);
-	}
-
-	SYS_SLIST_FOR_EACH_NODE(&database, record_node) {
-		entry = CONTAINER_OF(record_node, struct cgms_meas_db_entry, node);
-		if (entry->meas.time_offset >= time_offset_limit) {
-			rc = cgms_racp_send_record(peer, &entry->meas);
-			if (rc != 0) {
-				LOG_WRN("Error occurs when transmitting record: %d", rc);
-				return generic_handler(peer, RACP_OPCODE_REPORT_RECS,
-						RACP_RESPONSE_PROCEDURE_NOT_DONE);
-			}
-		}
+				RACP_RESPONSE_PROCEDURE_NOT_DONE);
 	}
 
-	return generic_handler(peer, RACP_OPCODE_REPORT_RECS, RACP_RESPONSE_SUCCESS);
+	return report_recs_range_handler(peer, index, cgms_db_count() - index);
 }
 
 static int report_recs_first_handler(struct bt_conn *peer)
 {
-	int rc;
-	struct cgms_meas_db_entry *entry;
-
-	if (sys_slist_is_empty(&database)) {
-		return generic_handler(peer, RACP_OPCODE_REPORT_RECS,
-				RACP_RESPONSE_NO_RECORDS_FOUND);
-	}
-
-	entry = CONTAINER_OF(sys_slist_peek_head(&database), struct cgms_meas_db_entry, node);
-	rc = cgms_racp_send_record(peer, &entry->meas);
-	if (rc != 0) {
-		LOG_WRN("Error occurs when transmitting record: %d", rc);
-		return generic_handler(peer, RACP_OPCODE_REPORT_RECS,
-				RACP_RESPONSE_PROCEDURE_NOT_DONE);
-	}
-
-	return generic_handler(peer, RACP_OPCODE_REPORT_RECS, RACP_RESPONSE_SUCCESS);
+	return report_recs_range_handler(peer, 0, MIN(cgms_db_count(), 1));
 }
 
 static int report_recs_last_handler(struct bt_conn *peer)
 {
-	int rc;
-	struct cgms_meas_db_entry *entry;
-
-	if (sys_slist_is_empty(&database)) {
-		return generic_handler(peer, RACP_OPCODE_REPORT_RECS,
-				RACP_RESPONSE_NO_RECORDS_FOUND);
-	}
+	uint32_t count = cgms_db_count();
 
-	entry = CONTAINER_OF(sys_slist_peek_tail(&database), struct cgms_meas_db_entry, node);
-	rc = cgms_racp_send_record(peer, &entry->meas);
-	if (rc != 0) {
-		LOG_WRN("Error occurs when transmitting record: %d", rc);
-		return generic_handler(peer, RACP_OPCODE_REPORT_RECS,
-				RACP_RESPONSE_PROCEDURE_NOT_DONE);
-	}
-
-	return generic_handler(peer, RACP_OPCODE_REPORT_RECS, RACP_RESPONSE_SUCCESS);
+	return report_recs_range_handler(peer, count > 0 ? count - 1 : 0, MIN(count, 1));
 }
 
 static int report_recs_handler(struct bt_conn *peer, struct net_buf_simple *operators)
@@ -268,17 +316,10 @@ static int report_recs_handler(struct bt_conn *peer, struct net_buf_simple *oper
 
 static int report_num_recs_all_handler(struct bt_conn *peer)
 {
-	uint16_t count = 0;
-	sys_snode_t *record_node;
+	uint16_t count = MIN(cgms_db_count(), UINT16_MAX);
 
 	NET_BUF_SIMPLE_DEFINE(rsp, CGMS_RACP_MAX_LENGTH);
 
-	if (!sys_slist_is_empty(&database)) {
-		SYS_SLIST_FOR_EACH_NODE(&database, record_node) {
-			count++;
-		}
-	}
-
 	net_buf_simple_add_u8(&rsp, RACP_OPCODE_NUM_RECS_RESPONSE);
 	net_buf_simple_add_u8(&rsp, RACP_OPERATOR_NULL);
 	net_buf_simple_add_le16(&rsp, count);
@@ -289,11 +330,11 @@ static int report_num_recs_all_handler(struct bt_conn *peer)
 static int report_num_recs_greater_or_equal_handler(struct bt_conn *peer,
 				struct net_buf_simple *operand)
 {
+	int rc;
 	enum racp_operand_filter filter;
 	uint16_t time_offset_limit;
-	uint16_t count = 0;
-	struct cgms_meas_db_entry *entry;
-	sys_snode_t *record_node;
+	uint16_t count;
+	uint32_t index;
 
 	NET_BUF_SIMPLE_DEFINE(rsp, CGMS_RACP_MAX_LENGTH);
 
@@ -310,15 +351,15 @@ static int report_num_recs_greater_or_equal_handler(struct bt_conn *peer,
 
 	time_offset_limit = net_buf_simple_pull_le16(operand);
 
-	if (!sys_slist_is_empty(&database)) {
-		SYS_SLIST_FOR_EACH_NODE(&database, record_node) {
-			entry = CONTAINER_OF(record_node, struct cgms_meas_db_entry, node);
-			if (entry->meas.time_offset >= time_offset_limit) {
-				count++;
-			}
-		}
+	rc = record_find_time_offset(time_offset_limit, &index);
+	if (rc != 0) {
+		LOG_WRN("Error occurs when searching records: %d", rc);
+		return generic_handler(peer, RACP_OPCODE_REPORT_NUM_RECS,
+				RACP_RESPONSE_PROCEDURE_NOT_DONE);
 	}
 
+	count = MIN(cgms_db_count() - index, UINT16_MAX);
+
 	net_buf_simple_add_u8(&rsp, RACP_OPCODE_NUM_RECS_RESPONSE);
 	net_buf_simple_add_u8(&rsp, RACP_OPERATOR_NULL);
 	net_buf_simple_add_le16(&rsp, count);
@@ -347,6 +388,32 @@ static int report_num_recs_handler(struct bt_conn *peer, struct net_buf_simple *
 			RACP_RESPONSE_OPERATOR_UNSUPPORTED);
 }
 
+static int delete_recs_handler(struct bt_conn *peer, struct net_buf_simple *operators)
+{
+	int rc;
+	enum racp_operator operator;
+
+	if (operators->len < 1) {
+		return generic_handler(peer, RACP_OPCODE_DELETE_RECS,
+			RACP_RESPONSE_INVALID_OPERATOR);
+	}
+
+	operator = net_buf_simple_pull_u8(operators);
+	if (operator != RACP_OPERATOR_ALL) {
+		return generic_handler(peer, RACP_OPCODE_DELETE_RECS,
+			RACP_RESPONSE_OPERATOR_UNSUPPORTED);
+	}
+
+	rc = cgms_db_clear();
+	if (rc != 0) {
+		LOG_WRN("Error occurs when deleting records: %d", rc);
+		return generic_handler(peer, RACP_OPCODE_DELETE_RECS,
+				RACP_RESPONSE_PROCEDURE_NOT_DONE);
+	}
+
+	return generic_handler(peer, RACP_OPCODE_DELETE_RECS, RACP_RESPONSE_SUCCESS);
+}
+
 static void racp_task_handler(struct k_work *work_item)
 {
 	int rc;
@@ -366,6 +433,10 @@ static void racp_task_handler(struct k_work *work_item)
 			rc = report_num_recs_handler(task->peer,
 				&task->req);
 			break;
+		case RACP_OPCODE_DELETE_RECS:
+			rc = delete_recs_handler(task->peer,
+				&task->req);
+			break;
 		default:
 			rc = generic_handler(task->peer, opcode,
 					RACP_RESPONSE_OPCODE_UNSUPPORTED);
@@ -447,18 +518,27 @@ int cgms_racp_recv_request(struct bt_conn *peer, const uint8_t *req_data, uint16
 int cgms_racp_meas_add(struct cgms_meas meas)
 {
 	int rc;
-	struct cgms_meas_db_entry *entry;
+	struct cgms_meas latest;
+	uint32_t count;
 
 	if (k_mutex_lock(&lock, K_NO_WAIT) == 0) {
-		entry = entry_alloc();
-		if (entry == NULL) {
-			entry = CONTAINER_OF(sys_slist_get(&database),
-					struct cgms_meas_db_entry, node);
+		/* The records must be kept in the order of non-decreasing session and time
+		 * offset. A smaller time offset within the session means that the time offset
+		 * wrapped around, so the following records are keyed by a new session.
+		 */
+		count = cgms_db_count();
+		if ((count > 0) && (cgms_db_read(count - 1, &latest, 1) == 1) &&
+		    (latest.session == session) && (meas.time_offset < latest.time_offset)) {
+			LOG_DBG("Time offset wrapped around");
+			session++;
+		}
+
+		meas.session = session;
+		rc = cgms_db_add(&meas);
+		if (rc == 0) {
+			records_added++;
 		}
-		memcpy(&entry->meas, &meas, sizeof(meas));
-		sys_slist_append(&database, &entry->node);
 		k_mutex_unlock(&lock);
-		rc = 0;
 	} else {
 		rc = -EBUSY;
 	}
@@ -466,19 +546,44 @@ int cgms_racp_meas_add(struct cgms_meas meas)
 	return rc;
 }
 
-int cgms_racp_meas_get_latest(struct cgms_meas *meas)
+int cgms_racp_session_start(void)
 {
 	int rc;
-	struct cgms_meas_db_entry *entry;
+	struct cgms_meas latest;
+	uint32_t count;
 
 	if (k_mutex_lock(&lock, K_NO_WAIT) == 0) {
-		if (!sys_slist_is_empty(&database)) {
-			entry = CONTAINER_OF(sys_slist_peek_tail(&database),
-				struct cgms_meas_db_entry, node);
-			memcpy(meas, &entry->meas, sizeof(struct cgms_meas));
+		count = cgms_db_count();
+		if (count == 0) {
+			session = 0;
+			rc = 0;
+		} else if (cgms_db_read(count - 1, &latest, 1) == 1) {
+			session = latest.session + 1;
 			rc = 0;
 		} else {
+			rc = -EIO;
+		}
+		k_mutex_unlock(&lock);
+	} else {
+		rc = -EBUSY;
+	}
+
+	return rc;
+}
+
+int cgms_racp_meas_get_latest(struct cgms_meas *meas)
+{
+	int rc;
+	uint32_t count;
+
+	if (k_mutex_lock(&lock, K_NO_WAIT) == 0) {
+		count = cgms_db_count();
+		if (count == 0) {
 			rc = -ENODATA;
+		} else if (cgms_db_read(count - 1, meas, 1) == 1) {
+			rc = 0;
+		} else {
+			rc = -EIO;
 		}
 		k_mutex_unlock(&lock);
 	} else {
@@ -488,11 +593,15 @@ int cgms_racp_meas_get_latest(struct cgms_meas *meas)
 	return rc;
 }
 
-void cgms_racp_init(void)
+int cgms_racp_init(void)
 {
-	memset(&cgms_meas_db_entry_pool, 0, sizeof(cgms_meas_db_entry_pool));
+	int rc;
 
-	sys_slist_init(&database);
+	rc = cgms_db_init();
+	if (rc) {
+		LOG_ERR("Measurement record database initialization failed: %d", rc);
+		return rc;
+	}
 
 	k_mutex_init(&lock);
 
@@ -500,4 +609,6 @@ void cgms_racp_init(void)
 	k_work_queue_start(&racp_work_q, racp_q_stack_area,
 			K_THREAD_STACK_SIZEOF(racp_q_stack_area), RACP_Q_PRIORITY, NULL);
 	k_work_init(&report_record_task.item, racp_task_handler);
+
+	return 0;
 }
@@ -7,6 +7,7 @@
 #include <zephyr/bluetooth/conn.h>
 #include <zephyr/bluetooth/uuid.h>
 #include <zephyr/bluetooth/gatt.h>
+#include <zephyr/sys/ring_buffer.h>
 
 #include <bluetooth/services/nus.h>
 #include <zephyr/logging/log.h>
@@ -15,6 +16,28 @@ LOG_MODULE_REGISTER(bt_nus, CONFIG_BT_NUS_LOG_LEVEL);
 
 static struct bt_nus_cb nus_cb;
 
+#if CONFIG_BT_NUS_STREAM
+#define STREAM_NOTIFY_MAX_LEN (CONFIG_BT_L2CAP_TX_MTU - 3)
+#define STREAM_RETRY_DELAY K_MSEC(10)
+
+struct nus_stream {
+	struct bt_conn *conn;
+	struct k_work_delayable work;
+	struct k_spinlock lock;
+	struct ring_buf rb;
+	atomic_t credits;
+	/* Incremented on every connection and disconnection to discard stale completions. */
+	uint32_t gen;
+	bool blocked;
+	uint8_t buf[CONFIG_BT_NUS_STREAM_TX_BUF_SIZE];
+};
+
+static struct nus_stream streams[CONFIG_BT_MAX_CONN];
+/* Notifications are sent from the system workqueue only. */
+static uint8_t stream_notify_buf[STREAM_NOTIFY_MAX_LEN];
+static bool streams_initialized;
+#endif /* CONFIG_BT_NUS_STREAM */
+
 static void nus_ccc_cfg_changed(const struct bt_gatt_attr *attr,
 				  uint16_t value)
 {
@@ -81,14 +104,224 @@ BT_GATT_PRIMARY_SERVICE(BT_UUID_NUS_SERVICE),
 			       NULL, on_receive, NULL),
 );
 
+#if CONFIG_BT_NUS_STREAM
+static void stream_sent(struct bt_conn *conn, void *user_data)
+{
+	struct nus_stream *stream = &streams[bt_conn_index(conn)];
+	uint32_t gen = (uint32_t)(uintptr_t)user_data;
+	k_spinlock_key_t key;
+	bool current;
+
+	/* A notification sent on the previous connection that used this index must not
+	 * return a credit to the current one.
+	 */
+	key = k_spin_lock(&stream->lock);
+	current = (stream->conn == conn) && (stream->gen == gen);
+	k_spin_unlock(&stream->lock, key);
+
+	if (!current) {
+		return;
+	}
+
+	atomic_inc(&stream->credits);
+	k_work_reschedule(&stream->work, K_NO_WAIT);
+}
+
+static void stream_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct nus_stream *stream = CONTAINER_OF(dwork, struct nus_stream, work);
+	struct bt_gatt_notify_params params = {
+		.attr = &nus_svc.attrs[2],
+		.data = stream_notify_buf,
+		.func = stream_sent,
+	};
+	struct bt_conn *conn;
+	k_spinlock_key_t key;
+	bool ready = false;
+	uint16_t max_len;
+	int err;
+
+	key = k_spin_lock(&stream->lock);
+	conn = stream->conn ? bt_conn_ref(stream->conn) : NULL;
+	params.user_data = (void *)(uintptr_t)stream->gen;
+	k_spin_unlock(&stream->lock, key);
+
+	if (!conn) {
+		return;
+	}
+
+	max_len = MIN(bt_nus_get_mtu(conn), sizeof(stream_notify_buf));
+
+	/* Only this handler takes the credits, so they cannot be taken concurrently. */
+	while (atomic_get(&stream->credits) > 0) {
+		key = k_spin_lock(&stream->lock);
+		params.len = ring_buf_peek(&stream->rb, stream_notify_buf, max_len);
+		k_spin_unlock(&stream->lock, key);
+
+		if (params.len == 0) {
+			break;
+		}
+
+		atomic_dec(&stream->credits);
+
+		err = bt_gatt_notify_cb(conn, &params);
+		if (err) {
+			atomic_inc(&stream->credits);
+
+			if (err != -ENOMEM) {
+				LOG_WRN("Stream notification failed (err %d)", err);
+				break;
+			}
+
+			/* If no notification is in flight, the sent callback will not trigger
+			 * the next attempt.
+			 */
+			if (atomic_get(&stream->credits) == CONFIG_BT_NUS_STREAM_CREDITS) {
+				k_work_reschedule(&stream->work, STREAM_RETRY_DELAY);
+			}
+			break;
+		}
+
+		key = k_spin_lock(&stream->lock);
+		ring_buf_get(&stream->rb, NULL, params.len);
+		if (stream->blocked) {
+			stream->blocked = false;
+			ready = true;
+		}
+		k_spin_unlock(&stream->lock, key);
+	}
+
+	if (ready && nus_cb.stream_ready) {
+		nus_cb.stream_ready(conn);
+	}
+
+	bt_conn_unref(conn);
+}
+
+static void stream_connected(struct bt_conn *conn, uint8_t err)
+{
+	struct nus_stream *stream = &streams[bt_conn_index(conn)];
+	k_spinlock_key_t key;
+
+	if (err || !streams_initialized) {
+		return;
+	}
+
+	key = k_spin_lock(&stream->lock);
+	stream->conn = bt_conn_ref(conn);
+	stream->gen++;
+	ring_buf_init(&stream->rb, sizeof(stream->buf), stream->buf);
+	atomic_set(&stream->credits, CONFIG_BT_NUS_STREAM_CREDITS);
+	stream->blocked = false;
+	k_spin_unlock(&stream->lock, key);
+}
+
+static void stream_disconnected(struct bt_conn *conn, uint8_t reason)
+{
+	struct nus_stream *stream = &streams[bt_conn_index(conn)];
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&stream->lock);
+	conn = stream->conn;
+	stream->conn = NULL;
+	stream->gen++;
+	k_spin_unlock(&stream->lock, key);
+
+	if (conn) {
+		k_work_cancel_delayable(&stream->work);
+		bt_conn_unref(conn);
+	}
+}
+
+BT_CONN_CB_DEFINE(nus_stream_conn_callbacks) = {
+	.connected = stream_connected,
+	.disconnected = stream_disconnected,
+};
+
+static void streams_init(void)
+{
+	if (streams_initialized) {
+		return;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(streams); i++) {
+		k_work_init_delayable(&streams[i].work, stream_work_handler);
+	}
+
+	streams_initialized = true;
+}
+
+int bt_nus_stream_send(struct bt_conn *conn, const uint8_t *data, uint16_t len)
+{
+	struct nus_stream *stream;
+	k_spinlock_key_t key;
+	uint32_t written;
+
+	if (!conn || !data) {
+		return -EINVAL;
+	}
+
+	if (!bt_gatt_is_subscribed(conn, &nus_svc.attrs[2], BT_GATT_CCC_NOTIFY)) {
+		return -EINVAL;
+	}
+
+	stream = &streams[bt_conn_index(conn)];
+
+	key = k_spin_lock(&stream->lock);
+
+	if (stream->conn != conn) {
+		k_spin_unlock(&stream->lock, key);
+		return -ENOTCONN;
+	}
+
+	written = ring_buf_put(&stream->rb, data, len);
+	if (written < len) {
+		stream->blocked = true;
+	}
+
+	k_spin_unlock(&stream->lock, key);
+
+	if (written > 0) {
+		k_work_reschedule(&stream->work, K_NO_WAIT);
+	}
+
+	return written;
+}
+
+int bt_nus_stream_space_get(struct bt_conn *conn)
+{
+	struct nus_stream *stream;
+	k_spinlock_key_t key;
+	int space;
+
+	if (!conn) {
+		return -EINVAL;
+	}
+
+	stream = &streams[bt_conn_index(conn)];
+
+	key = k_spin_lock(&stream->lock);
+	space = (stream->conn == conn) ? ring_buf_space_get(&stream->rb) : -ENOTCONN;
+	k_spin_unlock(&stream->lock, key);
+
+	return space;
+}
+#endif /* CONFIG_BT_NUS_STREAM */
+
 int bt_nus_init(struct bt_nus_cb *callbacks)
 {
 	if (callbacks) {
 		nus_cb.received = callbacks->received;
 		nus_cb.sent = callbacks->sent;
 		nus_cb.send_enabled = callbacks->send_enabled;
+		nus_cb.stream_ready = callbacks->stream_ready;
 	}
 
+#if CONFIG_BT_NUS_STREAM
+	streams_init();
+#endif
+
 	return 0;
 }
 
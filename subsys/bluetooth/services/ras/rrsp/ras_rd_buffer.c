@@ -19,7 +19,11 @@
 
 LOG_MODULE_DECLARE(ras_rrsp, CONFIG_BT_RAS_RRSP_LOG_LEVEL);
 
+#if CONFIG_BT_RAS_RRSP_RD_BUFFER_POOL_SIZE > 0
+#define RD_POOL_SIZE CONFIG_BT_RAS_RRSP_RD_BUFFER_POOL_SIZE
+#else
 #define RD_POOL_SIZE (CONFIG_BT_RAS_RRSP_MAX_ACTIVE_CONN * CONFIG_BT_RAS_RRSP_RD_BUFFERS_PER_CONN)
+#endif
 #define DROP_PROCEDURE_COUNTER_EMPTY (-1)
 
 BUILD_ASSERT(RD_POOL_SIZE <= UINT8_MAX);
@@ -27,6 +31,7 @@ BUILD_ASSERT(RD_POOL_SIZE <= UINT8_MAX);
 static struct ras_rd_buffer rd_buffer_pool[RD_POOL_SIZE];
 static int8_t tx_power_cache[CONFIG_BT_MAX_CONN];
 static int32_t drop_procedure_counter[CONFIG_BT_MAX_CONN];
+static struct bt_ras_rd_buffer_stats rd_stats[CONFIG_BT_MAX_CONN];
 static sys_slist_t callback_list = SYS_SLIST_STATIC_INIT(&callback_list);
 
 static void notify_new_rd_stored(struct bt_conn *conn, uint16_t ranging_counter)
@@ -44,6 +49,8 @@ static void notify_rd_overwritten(struct bt_conn *conn, uint16_t ranging_counter
 {
 	struct bt_ras_rd_buffer_cb *cb;
 
+	rd_stats[bt_conn_index(conn)].overwritten++;
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&callback_list, cb, node) {
 		if (cb->ranging_data_overwritten) {
 			cb->ranging_data_overwritten(conn, ranging_counter);
@@ -92,10 +99,68 @@ static void rd_buffer_free(struct ras_rd_buffer *buf)
 	atomic_clear(&buf->refcount);
 }
 
+static bool rd_buffer_reclaimable(struct ras_rd_buffer *buf)
+{
+	/* Only overwrite buffers that have ranging data stored and are not being read. */
+	return buf->ready && !buf->busy && atomic_get(&buf->refcount) == 0;
+}
+
+static struct ras_rd_buffer *rd_buffer_reuse(struct ras_rd_buffer *buf, struct bt_conn *conn,
+					     uint16_t ranging_counter)
+{
+	if (!buf->acked) {
+		/* Only notify if the peer has not read the buffer yet. */
+		notify_rd_overwritten(buf->conn, buf->ranging_counter);
+	}
+
+	rd_buffer_free(buf);
+	rd_buffer_init(conn, buf, ranging_counter);
+
+	return buf;
+}
+
+/* Find a buffer that can be taken over from a connection holding more buffers than the
+ * requesting one. Buffers already acknowledged by the peer are preferred.
+ */
+static struct ras_rd_buffer *rd_buffer_steal_find(struct bt_conn *conn,
+						  uint8_t conn_buffer_count)
+{
+	uint8_t buffer_count[CONFIG_BT_MAX_CONN] = {0};
+	struct ras_rd_buffer *candidate = NULL;
+	uint8_t candidate_count = 0;
+
+	for (uint8_t i = 0; i < ARRAY_SIZE(rd_buffer_pool); i++) {
+		if (rd_buffer_pool[i].conn) {
+			buffer_count[bt_conn_index(rd_buffer_pool[i].conn)]++;
+		}
+	}
+
+	for (uint8_t i = 0; i < ARRAY_SIZE(rd_buffer_pool); i++) {
+		struct ras_rd_buffer *buf = &rd_buffer_pool[i];
+		uint8_t count;
+
+		if (!buf->conn || buf->conn == conn || !rd_buffer_reclaimable(buf)) {
+			continue;
+		}
+
+		count = buffer_count[bt_conn_index(buf->conn)];
+		if (count <= conn_buffer_count + 1) {
+			continue;
+		}
+
+		if (!candidate || (buf->acked && !candidate->acked) ||
+		    (buf->acked == candidate->acked && count > candidate_count)) {
+			candidate = buf;
+			candidate_count = count;
+		}
+	}
+
+	return candidate;
+}
+
 static struct ras_rd_buffer *rd_buffer_alloc(struct bt_conn *conn, uint16_t ranging_counter)
 {
-	uint16_t conn_buffer_count = 0;
-	uint16_t oldest_ranging_counter = UINT16_MAX;
+	uint8_t conn_buffer_count = 0;
 	uint16_t oldest_ranging_counter_age = 0;
 	struct ras_rd_buffer *available_free_buffer = NULL;
 	struct ras_rd_buffer *available_oldest_buffer = NULL;
@@ -107,13 +172,8 @@ static struct ras_rd_buffer *rd_buffer_alloc(struct bt_conn *conn, uint16_t rang
 			const uint16_t ranging_counter_age =
 				ranging_counter - rd_buffer_pool[i].ranging_counter;
 
-			/* Only overwrite buffers that have ranging data stored
-			 * and are not being read.
-			 */
-			if (rd_buffer_pool[i].ready && !rd_buffer_pool[i].busy &&
-			    atomic_get(&rd_buffer_pool[i].refcount) == 0 &&
+			if (rd_buffer_reclaimable(&rd_buffer_pool[i]) &&
 			    ranging_counter_age > oldest_ranging_counter_age) {
-				oldest_ranging_counter = rd_buffer_pool[i].ranging_counter;
 				oldest_ranging_counter_age = ranging_counter_age;
 				available_oldest_buffer = &rd_buffer_pool[i];
 			}
@@ -124,32 +184,42 @@ static struct ras_rd_buffer *rd_buffer_alloc(struct bt_conn *conn, uint16_t rang
 		}
 	}
 
-	/* Allocate the buffer straight away if the connection has not reached
-	 * the maximum number of buffers allocated.
-	 */
 	if (conn_buffer_count < CONFIG_BT_RAS_RRSP_RD_BUFFERS_PER_CONN) {
-		rd_buffer_init(conn, available_free_buffer, ranging_counter);
+		struct ras_rd_buffer *stolen_buffer;
 
-		return available_free_buffer;
-	}
+		/* Allocate the buffer straight away if the connection has not reached
+		 * the maximum number of buffers allocated and the pool is not exhausted.
+		 */
+		if (available_free_buffer != NULL) {
+			rd_buffer_init(conn, available_free_buffer, ranging_counter);
 
-	/* Overwrite the oldest stored ranging buffer that is not in use */
-	if (available_oldest_buffer != NULL) {
-		if (!available_oldest_buffer->acked) {
-			/* Only notify if the peer has not read the buffer yet. */
-			notify_rd_overwritten(conn, oldest_ranging_counter);
+			return available_free_buffer;
 		}
-		rd_buffer_free(available_oldest_buffer);
 
-		rd_buffer_init(conn, available_oldest_buffer, ranging_counter);
+		/* Take over a buffer from a connection that holds more buffers. */
+		stolen_buffer = rd_buffer_steal_find(conn, conn_buffer_count);
+		if (stolen_buffer != NULL) {
+			return rd_buffer_reuse(stolen_buffer, conn, ranging_counter);
+		}
+	}
 
-		return available_oldest_buffer;
+	/* Overwrite the oldest stored ranging buffer that is not in use */
+	if (available_oldest_buffer != NULL) {
+		return rd_buffer_reuse(available_oldest_buffer, conn, ranging_counter);
 	}
 
 	/* Could not allocate a buffer */
 	return NULL;
 }
 
+static void procedure_drop(uint8_t conn_index, int32_t procedure_counter, uint32_t *drop_count)
+{
+	if (drop_procedure_counter[conn_index] != procedure_counter) {
+		drop_procedure_counter[conn_index] = procedure_counter;
+		(*drop_count)++;
+	}
+}
+
 static void cs_procedure_enabled(struct bt_conn *conn, uint8_t status,
 				 struct bt_conn_le_cs_procedure_enable_complete *params)
 {
@@ -176,7 +246,8 @@ static bool process_step_data(struct bt_le_cs_subevent_step *step, void *user_da
 		__ASSERT_NO_MSG(conn_index < ARRAY_SIZE(drop_procedure_counter));
 		LOG_ERR("Out of buffer space: attempted to store %u bytes, buffer size: %u",
 			buffer_len, buffer_size);
-		drop_procedure_counter[conn_index] = buf->ranging_counter;
+		procedure_drop(conn_index, buf->ranging_counter,
+			       &rd_stats[conn_index].dropped_no_space);
 
 		return false;
 	}
@@ -205,7 +276,8 @@ static void subevent_data_available(struct bt_conn *conn,
 
 	if (result->header.procedure_done_status == BT_CONN_LE_CS_PROCEDURE_ABORTED) {
 		LOG_DBG("Procedure was aborted.");
-		drop_procedure_counter[conn_index] = result->header.procedure_counter;
+		procedure_drop(conn_index, result->header.procedure_counter,
+			       &rd_stats[conn_index].dropped_aborted);
 	}
 
 	if (drop_procedure_counter[conn_index] == result->header.procedure_counter) {
@@ -229,7 +301,8 @@ static void subevent_data_available(struct bt_conn *conn,
 		if (!buf) {
 			LOG_INF("Failed to allocate buffer for procedure %u",
 				result->header.procedure_counter);
-			drop_procedure_counter[conn_index] = result->header.procedure_counter;
+			procedure_drop(conn_index, result->header.procedure_counter,
+				       &rd_stats[conn_index].dropped_no_buffer);
 
 			return;
 		}
@@ -250,7 +323,8 @@ static void subevent_data_available(struct bt_conn *conn,
 	if (buf->subevent_cursor > buffer_size) {
 		LOG_ERR("Out of buffer space: attempted to store %u bytes, buffer size: %u",
 			buf->subevent_cursor, buffer_size);
-		drop_procedure_counter[conn_index] = buf->ranging_counter;
+		procedure_drop(conn_index, buf->ranging_counter,
+			       &rd_stats[conn_index].dropped_no_space);
 
 		rd_buffer_free(buf);
 
@@ -293,10 +367,20 @@ static void subevent_data_available(struct bt_conn *conn,
 	    hdr->ranging_done_status == BT_CONN_LE_CS_PROCEDURE_ABORTED) {
 		buf->ready = true;
 		buf->busy = false;
+		rd_stats[conn_index].stored++;
 		notify_new_rd_stored(conn, ranging_counter);
 	}
 }
 
+static void connected(struct bt_conn *conn, uint8_t err)
+{
+	if (err) {
+		return;
+	}
+
+	memset(&rd_stats[bt_conn_index(conn)], 0, sizeof(rd_stats[0]));
+}
+
 static void disconnected(struct bt_conn *conn, uint8_t reason)
 {
 	ARG_UNUSED(reason);
@@ -309,6 +393,7 @@ static void disconnected(struct bt_conn *conn, uint8_t reason)
 }
 
 BT_CONN_CB_DEFINE(conn_callbacks) = {
+	.connected = connected,
 	.le_cs_procedure_enable_complete = cs_procedure_enabled,
 	.le_cs_subevent_data_available = subevent_data_available,
 	.disconnected = disconnected,
@@ -372,3 +457,19 @@ int bt_ras_rd_buffer_bytes_pull(struct ras_rd_buffer *buf, uint8_t *out_buf, uin
 
 	return pull_bytes;
 }
+
+int bt_ras_rd_buffer_stats_get(struct bt_conn *conn, struct bt_ras_rd_buffer_stats *stats)
+{
+	uint8_t conn_index;
+
+	if (!conn || !stats) {
+		return -EINVAL;
+	}
+
+	conn_index = bt_conn_index(conn);
+	__ASSERT_NO_MSG(conn_index < ARRAY_SIZE(rd_stats));
+
+	*stats = rd_stats[conn_index];
+
+	return 0;
+}
@@ -8,6 +8,7 @@
 #include <zephyr/linker/sections.h>
 #include <zephyr/sys/util.h>
 #include <errno.h>
+#include <string.h>
 #include <nrf_cc310_bl_hash_sha256.h>
 #include <zephyr/devicetree.h>
 #include <ocrypto_constant_time.h>
@@ -15,7 +16,7 @@
 #include "bl_crypto_cc310_common.h"
 
 #define MAX_CHUNK_LEN 0x8000 /* Must be 4 byte aligned. */
-#define CHUNK_LEN_STACK 0x200
+#define CHUNK_LEN_STACK CONFIG_SB_CRYPTO_CC310_SHA256_EXT_CHUNK_SIZE
 #define RAM_BUFFER_LEN_WORDS ((MAX_CHUNK_LEN) / 4)
 #define STACK_BUFFER_LEN_WORDS ((CHUNK_LEN_STACK) / 4)
 
@@ -33,6 +34,9 @@
 #define CRYS_HASH_LAST_BLOCK_ALREADY_PROCESSED_ERROR \
 	(CRYS_HASH_MODULE_ERROR_BASE + 0xCUL)
 
+BUILD_ASSERT((CHUNK_LEN_STACK % 4) == 0,
+		"CONFIG_SB_CRYPTO_CC310_SHA256_EXT_CHUNK_SIZE must be 4 byte aligned.");
+
 BUILD_ASSERT(SHA256_CTX_SIZE >= sizeof(nrf_cc310_bl_hash_context_sha256_t), \
 		"nrf_cc310_bl_hash_context_sha256_t can no longer fit inside " \
 		"bl_sha256_ctx_t.");
@@ -43,12 +47,8 @@ static uint32_t __noinit ram_buffer
 
 static inline void *memcpy32(void *restrict d, const void *restrict s, size_t n)
 {
-	size_t len_words = ROUND_UP(n, 4) / 4;
-
-	for (size_t i = 0; i < len_words; i++) {
-		((uint32_t *)d)[i] = ((uint32_t *)s)[i];
-	}
-	return d;
+	/* The optimized memcpy() uses multi-word transfers for aligned buffers. */
+	return memcpy(d, s, ROUND_UP(n, 4));
 }
 
 int crypto_init_hash(void)
@@ -13,6 +13,9 @@
 #ifdef CONFIG_SB_LCS_AWARE
 #include <nrf_lcs/nrf_lcs.h>
 #endif
+#ifdef CONFIG_SB_VALIDATION_TIMING
+#include <zephyr/timing/timing.h>
+#endif
 
 LOG_MODULE_REGISTER(bl_validation, CONFIG_SECURE_BOOT_VALIDATION_LOG_LEVEL);
 
@@ -584,7 +587,29 @@ bool bl_validate_firmware(uint32_t fw_dst_address, uint32_t fw_src_address)
 
 bool bl_validate_firmware_local(uint32_t fw_address, const struct fw_info *fwinfo)
 {
+#ifdef CONFIG_SB_VALIDATION_TIMING
+	timing_t start_time;
+	timing_t end_time;
+	uint64_t elapsed_ns;
+	bool valid;
+
+	timing_init();
+	timing_start();
+
+	start_time = timing_counter_get();
+	valid = validate_firmware(fw_address, fw_address, fwinfo, false);
+	end_time = timing_counter_get();
+
+	elapsed_ns = timing_cycles_to_ns(timing_cycles_get(&start_time, &end_time));
+	timing_stop();
+
+	LOG_INF("Validation of %u bytes took %u us.", fwinfo ? fwinfo->size : 0,
+		(uint32_t)(elapsed_ns / NSEC_PER_USEC));
+
+	return valid;
+#else
 	return validate_firmware(fw_address, fw_address, fwinfo, false);
+#endif
 }
 
 void bl_validate_housekeeping(void)
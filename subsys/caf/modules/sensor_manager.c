@@ -23,6 +23,7 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_CAF_SENSOR_MANAGER_LOG_LEVEL);
 
 #define SAMPLE_THREAD_STACK_SIZE	CONFIG_CAF_SENSOR_MANAGER_THREAD_STACK_SIZE
 #define SAMPLE_THREAD_PRIORITY		CONFIG_CAF_SENSOR_MANAGER_THREAD_PRIORITY
+#define SAMPLING_ALIGN_MS		CONFIG_CAF_SENSOR_MANAGER_SAMPLING_ALIGN_MS
 
 struct sensor_data {
 	int sampling_period;
@@ -31,6 +32,9 @@ struct sensor_data {
 	atomic_t state;
 	unsigned int sleep_cntd;
 	atomic_t event_cnt;
+	atomic_t fifo_ready;
+	struct sensor_event *batch_event;
+	uint8_t batch_sample_cnt;
 };
 
 static struct sensor_data sensor_data[ARRAY_SIZE(sensor_configs)];
@@ -52,21 +56,6 @@ static void update_sensor_state(const struct sm_sensor_config *sc, struct sensor
 	APP_EVENT_SUBMIT(event);
 }
 
-static void send_sensor_event(const char *descr, const struct sensor_value *data, const size_t data_cnt,
-			      atomic_t *event_cnt)
-{
-	struct sensor_event *event = new_sensor_event(sizeof(struct sensor_value) * data_cnt);
-	struct sensor_value *data_ptr = sensor_event_get_data_ptr(event);
-
-	event->descr = descr;
-
-	__ASSERT_NO_MSG(sensor_event_get_data_cnt(event) == data_cnt);
-	memcpy(data_ptr, data, sizeof(struct sensor_value) * data_cnt);
-
-	atomic_inc(event_cnt);
-	APP_EVENT_SUBMIT(event);
-}
-
 static struct sensor_data *get_sensor_data(const struct device *dev)
 {
 	for (size_t i = 0; i < ARRAY_SIZE(sensor_configs); i++) {
@@ -105,6 +94,64 @@ static size_t get_sensor_data_cnt(const struct sm_sensor_config *sc)
 	return data_cnt;
 }
 
+static size_t get_samples_per_event(const struct sm_sensor_config *sc)
+{
+	return MAX(sc->samples_per_event, 1);
+}
+
+static int64_t align_sample_timeout(int64_t timeout)
+{
+	if (SAMPLING_ALIGN_MS > 0) {
+		return ROUND_UP(timeout, SAMPLING_ALIGN_MS);
+	}
+
+	return timeout;
+}
+
+static struct sensor_value *get_batch_buffer(const struct sm_sensor_config *sc,
+					     struct sensor_data *sd)
+{
+	size_t data_cnt = get_sensor_data_cnt(sc);
+
+	if (!sd->batch_event) {
+		if (atomic_get(&sd->event_cnt) >= sc->active_events_limit) {
+			return NULL;
+		}
+
+		sd->batch_event = new_sensor_event(sizeof(struct sensor_value) * data_cnt *
+						   get_samples_per_event(sc));
+		sd->batch_event->descr = sc->event_descr;
+		sd->batch_sample_cnt = 0;
+	}
+
+	/* Samples are read directly into the event data. */
+	return sensor_event_get_data_ptr(sd->batch_event) + sd->batch_sample_cnt * data_cnt;
+}
+
+static void submit_batch(const struct sm_sensor_config *sc, struct sensor_data *sd)
+{
+	struct sensor_event *event = sd->batch_event;
+
+	if (!event) {
+		return;
+	}
+
+	sd->batch_event = NULL;
+
+	if (sd->batch_sample_cnt == 0) {
+		app_event_manager_free(event);
+		return;
+	}
+
+	/* Partially filled batch is submitted only with the collected samples. */
+	event->dyndata.size = sizeof(struct sensor_value) * get_sensor_data_cnt(sc) *
+			      sd->batch_sample_cnt;
+	sd->batch_sample_cnt = 0;
+
+	atomic_inc(&sd->event_cnt);
+	APP_EVENT_SUBMIT(event);
+}
+
 static void reset_sensor_sleep_cnt(const struct sm_sensor_config *sc,
 				   struct sensor_data *sd)
 {
@@ -167,7 +214,7 @@ static bool is_sensor_active(const struct sensor_data *sd)
 
 static void sensor_wake_up_post(const struct sm_sensor_config *sc, struct sensor_data *sd)
 {
-	sd->sample_timeout = k_uptime_get();
+	sd->sample_timeout = align_sample_timeout(k_uptime_get());
 	if (sc->trigger) {
 		reset_sensor_sleep_cnt(sc, sd);
 	}
@@ -215,11 +262,25 @@ static void enter_sleep(const struct sm_sensor_config *sc,
 	k_sched_unlock();
 }
 
+static void fifo_trigger_handler(const struct device *dev, const struct sensor_trigger *trigger)
+{
+	struct sensor_data *sd = get_sensor_data(dev);
+
+	atomic_set(&sd->fifo_ready, true);
+	k_sem_give(&can_sample);
+}
+
 static void sample_sensor(struct sensor_data *sd, const struct sm_sensor_config *sc)
 {
 	size_t data_idx = 0;
 	size_t data_cnt = get_sensor_data_cnt(sc);
-	struct sensor_value data[data_cnt];
+	struct sensor_value local_data[data_cnt];
+	struct sensor_value *data = get_batch_buffer(sc, sd);
+
+	if (!data) {
+		/* Sample is still needed to keep track of the sensor activity. */
+		data = local_data;
+	}
 
 	int err = sensor_sample_fetch(sc->dev);
 
@@ -232,23 +293,42 @@ static void sample_sensor(struct sensor_data *sd, const struct sm_sensor_config
 
 	if (err) {
 		LOG_ERR("Sensor sampling error (err %d)", err);
+		submit_batch(sc, sd);
 		update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
 	} else {
-		if (atomic_get(&sd->event_cnt) < sc->active_events_limit) {
-			send_sensor_event(sc->event_descr, data, ARRAY_SIZE(data),
-					  &sd->event_cnt);
+		bool sleep = false;
+
+		if (sc->trigger && IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_PM)) {
+			process_sensor_activity(sc, sd, data);
+			sleep = !is_sensor_active(sd);
+		}
+
+		if (data != local_data) {
+			sd->batch_sample_cnt++;
+			if (sleep || (sd->batch_sample_cnt >= get_samples_per_event(sc))) {
+				submit_batch(sc, sd);
+			}
 		} else {
 			LOG_WRN("Did not send event due to too many active events on sensor: %s",
 				sc->dev->name);
 		}
 
-		if (sc->trigger && IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_PM)) {
-			process_sensor_activity(sc, sd, data);
-			if (!is_sensor_active(sd)) {
-				enter_sleep(sc, sd);
-			}
+		if (sleep) {
+			enter_sleep(sc, sd);
+		}
+	}
+}
+
+static void drain_sensor_fifo(struct sensor_data *sd, const struct sm_sensor_config *sc)
+{
+	size_t samples_cnt = get_samples_per_event(sc);
 
+	for (size_t i = 0; i < samples_cnt; i++) {
+		if (atomic_get(&sd->state) != SENSOR_STATE_ACTIVE) {
+			break;
 		}
+
+		sample_sensor(sd, sc);
 	}
 }
 
@@ -263,7 +343,11 @@ static size_t sample_sensors(int64_t *next_timeout)
 		struct sensor_data *sd = &sensor_data[i];
 		const struct sm_sensor_config *sc = &sensor_configs[i];
 
-		if (atomic_get(&sd->state) == SENSOR_STATE_ACTIVE) {
+		if ((atomic_get(&sd->state) == SENSOR_STATE_ACTIVE) && sc->fifo_trigger) {
+			if (atomic_cas(&sd->fifo_ready, true, false)) {
+				drain_sensor_fifo(sd, sc);
+			}
+		} else if (atomic_get(&sd->state) == SENSOR_STATE_ACTIVE) {
 			if (sd->sample_timeout <= cur_uptime) {
 				sample_sensor(sd, sc);
 			}
@@ -279,9 +363,14 @@ static size_t sample_sensors(int64_t *next_timeout)
 			}
 		}
 
+		if (atomic_get(&sd->state) != SENSOR_STATE_ACTIVE) {
+			/* Do not keep samples of a sensor that is no longer sampled. */
+			submit_batch(sc, sd);
+		}
+
 		if (atomic_get(&sd->state) != SENSOR_STATE_ERROR) {
 			alive_sensors++;
-			if (atomic_get(&sd->state) == SENSOR_STATE_ACTIVE) {
+			if ((atomic_get(&sd->state) == SENSOR_STATE_ACTIVE) && !sc->fifo_trigger) {
 				if (*next_timeout > sd->sample_timeout) {
 					*next_timeout = sd->sample_timeout;
 				}
@@ -388,7 +477,22 @@ static size_t sensor_init(void)
 			continue;
 		}
 		sd->sampling_period = sc->sampling_period_ms;
-		sd->sample_timeout = cur_uptime + sc->sampling_period_ms;
+		sd->sample_timeout = align_sample_timeout(cur_uptime + sc->sampling_period_ms);
+
+		__ASSERT(!(sc->fifo_trigger && sc->trigger),
+			 "FIFO trigger cannot be used together with activity trigger");
+
+		if (sc->fifo_trigger) {
+			int err = sensor_trigger_set(sc->dev, sc->fifo_trigger,
+						     fifo_trigger_handler);
+
+			if (err) {
+				update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
+				LOG_ERR("%s sensor cannot set FIFO trigger (%d)", sc->dev->name,
+					err);
+				continue;
+			}
+		}
 
 		if (sc->trigger && IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_PM)) {
 			int err = sensor_trigger_init(sc, sd);
@@ -452,6 +556,12 @@ static bool handle_power_down_event(const struct app_event_header *aeh)
 			} else if (atomic_get(&sd->state) == SENSOR_STATE_ACTIVE) {
 				int ret = 0;
 
+				if (sc->fifo_trigger) {
+					ret = sensor_trigger_set(sc->dev, sc->fifo_trigger, NULL);
+					__ASSERT_NO_MSG(!ret);
+					ret = 0;
+				}
+
 				if (sc->suspend) {
 					ret = pm_device_action_run(sc->dev,
 								   PM_DEVICE_ACTION_SUSPEND);
@@ -487,12 +597,25 @@ static bool handle_wake_up_event(const struct app_event_header *aeh)
 				ret = sensor_trigger_set(sc->dev, &sc->trigger->cfg, NULL);
 				__ASSERT_NO_MSG(!ret);
 				ret = 0;
-			} else if (sc->suspend) {
-				ret = pm_device_action_run(sc->dev, PM_DEVICE_ACTION_RESUME);
-				if (ret) {
-					LOG_ERR("Sensor %s cannot be resumed (%d)",
-						sc->dev->name, ret);
-					update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
+			} else {
+				if (sc->suspend) {
+					ret = pm_device_action_run(sc->dev,
+								   PM_DEVICE_ACTION_RESUME);
+					if (ret) {
+						LOG_ERR("Sensor %s cannot be resumed (%d)",
+							sc->dev->name, ret);
+						update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
+					}
+				}
+
+				if (!ret && sc->fifo_trigger) {
+					ret = sensor_trigger_set(sc->dev, sc->fifo_trigger,
+								 fifo_trigger_handler);
+					if (ret) {
+						LOG_ERR("Sensor %s cannot set FIFO trigger (%d)",
+							sc->dev->name, ret);
+						update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
+					}
 				}
 			}
 
@@ -535,7 +658,8 @@ static bool handle_set_sensor_period_event(const struct app_event_header *aeh)
 			struct sensor_data *sd = &sensor_data[i];
 
 			sd->sampling_period = event->sampling_period;
-			sd->sample_timeout = k_uptime_get() + event->sampling_period;
+			sd->sample_timeout = align_sample_timeout(k_uptime_get() +
+								  event->sampling_period);
 			if (sd->state == SENSOR_STATE_ACTIVE) {
 				k_sem_give(&can_sample);
 			}
@@ -10,6 +10,11 @@
 #include <zephyr/logging/log.h>
 #include <zcbor_decode.h>
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_BUFFERED_WRITE
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#endif
+
 #include <errno.h>
 #include <string.h>
 
@@ -74,6 +79,15 @@ struct dfu_multi_image_ctx {
 	 */
 	int max_loaded_finished_image_no;
 #endif
+#ifdef CONFIG_DFU_MULTI_IMAGE_BUFFERED_WRITE
+	/** Package offset up to which the data has been queued for the writer thread. */
+	size_t queued_offset;
+	/**
+	 * Copy of cur_offset published by the writer thread, which owns the parser state.
+	 * Read by the caller instead of cur_offset.
+	 */
+	atomic_t written_offset;
+#endif
 };
 
 static struct dfu_multi_image_ctx ctx;
@@ -424,6 +438,10 @@ static int load_saved_progress(void)
 
 	if (!err) {
 		ctx.saved_progress_loaded = true;
+#ifdef CONFIG_DFU_MULTI_IMAGE_BUFFERED_WRITE
+		/* Nothing is queued before the progress is loaded */
+		atomic_set(&ctx.written_offset, (atomic_val_t)ctx.cur_offset);
+#endif
 	} else {
 		LOG_ERR("Error loading saved progress");
 	}
@@ -451,12 +469,171 @@ static int settings_clear(void)
 
 #endif /* CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS */
 
+static int write_chunk(size_t offset, const uint8_t *chunk, size_t chunk_size)
+{
+	int result;
+	size_t chunk_offset = 0;
+
+	if (offset > ctx.cur_offset) {
+		/* Unexpected data gap */
+		return -ESPIPE;
+	}
+
+	while (1) {
+		/* Skip ahead to the current write offset */
+		chunk_offset += (ctx.cur_offset - offset);
+
+		if (chunk_offset >= chunk_size) {
+			break;
+		}
+
+		result = process_current_item(chunk + chunk_offset, chunk_size - chunk_offset);
+
+		if (result <= 0) {
+			return result;
+		}
+
+		chunk_offset += (size_t)result;
+		offset += (size_t)result;
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_DFU_MULTI_IMAGE_BUFFERED_WRITE
+
+#define WRITE_BUF_SIZE ROUND_UP(CONFIG_DFU_MULTI_IMAGE_BUFFERED_WRITE_BUF_SIZE, sizeof(uint32_t))
+
+struct write_request {
+	size_t offset;
+	size_t size;
+	uint8_t *data;
+};
+
+K_MEM_SLAB_DEFINE_STATIC(write_buf_slab, WRITE_BUF_SIZE,
+			 CONFIG_DFU_MULTI_IMAGE_BUFFERED_WRITE_BUF_COUNT, sizeof(uint32_t));
+K_MSGQ_DEFINE(write_request_msgq, sizeof(struct write_request),
+	      CONFIG_DFU_MULTI_IMAGE_BUFFERED_WRITE_BUF_COUNT, sizeof(uint32_t));
+static K_SEM_DEFINE(write_drained_sem, 0, 1);
+
+/* Number of queued requests that have not been processed by the writer thread yet. */
+static atomic_t write_pending;
+/* First error reported by the writer thread, latched until the next init or reset. */
+static atomic_t write_error;
+
+static void writer_thread_fn(void)
+{
+	struct write_request req;
+	int err;
+
+	while (true) {
+		k_msgq_get(&write_request_msgq, &req, K_FOREVER);
+
+		/* Once an error occurred, drop all the remaining data until the state is reset */
+		if (atomic_get(&write_error) == 0) {
+			err = write_chunk(req.offset, req.data, req.size);
+
+			if (err) {
+				LOG_ERR("Writing chunk at offset %zu failed (err %d)", req.offset, err);
+				atomic_cas(&write_error, 0, err);
+			}
+
+			atomic_set(&ctx.written_offset, (atomic_val_t)ctx.cur_offset);
+		}
+
+		k_mem_slab_free(&write_buf_slab, req.data);
+
+		if (atomic_dec(&write_pending) == 1) {
+			k_sem_give(&write_drained_sem);
+		}
+	}
+}
+
+K_THREAD_DEFINE(dfu_multi_image_writer, CONFIG_DFU_MULTI_IMAGE_BUFFERED_WRITE_STACK_SIZE,
+		writer_thread_fn, NULL, NULL, NULL,
+		CONFIG_DFU_MULTI_IMAGE_BUFFERED_WRITE_THREAD_PRIO, 0, 0);
+
+static size_t buffered_write_offset(void)
+{
+	/* The writer thread may skip ahead an image for which no writer is registered */
+	return MAX(ctx.queued_offset, (size_t)atomic_get(&ctx.written_offset));
+}
+
+/* Wait until the writer thread processes all the queued data */
+static int buffered_write_drain(void)
+{
+	while (atomic_get(&write_pending) != 0) {
+		k_sem_take(&write_drained_sem, K_FOREVER);
+	}
+
+	return (int)atomic_get(&write_error);
+}
+
+static int buffered_write_queue(size_t offset, const uint8_t *chunk, size_t chunk_size)
+{
+	struct write_request req;
+	size_t queued_offset = buffered_write_offset();
+	int err;
+
+	err = (int)atomic_get(&write_error);
+	if (err) {
+		return err;
+	}
+
+	if (offset > queued_offset) {
+		/* Unexpected data gap */
+		return -ESPIPE;
+	}
+
+	if (offset + chunk_size <= queued_offset) {
+		/* The whole chunk has already been queued */
+		return 0;
+	}
+
+	/* Skip ahead to the current queue offset */
+	chunk += queued_offset - offset;
+	chunk_size -= queued_offset - offset;
+	offset = queued_offset;
+
+	while (chunk_size > 0) {
+		/* Blocks until the writer thread releases one of the buffers */
+		err = k_mem_slab_alloc(&write_buf_slab, (void **)&req.data, K_FOREVER);
+		if (err) {
+			return err;
+		}
+
+		req.offset = offset;
+		req.size = MIN(chunk_size, WRITE_BUF_SIZE);
+		memcpy(req.data, chunk, req.size);
+
+		atomic_inc(&write_pending);
+
+		/* The queue is as long as the number of buffers, so it never blocks here */
+		(void)k_msgq_put(&write_request_msgq, &req, K_FOREVER);
+
+		chunk += req.size;
+		chunk_size -= req.size;
+		offset += req.size;
+		ctx.queued_offset = offset;
+	}
+
+	return 0;
+}
+
+#endif /* CONFIG_DFU_MULTI_IMAGE_BUFFERED_WRITE */
+
 int dfu_multi_image_init(uint8_t *buffer, size_t buffer_size)
 {
 	if (buffer == NULL || buffer_size < FIXED_HEADER_SIZE) {
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_BUFFERED_WRITE
+	/* Do not let the writer thread touch the context while it is being reset */
+	(void)buffered_write_drain();
+	atomic_set(&write_error, 0);
+#endif
+
 	memset(&ctx, 0, sizeof(ctx));
 	ctx.buffer = buffer;
 	ctx.buffer_size = buffer_size;
@@ -478,9 +655,6 @@ int dfu_multi_image_register_writer(const struct dfu_image_writer *writer)
 
 int dfu_multi_image_write(size_t offset, const uint8_t *chunk, size_t chunk_size)
 {
-	int result;
-	size_t chunk_offset = 0;
-
 #ifdef CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS
 	if (!ctx.saved_progress_loaded) {
 		/* Load saved progress from settings if available */
@@ -492,30 +666,11 @@ int dfu_multi_image_write(size_t offset, const uint8_t *chunk, size_t chunk_size
 	}
 #endif /* CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS */
 
-	if (offset > ctx.cur_offset) {
-		/* Unexpected data gap */
-		return -ESPIPE;
-	}
-
-	while (1) {
-		/* Skip ahead to the current write offset */
-		chunk_offset += (ctx.cur_offset - offset);
-
-		if (chunk_offset >= chunk_size) {
-			break;
-		}
-
-		result = process_current_item(chunk + chunk_offset, chunk_size - chunk_offset);
-
-		if (result <= 0) {
-			return result;
-		}
-
-		chunk_offset += (size_t)result;
-		offset += (size_t)result;
-	}
-
-	return 0;
+#ifdef CONFIG_DFU_MULTI_IMAGE_BUFFERED_WRITE
+	return buffered_write_queue(offset, chunk, chunk_size);
+#else
+	return write_chunk(offset, chunk, chunk_size);
+#endif
 }
 
 size_t dfu_multi_image_offset(void)
@@ -531,7 +686,11 @@ size_t dfu_multi_image_offset(void)
 	}
 #endif /* CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS */
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_BUFFERED_WRITE
+	return buffered_write_offset();
+#else
 	return ctx.cur_offset;
+#endif
 }
 
 int dfu_multi_image_done(bool success)
@@ -547,6 +706,15 @@ int dfu_multi_image_done(bool success)
 	}
 #endif /* CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS */
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_BUFFERED_WRITE
+	int write_err = buffered_write_drain();
+
+	if (write_err) {
+		/* The package was not written correctly, so do not commit the active image */
+		success = false;
+	}
+#endif
+
 	const struct dfu_image_writer *writer = current_image_writer();
 	int err = 0;
 
@@ -561,6 +729,12 @@ int dfu_multi_image_done(bool success)
 	}
 #endif /* CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS */
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_BUFFERED_WRITE
+	if (write_err) {
+		return write_err;
+	}
+#endif
+
 	/* On success, verify that all images have been fully written */
 	if (!err && success && ctx.cur_image_no != ctx.header.image_count) {
 		return -ESPIPE;
@@ -572,7 +746,14 @@ int dfu_multi_image_done(bool success)
 int dfu_multi_image_reset(void)
 {
 	int err = 0;
-	const struct dfu_image_writer *writer = current_image_writer();
+	const struct dfu_image_writer *writer;
+
+#ifdef CONFIG_DFU_MULTI_IMAGE_BUFFERED_WRITE
+	(void)buffered_write_drain();
+	atomic_set(&write_error, 0);
+#endif
+
+	writer = current_image_writer();
 
 #ifdef CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS
 	settings_subsys_init();
@@ -24,7 +24,16 @@ DEF_DFU_TARGET(modem_delta);
 #endif
 #ifdef CONFIG_DFU_TARGET_MCUBOOT
 #include "dfu/dfu_target_mcuboot.h"
-DEF_DFU_TARGET(mcuboot);
+static const struct dfu_target dfu_target_mcuboot = {
+	.init = dfu_target_mcuboot_init,
+	.offset_get = dfu_target_mcuboot_offset_get,
+	.write = dfu_target_mcuboot_write,
+	.done = dfu_target_mcuboot_done,
+	.schedule_update = dfu_target_mcuboot_schedule_update,
+	.reset = dfu_target_mcuboot_reset,
+	.write_buf_get = dfu_target_mcuboot_write_buf_get,
+	.write_buf_commit = dfu_target_mcuboot_write_buf_commit,
+};
 #endif
 #ifdef CONFIG_DFU_TARGET_FULL_MODEM
 #include "dfu/dfu_target_full_modem.h"
@@ -160,6 +169,32 @@ int dfu_target_write(const void *const buf, size_t len)
 	return current_target->write(buf, len);
 }
 
+int dfu_target_write_buf_get(void **buf, size_t *len)
+{
+	if (current_target == NULL || buf == NULL || len == NULL) {
+		return -EACCES;
+	}
+
+	if (current_target->write_buf_get == NULL) {
+		return -ENOTSUP;
+	}
+
+	return current_target->write_buf_get(buf, len);
+}
+
+int dfu_target_write_buf_commit(size_t len)
+{
+	if (current_target == NULL) {
+		return -EACCES;
+	}
+
+	if (current_target->write_buf_commit == NULL) {
+		return -ENOTSUP;
+	}
+
+	return current_target->write_buf_commit(len);
+}
+
 int dfu_target_done(bool successful)
 {
 	int err;
@@ -214,6 +214,34 @@ int dfu_target_mcuboot_write(const void *const buf, size_t len)
 	return dfu_target_stream_write(buf, len);
 }
 
+int dfu_target_mcuboot_write_buf_get(void **buf, size_t *len)
+{
+	uint8_t *write_buf;
+	int err;
+
+	if (buf == NULL) {
+		return -EINVAL;
+	}
+
+	err = dfu_target_stream_write_buf_get(&write_buf, len);
+	if (err == 0) {
+		*buf = write_buf;
+	}
+
+	return err;
+}
+
+int dfu_target_mcuboot_write_buf_commit(size_t len)
+{
+	int err = dfu_target_stream_write_buf_commit(len);
+
+	if (err == 0) {
+		stream_buf_bytes = (stream_buf_bytes + len) % stream_buf_len;
+	}
+
+	return err;
+}
+
 int dfu_target_mcuboot_done(bool successful)
 {
 	int err = 0;
@@ -209,6 +209,73 @@ int dfu_target_stream_write(const uint8_t *buf, size_t len)
 	return err;
 }
 
+int dfu_target_stream_write_buf_get(uint8_t **buf, size_t *len)
+{
+	if (!buf || !len) {
+		return -EINVAL;
+	}
+
+	if (IS_ENABLED(CONFIG_DFU_TARGET_STREAM_SYNCHRONOUS)) {
+		return -ENOTSUP;
+	}
+
+	if (current_id == NULL) {
+		return -EACCES;
+	}
+
+	if (stream.bytes_written + stream.buf_bytes >= stream.available) {
+		return -ENOMEM;
+	}
+
+	/* The buffer is written to flash as soon as it is full, so there is always room */
+	*buf = stream.buf + stream.buf_bytes;
+	*len = MIN(stream.buf_len - stream.buf_bytes,
+		   stream.available - stream.bytes_written - stream.buf_bytes);
+
+	return 0;
+}
+
+int dfu_target_stream_write_buf_commit(size_t len)
+{
+	int err = 0;
+
+	if (current_id == NULL) {
+		return -EACCES;
+	}
+
+	if (len > stream.buf_len - stream.buf_bytes) {
+		return -EINVAL;
+	}
+
+	if (stream.bytes_written + stream.buf_bytes + len > stream.available) {
+		return -ENOMEM;
+	}
+
+	if (len == 0) {
+		return 0;
+	}
+
+	stream.buf_bytes += len;
+
+	if (stream.buf_bytes == stream.buf_len) {
+		/* Full buffer, nothing is padded when flushing */
+		err = stream_flash_buffered_write(&stream, NULL, 0, true);
+		if (err != 0) {
+			LOG_ERR("stream_flash_buffered_write error %d", err);
+			return err;
+		}
+
+#ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
+		err = store_progress();
+		if (err != 0) {
+			LOG_WRN("Unable to store write progress: %d", err);
+		}
+#endif
+	}
+
+	return err;
+}
+
 int dfu_target_stream_done(bool successful)
 {
 	int err = 0;
@@ -23,9 +23,13 @@ size_t log_rpc_history_get_usage_size(void);
 
 size_t log_rpc_history_get_max_size(void);
 
+/** Get the number of log messages that could not be stored in the history. */
+uint32_t log_rpc_history_get_dropped(void);
+
 /**
- * Store checksum of the RAM retention pbuf for validation after warm reset.
- * Call from fatal/panic path.
+ * Save the log history state on panic. The RAM history stores the checksum of the
+ * retention pbuf for validation after warm reset, and the FCB history stores the block
+ * that is being filled. Call from fatal/panic path.
  */
 void log_rpc_history_save_checksum(void);
 
@@ -9,8 +9,38 @@
 #include <zephyr/fs/fcb.h>
 #include <zephyr/sys/util.h>
 
+#include <string.h>
+
 #define LOG_HISTORY_MAGIC 0x7d2ac863
 #define LOG_HISTORY_AREA FIXED_PARTITION_ID(log_history)
+#define BLOCK_SIZE CONFIG_LOG_BACKEND_RPC_HISTORY_STORAGE_FCB_BLOCK_SIZE
+#define VARINT_MAX_SIZE 10
+
+#ifdef CONFIG_LOG_TIMESTAMP_64BIT
+typedef int64_t log_timedelta_t;
+#else
+typedef int32_t log_timedelta_t;
+#endif
+
+/*
+ * Log messages are stored in the FCB in blocks, each block being a single FCB entry.
+ * This saves the per-entry FCB overhead and the number of flash writes and reads.
+ *
+ * Within a block, each message is stored in a packed form:
+ * - message descriptor,
+ * - source pointer,
+ * - timestamp delta from the previous message in the block (zigzag varint),
+ * - thread ID pointer, if enabled,
+ * - package and data, without padding.
+ *
+ * The message length is derived from the descriptor.
+ */
+struct block {
+	uint8_t buf[BLOCK_SIZE];
+	size_t len;
+	size_t offset;
+	log_timestamp_t timestamp;
+};
 
 static struct fcb fcb;
 static struct flash_sector fcb_sectors[CONFIG_LOG_BACKEND_RPC_HISTORY_STORAGE_FCB_NUM_SECTORS];
@@ -18,127 +48,439 @@ static struct fcb_entry last_popped;
 static bool erase_oldest;
 static K_MUTEX_DEFINE(fcb_lock);
 
-void log_rpc_history_init(void)
+/* Block that is being filled with new messages. */
+static struct block write_block;
+/* Block that is being popped. The FCB entry is stored in read_entry, unless the block was
+ * taken directly from write_block because it could not be stored in the FCB.
+ */
+static struct block read_block;
+static struct fcb_entry read_entry;
+static bool read_block_in_ram;
+
+/* Number of log messages that could not be stored. */
+static uint32_t dropped_cnt;
+
+/* Number of bytes used in each sector and in total, so the usage is known without a scan. */
+static uint32_t sector_used[CONFIG_LOG_BACKEND_RPC_HISTORY_STORAGE_FCB_NUM_SECTORS];
+static size_t used_size;
+
+static size_t varint_encode(uint8_t *buf, uint64_t value)
 {
-	int rc;
-	uint32_t sector_cnt = ARRAY_SIZE(fcb_sectors);
+	size_t len = 0;
 
-	rc = flash_area_get_sectors(LOG_HISTORY_AREA, &sector_cnt, fcb_sectors);
+	do {
+		buf[len] = (value & 0x7f) | ((value > 0x7f) ? 0x80 : 0);
+		value >>= 7;
+		len++;
+	} while (value);
 
-	if (rc) {
-		goto out;
+	return len;
+}
+
+static size_t varint_decode(const uint8_t *buf, size_t buf_len, uint64_t *value)
+{
+	size_t len = 0;
+
+	*value = 0;
+
+	while (len < MIN(buf_len, VARINT_MAX_SIZE)) {
+		*value |= (uint64_t)(buf[len] & 0x7f) << (7 * len);
+
+		if (!(buf[len++] & 0x80)) {
+			return len;
+		}
 	}
 
-	fcb.f_magic = LOG_HISTORY_MAGIC;
-	fcb.f_sectors = fcb_sectors;
-	fcb.f_sector_cnt = (uint8_t)sector_cnt;
-	erase_oldest = true;
+	return 0;
+}
 
-	rc = fcb_init(LOG_HISTORY_AREA, &fcb);
+static size_t msg_payload_len(struct log_msg_desc desc)
+{
+	return desc.package_len + desc.data_len;
+}
+
+static size_t msg_packed_max_len(const struct log_msg *msg)
+{
+	return sizeof(msg->hdr.desc) + sizeof(msg->hdr.source) + VARINT_MAX_SIZE +
+	       (IS_ENABLED(CONFIG_LOG_THREAD_ID_PREFIX) ? sizeof(void *) : 0) +
+	       msg_payload_len(msg->hdr.desc);
+}
+
+static void msg_pack(struct block *block, const struct log_msg *msg)
+{
+	uint8_t *out = &block->buf[block->len];
+	log_timedelta_t delta = (log_timedelta_t)(msg->hdr.timestamp - block->timestamp);
+	int64_t delta64 = delta;
+
+	memcpy(out, &msg->hdr.desc, sizeof(msg->hdr.desc));
+	out += sizeof(msg->hdr.desc);
+	memcpy(out, &msg->hdr.source, sizeof(msg->hdr.source));
+	out += sizeof(msg->hdr.source);
+	out += varint_encode(out, ((uint64_t)delta64 << 1) ^ (uint64_t)(delta64 >> 63));
+#ifdef CONFIG_LOG_THREAD_ID_PREFIX
+	memcpy(out, &msg->hdr.tid, sizeof(msg->hdr.tid));
+	out += sizeof(msg->hdr.tid);
+#endif
+	memcpy(out, msg->data, msg_payload_len(msg->hdr.desc));
+	out += msg_payload_len(msg->hdr.desc);
+
+	block->len = out - block->buf;
+	block->timestamp = msg->hdr.timestamp;
+}
+
+/* Returns NULL if the message cannot be allocated. A malformed block is skipped. */
+static union log_msg_generic *msg_unpack(struct block *block)
+{
+	const uint8_t *in = &block->buf[block->offset];
+	const uint8_t *end = &block->buf[block->len];
+	union log_msg_generic *msg;
+	struct log_msg_desc desc;
+	const void *source;
+	uint64_t zigzag;
+	size_t len;
+
+	if ((size_t)(end - in) < (sizeof(desc) + sizeof(source))) {
+		goto malformed;
+	}
+
+	memcpy(&desc, in, sizeof(desc));
+	in += sizeof(desc);
+	memcpy(&source, in, sizeof(source));
+	in += sizeof(source);
+
+	len = varint_decode(in, end - in, &zigzag);
+
+	if (len == 0) {
+		goto malformed;
+	}
+
+	in += len;
+
+	if ((size_t)(end - in) < (IS_ENABLED(CONFIG_LOG_THREAD_ID_PREFIX) ? sizeof(void *) : 0) +
+					 msg_payload_len(desc)) {
+		goto malformed;
+	}
+
+	msg = (union log_msg_generic *)k_malloc(log_msg_get_total_wlen(desc) * sizeof(uint32_t));
+
+	if (!msg) {
+		return NULL;
+	}
+
+	block->timestamp += (log_timestamp_t)((int64_t)(zigzag >> 1) ^ -(int64_t)(zigzag & 1));
+
+	msg->log.hdr.desc = desc;
+	msg->log.hdr.source = source;
+	msg->log.hdr.timestamp = block->timestamp;
+#ifdef CONFIG_LOG_THREAD_ID_PREFIX
+	memcpy(&msg->log.hdr.tid, in, sizeof(msg->log.hdr.tid));
+	in += sizeof(msg->log.hdr.tid);
+#endif
+	memcpy(msg->log.data, in, msg_payload_len(desc));
+	in += msg_payload_len(desc);
+
+	block->offset = in - block->buf;
+
+	return msg;
+
+malformed:
+	block->offset = block->len;
+
+	return NULL;
+}
+
+static size_t sector_index(const struct flash_sector *sector)
+{
+	return sector - fcb_sectors;
+}
+
+static int rotate(void)
+{
+	size_t oldest = sector_index(fcb.f_oldest);
+	int rc;
+
+	rc = fcb_rotate(&fcb);
 
 	if (rc) {
-		goto out;
+		return rc;
 	}
 
-	rc = fcb_clear(&fcb);
+	used_size -= sector_used[oldest];
+	sector_used[oldest] = 0;
 
-out:
-	__ASSERT_NO_MSG(rc == 0);
+	return 0;
 }
 
-void log_rpc_history_push(const union log_msg_generic *msg)
+static int block_flush(void)
 {
 	int rc;
-	size_t len;
+	size_t len = write_block.len;
 	struct fcb_entry entry;
+	uint32_t end;
 
-	len = log_msg_generic_get_wlen(&msg->buf) * sizeof(uint32_t);
+	if (len == 0) {
+		return 0;
+	}
 
-	k_mutex_lock(&fcb_lock, K_FOREVER);
+	/* The block is only reset once it is stored, so it is not lost on failure. */
 	rc = fcb_append(&fcb, len, &entry);
 
 	if (rc == -ENOSPC && erase_oldest) {
 		/*
 		 * The log history FCB is full but overwriting is enabled.
 		 * Erase the oldest FCB page and try again.
-		 * Note that the "last popped" location is cleared so that the next log transfer
-		 * starts from the updated oldest log message.
+		 * Note that the "last popped" location and the block being popped are cleared so
+		 * that the next log transfer starts from the updated oldest log message.
 		 */
-		rc = fcb_rotate(&fcb);
+		rc = rotate();
 
 		if (rc) {
-			goto out;
+			return rc;
 		}
 
 		memset(&last_popped, 0, sizeof(last_popped));
+		read_block.len = 0;
+		read_block.offset = 0;
+		read_block_in_ram = false;
 		rc = fcb_append(&fcb, len, &entry);
 	}
 
 	if (rc) {
-		goto out;
+		return rc;
 	}
 
-	rc = flash_area_write(fcb.fap, FCB_ENTRY_FA_DATA_OFF(entry), msg, len);
+	rc = flash_area_write(fcb.fap, FCB_ENTRY_FA_DATA_OFF(entry), write_block.buf, len);
 
 	if (rc) {
-		goto out;
+		return rc;
 	}
 
 	rc = fcb_append_finish(&fcb, &entry);
 
-out:
-	k_mutex_unlock(&fcb_lock);
+	if (rc) {
+		return rc;
+	}
 
-#ifdef LOG_HISTORY_DEBUG
-	__ASSERT_NO_MSG(rc == 0);
-#endif
+	/* Account for the entry header, the data, and the CRC, all aligned. */
+	end = entry.fe_data_off + ROUND_UP(len, fcb.f_align) + ROUND_UP(1, fcb.f_align);
+	used_size += end - sector_used[sector_index(entry.fe_sector)];
+	sector_used[sector_index(entry.fe_sector)] = end;
+
+	write_block.len = 0;
+	write_block.timestamp = 0;
+
+	return 0;
 }
 
-void log_rpc_history_set_overwriting(bool overwriting)
+/* Moves the block that is being filled to the read block, bypassing the FCB. */
+static int block_load_from_ram(void)
 {
-	k_mutex_lock(&fcb_lock, K_FOREVER);
+	if (write_block.len == 0) {
+		return -ENOENT;
+	}
 
-	erase_oldest = overwriting;
+	memcpy(read_block.buf, write_block.buf, write_block.len);
+	read_block.len = write_block.len;
+	read_block.offset = 0;
+	read_block.timestamp = 0;
+	read_block_in_ram = true;
 
-	k_mutex_unlock(&fcb_lock);
+	write_block.len = 0;
+	write_block.timestamp = 0;
+
+	return 0;
 }
 
-union log_msg_generic *log_rpc_history_pop(void)
+static int block_load(void)
 {
 	int rc;
 	struct fcb_entry entry = last_popped;
-	union log_msg_generic *msg = NULL;
 
-	k_mutex_lock(&fcb_lock, K_FOREVER);
 	rc = fcb_getnext(&fcb, &entry);
 
 	if (rc) {
-		rc = 0;
-		goto out;
+		/* No more blocks in the FCB. Store the block that is being filled. */
+		rc = block_flush();
+
+		if (rc == -ENOSPC) {
+			/* The FCB is full and overwriting is disabled. */
+			return block_load_from_ram();
+		}
+
+		if (rc) {
+			return rc;
+		}
+
+		entry = last_popped;
+		rc = fcb_getnext(&fcb, &entry);
+
+		if (rc) {
+			return -ENOENT;
+		}
 	}
 
-	msg = (union log_msg_generic *)k_malloc(entry.fe_data_len);
+	if (entry.fe_data_len > sizeof(read_block.buf)) {
+		return -EINVAL;
+	}
 
-	if (!msg) {
+	rc = flash_area_read(fcb.fap, FCB_ENTRY_FA_DATA_OFF(entry), read_block.buf,
+			     entry.fe_data_len);
+
+	if (rc) {
+		return rc;
+	}
+
+	read_entry = entry;
+	read_block.len = entry.fe_data_len;
+	read_block.offset = 0;
+	read_block.timestamp = 0;
+	read_block_in_ram = false;
+
+	return 0;
+}
+
+static int block_consumed(void)
+{
+	int rc;
+
+	read_block.len = 0;
+	read_block.offset = 0;
+
+	if (read_block_in_ram) {
+		/* The block was never stored in the FCB. */
+		read_block_in_ram = false;
+		return 0;
+	}
+
+	last_popped = read_entry;
+
+	while (fcb.f_oldest != last_popped.fe_sector) {
+		rc = rotate();
+
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+void log_rpc_history_init(void)
+{
+	int rc;
+	uint32_t sector_cnt = ARRAY_SIZE(fcb_sectors);
+
+	rc = flash_area_get_sectors(LOG_HISTORY_AREA, &sector_cnt, fcb_sectors);
+
+	if (rc) {
 		goto out;
 	}
 
-	rc = flash_area_read(fcb.fap, FCB_ENTRY_FA_DATA_OFF(entry), msg, entry.fe_data_len);
+	fcb.f_magic = LOG_HISTORY_MAGIC;
+	fcb.f_sectors = fcb_sectors;
+	fcb.f_sector_cnt = (uint8_t)sector_cnt;
+	erase_oldest = true;
+
+	rc = fcb_init(LOG_HISTORY_AREA, &fcb);
 
 	if (rc) {
 		goto out;
 	}
 
-	last_popped = entry;
+	rc = fcb_clear(&fcb);
 
-	while (fcb.f_oldest != last_popped.fe_sector) {
-		rc = fcb_rotate(&fcb);
+	memset(sector_used, 0, sizeof(sector_used));
+	used_size = 0;
+	memset(&last_popped, 0, sizeof(last_popped));
+	write_block.len = 0;
+	write_block.timestamp = 0;
+	read_block.len = 0;
+	read_block.offset = 0;
+	read_block_in_ram = false;
+	dropped_cnt = 0;
+
+out:
+	__ASSERT_NO_MSG(rc == 0);
+}
+
+void log_rpc_history_push(const union log_msg_generic *msg)
+{
+	int rc = 0;
+	size_t len;
+
+	len = msg_packed_max_len(&msg->log);
+
+	k_mutex_lock(&fcb_lock, K_FOREVER);
+
+	if (len > sizeof(write_block.buf)) {
+		/* The message does not fit in a block. */
+		dropped_cnt++;
+		goto out;
+	}
+
+	if (len > sizeof(write_block.buf) - write_block.len) {
+		rc = block_flush();
+
+		if (rc) {
+			/*
+			 * The block that is being filled is kept, so the older messages are
+			 * preserved and the new one is dropped. This is expected when the FCB is
+			 * full and overwriting is disabled during a history transfer.
+			 */
+			dropped_cnt++;
+
+			if (rc == -ENOSPC) {
+				rc = 0;
+			}
+
+			goto out;
+		}
+	}
+
+	msg_pack(&write_block, &msg->log);
+
+out:
+	k_mutex_unlock(&fcb_lock);
+
+#ifdef LOG_HISTORY_DEBUG
+	__ASSERT_NO_MSG(rc == 0);
+#endif
+}
+
+void log_rpc_history_set_overwriting(bool overwriting)
+{
+	k_mutex_lock(&fcb_lock, K_FOREVER);
+
+	erase_oldest = overwriting;
+
+	k_mutex_unlock(&fcb_lock);
+}
+
+union log_msg_generic *log_rpc_history_pop(void)
+{
+	int rc = 0;
+	union log_msg_generic *msg = NULL;
+
+	k_mutex_lock(&fcb_lock, K_FOREVER);
+
+	if (read_block.offset >= read_block.len) {
+		rc = block_load();
 
 		if (rc) {
+			if (rc == -ENOENT) {
+				rc = 0;
+			}
+
 			goto out;
 		}
 	}
 
+	msg = msg_unpack(&read_block);
+
+	if (read_block.offset >= read_block.len) {
+		rc = block_consumed();
+	}
+
 out:
 	k_mutex_unlock(&fcb_lock);
 
@@ -156,43 +498,61 @@ void log_rpc_history_free(const union log_msg_generic *msg)
 
 uint8_t log_rpc_history_get_usage(void)
 {
-	int num_free_sectors;
+	return log_rpc_history_get_usage_size() * 100 /
+	       (fcb.f_sector_cnt * fcb_sectors[0].fs_size);
+}
+
+size_t log_rpc_history_get_usage_size(void)
+{
+	size_t size;
 
 	k_mutex_lock(&fcb_lock, K_FOREVER);
 
-	num_free_sectors = fcb_free_sector_cnt(&fcb);
+	size = used_size + write_block.len;
 
 	k_mutex_unlock(&fcb_lock);
 
-	/*
-	 * This calculates the usage with the sector size granularity.
-	 * Unforunately, there is no FCB API for getting more accurate usage, but it can be
-	 * implemented by hand if the greater accuraccy turns out to be needed.
-	 */
-	return (fcb.f_sector_cnt - num_free_sectors) * 100 / fcb.f_sector_cnt;
+	return size;
 }
 
-size_t log_rpc_history_get_usage_size(void)
+size_t log_rpc_history_get_max_size(void)
+{
+	return CONFIG_LOG_BACKEND_RPC_HISTORY_SIZE;
+}
+
+uint32_t log_rpc_history_get_dropped(void)
 {
-	int num_free_sectors;
-	size_t used_size;
+	uint32_t cnt;
 
 	k_mutex_lock(&fcb_lock, K_FOREVER);
 
-	num_free_sectors = fcb_free_sector_cnt(&fcb);
+	cnt = dropped_cnt;
 
 	k_mutex_unlock(&fcb_lock);
 
+	return cnt;
+}
+
+void log_rpc_history_save_checksum(void)
+{
 	/*
-	 * Calculate the used size in bytes based on the number of used sectors.
-	 * This provides sector-level granularity for the size calculation.
+	 * Called on the panic path, so the block that is being filled is stored synchronously
+	 * and the lock is not waited for. If the lock is held by the interrupted context, the
+	 * block may be inconsistent and it is left in RAM.
 	 */
-	used_size = (fcb.f_sector_cnt - num_free_sectors) * fcb_sectors[0].fs_size;
+	if (k_is_in_isr()) {
+		if (fcb_lock.lock_count == 0) {
+			(void)block_flush();
+		}
 
-	return used_size;
-}
+		return;
+	}
 
-size_t log_rpc_history_get_max_size(void)
-{
-	return CONFIG_LOG_BACKEND_RPC_HISTORY_SIZE;
+	if (k_mutex_lock(&fcb_lock, K_NO_WAIT) != 0) {
+		return;
+	}
+
+	(void)block_flush();
+
+	k_mutex_unlock(&fcb_lock);
 }
@@ -70,6 +70,9 @@ static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT) log_history_raw[HISTORY_WLEN];
 static struct mpsc_pbuf_buffer log_history_pbuf;
 #endif
 
+/* Number of log messages that could not be stored. */
+static uint32_t dropped_cnt;
+
 void log_rpc_history_init(void)
 {
 	const struct mpsc_pbuf_buffer_config log_history_config = {
@@ -143,6 +146,7 @@ void log_rpc_history_push(const union log_msg_generic *msg)
 
 	dst = mpsc_pbuf_alloc(&log_history_pbuf, wlen, K_NO_WAIT);
 	if (!dst) {
+		dropped_cnt++;
 		return;
 	}
 
@@ -210,6 +214,11 @@ size_t log_rpc_history_get_max_size(void)
 	return CONFIG_LOG_BACKEND_RPC_HISTORY_SIZE;
 }
 
+uint32_t log_rpc_history_get_dropped(void)
+{
+	return dropped_cnt;
+}
+
 void log_rpc_history_save_checksum(void)
 {
 #if LOG_RPC_HISTORY_FIXED_REGION_DEFINED
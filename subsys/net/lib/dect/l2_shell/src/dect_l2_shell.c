@@ -2907,6 +2907,18 @@ static void dect_shell_status_cmd_print(struct dect_status_info *dect_status)
 				    "    Border router global IPv6 address: not set");
 	}
 #endif
+	if (dect_status->tx_stats.sent || dect_status->tx_stats.dropped) {
+		dect_l2_shell_print("  Data TX:");
+		dect_l2_shell_print("    Queued/sent/dropped:        %u/%u/%u",
+				    dect_status->tx_stats.queued, dect_status->tx_stats.sent,
+				    dect_status->tx_stats.dropped);
+		dect_l2_shell_print("    Queue depth (max):          %u (%u)",
+				    dect_status->tx_stats.queue_depth,
+				    dect_status->tx_stats.queue_depth_max);
+		dect_l2_shell_print("    Latency avg/max:            %u/%u ms",
+				    dect_status->tx_stats.latency_avg_ms,
+				    dect_status->tx_stats.latency_max_ms);
+	}
 #if defined(CONFIG_MODEM_CELLULAR)
 	print_cellular_info();
 #endif
@@ -175,12 +175,13 @@ static void restart_and_suspend(struct downloader *dl)
 	state_set(dl, DOWNLOADER_DOWNLOADING, DOWNLOADER_CONNECTED);
 }
 
-static int data_evt_send(const struct downloader *dl, void *data, size_t len)
+static int data_evt_send(const struct downloader *dl, void *data, size_t len, bool app_buf)
 {
 	const struct downloader_evt evt = {.id = DOWNLOADER_EVT_FRAGMENT,
 					   .fragment = {
 						   .buf = data,
 						   .len = len,
+						   .app_buf = app_buf,
 					   }};
 
 	return dl->cfg.callback(&evt);
@@ -224,7 +225,7 @@ static int deinit_evt_send(const struct downloader *dl)
 }
 
 /* Events from the transport */
-int dl_transport_evt_data(struct downloader *dl, void *data, size_t len)
+static int transport_evt_data(struct downloader *dl, void *data, size_t len, bool app_buf)
 {
 	int err;
 
@@ -237,7 +238,7 @@ int dl_transport_evt_data(struct downloader *dl, void *data, size_t len)
 		LOG_INF("Downloaded %u bytes", dl->progress);
 	}
 
-	err = data_evt_send(dl, data, len);
+	err = data_evt_send(dl, data, len, app_buf);
 	if (err) {
 		/* Application refused data, suspend */
 		restart_and_suspend(dl);
@@ -246,6 +247,29 @@ int dl_transport_evt_data(struct downloader *dl, void *data, size_t len)
 	return 0;
 }
 
+int dl_transport_evt_data(struct downloader *dl, void *data, size_t len)
+{
+	return transport_evt_data(dl, data, len, false);
+}
+
+int dl_transport_evt_app_buf_data(struct downloader *dl, void *data, size_t len)
+{
+	return transport_evt_data(dl, data, len, true);
+}
+
+int dl_transport_app_buf_get(struct downloader *dl, void **buf, size_t *len)
+{
+	if (!dl->cfg.buf_get) {
+		return -ENOTSUP;
+	}
+
+	if (dl->cfg.buf_get(buf, len) || *len == 0) {
+		return -ENOBUFS;
+	}
+
+	return 0;
+}
+
 void download_thread(void *cli, void *a, void *b)
 {
 	int rc, rc2;
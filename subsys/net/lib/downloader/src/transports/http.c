@@ -598,10 +598,73 @@ static int dl_http_close(struct downloader *dl)
 	return -EBADF;
 }
 
+static void http_progress_update(struct downloader *dl, size_t data_len)
+{
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	if (http->ranged) {
+		http->ranged_progress += data_len;
+		if (http->ranged_progress < dl->host_cfg.range_override) {
+			/* Ranged query: read until a full fragment is received */
+		} else {
+			/* Ranged query: request next fragment */
+			http->new_data_req = true;
+		}
+	}
+	if (dl->progress == dl->file_size) {
+		/* A full file has been received */
+		dl->complete = true;
+		http->new_data_req = true;
+	}
+}
+
+/* Receive payload directly into the application buffer, saving a copy */
+static int http_app_buf_download(struct downloader *dl, void *buf, size_t len)
+{
+	int recv_len;
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	/* Do not read beyond the current response */
+	if (dl->file_size) {
+		len = MIN(len, dl->file_size - dl->progress);
+	}
+	if (http->ranged) {
+		len = MIN(len, dl->host_cfg.range_override - http->ranged_progress);
+	}
+
+	LOG_DBG("Receiving up to %d bytes at %p...", len, buf);
+
+	recv_len = dl_socket_recv(http->sock.fd, buf, len);
+	if (recv_len < 0) {
+		if (http->connection_close) {
+			return -ECONNRESET;
+		}
+
+		return recv_len;
+	}
+
+	if (recv_len == 0) {
+		/* Connection closed while expecting more */
+		return -ECONNRESET;
+	}
+
+	dl->progress += recv_len;
+	dl_transport_evt_app_buf_data(dl, buf, recv_len);
+	http_progress_update(dl, recv_len);
+
+	return 0;
+}
+
 static int dl_http_download(struct downloader *dl)
 {
 	int ret, recv_len, data_len, expected_len;
 	struct transport_params_http *http;
+	void *app_buf;
+	size_t app_buf_len;
 
 	http = (struct transport_params_http *)dl->transport_internal;
 
@@ -618,6 +681,11 @@ static int dl_http_download(struct downloader *dl)
 		http->new_data_req = false;
 	}
 
+	if (http->header.has_end && dl->buf_offset == 0 &&
+	    dl_transport_app_buf_get(dl, &app_buf, &app_buf_len) == 0) {
+		return http_app_buf_download(dl, app_buf, app_buf_len);
+	}
+
 	__ASSERT(dl->buf_offset < dl->cfg.buf_size, "Buffer overflow");
 
 	LOG_DBG("Receiving up to %d bytes at %p...", (dl->cfg.buf_size - dl->buf_offset),
@@ -666,20 +734,7 @@ static int dl_http_download(struct downloader *dl)
 	if (data_len) {
 		dl_transport_evt_data(dl, dl->cfg.buf, data_len);
 	}
-	if (http->ranged) {
-		http->ranged_progress += data_len;
-		if (http->ranged_progress < dl->host_cfg.range_override) {
-			/* Ranged query: read until a full fragment is received */
-		} else {
-			/* Ranged query: request next fragment */
-			http->new_data_req = true;
-		}
-	}
-	if (dl->progress == dl->file_size) {
-		/* A full file has been received */
-		dl->complete = true;
-		http->new_data_req = true;
-	}
+	http_progress_update(dl, data_len);
 	dl->buf_offset = 0;
 
 	if (dl->complete) {
@@ -37,11 +37,17 @@ static uint32_t dl_file_hash;
 
 static struct downloader dl;
 static int downloader_callback(const struct downloader_evt *event);
+#ifdef CONFIG_FOTA_DOWNLOAD_ZERO_COPY
+static int downloader_buf_get(void **buf, size_t *len);
+#endif
 static char dl_buf[CONFIG_FOTA_DOWNLOAD_BUF_SZ];
 static struct downloader_cfg dl_cfg = {
 	.callback = downloader_callback,
 	.buf = dl_buf,
 	.buf_size = sizeof(dl_buf),
+#ifdef CONFIG_FOTA_DOWNLOAD_ZERO_COPY
+	.buf_get = downloader_buf_get,
+#endif
 };
 static struct downloader_host_cfg dl_host_cfg;
 /** SMP MCUBoot image type */
@@ -146,6 +152,18 @@ static int dl_cancel(void)
 	return downloader_cancel(&dl);
 }
 
+#ifdef CONFIG_FOTA_DOWNLOAD_ZERO_COPY
+static int downloader_buf_get(void **buf, size_t *len)
+{
+	if (atomic_test_bit(&flags, FLAG_FIRST_FRAGMENT)) {
+		/* The first fragment selects and initializes the DFU target */
+		return -EAGAIN;
+	}
+
+	return dfu_target_write_buf_get(buf, len);
+}
+#endif
+
 static int downloader_callback(const struct downloader_evt *event)
 {
 	static size_t file_size;
@@ -252,7 +270,16 @@ static int downloader_callback(const struct downloader_evt *event)
 			}
 		}
 
+#ifdef CONFIG_FOTA_DOWNLOAD_ZERO_COPY
+		if (event->fragment.app_buf) {
+			/* Already in the write buffer of the DFU target */
+			err = dfu_target_write_buf_commit(event->fragment.len);
+		} else {
+			err = dfu_target_write(event->fragment.buf, event->fragment.len);
+		}
+#else
 		err = dfu_target_write(event->fragment.buf, event->fragment.len);
+#endif
 		if (err && err == -EINVAL) {
 			LOG_INF("Image refused");
 			set_error_state(FOTA_DOWNLOAD_ERROR_CAUSE_INVALID_UPDATE);
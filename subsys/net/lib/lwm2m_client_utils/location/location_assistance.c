@@ -14,6 +14,7 @@
 LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 
 #include <zephyr/net/lwm2m_path.h>
+#include <net/lwm2m_client_utils.h>
 #include <net/lwm2m_client_utils_location.h>
 #include <zephyr/net/lwm2m.h>
 #include "lwm2m_engine.h"
@@ -294,6 +295,11 @@ static int do_agnss_request_send(struct lwm2m_ctx *ctx)
 		LWM2M_OBJ(GNSS_ASSIST_OBJECT_ID, 0, GNSS_ASSIST_ELEVATION_MASK)
 	};
 
+#if defined(CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE)
+	/* The request carries the current cell information */
+	lwm2m_coalesce_flush();
+#endif
+
 	/* Send Request to server */
 	return lwm2m_send_cb(ctx, send_path, path_count, NULL);
 }
@@ -354,6 +360,11 @@ static int do_ground_fix_request_send(struct lwm2m_ctx *ctx)
 #endif
 	};
 
+#if defined(CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE)
+	/* The request carries the current cell information */
+	lwm2m_coalesce_flush();
+#endif
+
 	/* Send Request to server */
 	return lwm2m_send_cb(ctx, send_path, path_count, gfix_cb);
 }
@@ -15,6 +15,7 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 
 #include "lwm2m_object.h"
 #include "lwm2m_engine.h"
+#include <net/lwm2m_client_utils.h>
 #include <net/lwm2m_client_utils_location.h>
 #include <modem/modem_info.h>
 
@@ -95,18 +96,18 @@ static void update_signal_meas_object(const struct lte_lc_ncell *const cell, uin
 	obj_inst_id = lwm2m_signal_meas_info_index_to_inst_id(index);
 	path = LWM2M_OBJ(10256, obj_inst_id, SIGNAL_MEAS_INFO_PHYS_CELL_ID);
 
-	lwm2m_set_s32(&path, cell->phys_cell_id);
+	lwm2m_coalesce_set_s32(&path, cell->phys_cell_id);
 	/* We don't set the resource 1 as the lte_lc_ncell struct doesn't
 	 * contain MCC and MNC for calculating ECGI
 	 */
 	path.res_id = SIGNAL_MEAS_INFO_ARFCN_EUTRA;
-	lwm2m_set_s32(&path, cell->earfcn);
+	lwm2m_coalesce_set_s32(&path, cell->earfcn);
 	path.res_id = SIGNAL_MEAS_INFO_RSRP_RESULT;
-	lwm2m_set_s32(&path, RSRP_IDX_TO_DBM(cell->rsrp));
+	lwm2m_coalesce_set_s32(&path, RSRP_IDX_TO_DBM(cell->rsrp));
 	path.res_id = SIGNAL_MEAS_INFO_RSRQ_RESULT;
-	lwm2m_set_s32(&path, RSRQ_IDX_TO_DB(cell->rsrq));
+	lwm2m_coalesce_set_s32(&path, RSRQ_IDX_TO_DB(cell->rsrq));
 	path.res_id = SIGNAL_MEAS_INFO_UE_RXTX_TIMEDIFF;
-	lwm2m_set_s32(&path, cell->time_diff);
+	lwm2m_coalesce_set_s32(&path, cell->time_diff);
 }
 
 static void reset_signal_meas_object(uint16_t index)
@@ -117,15 +118,15 @@ static void reset_signal_meas_object(uint16_t index)
 	obj_inst_id = lwm2m_signal_meas_info_index_to_inst_id(index);
 	path = LWM2M_OBJ(10256, obj_inst_id, SIGNAL_MEAS_INFO_PHYS_CELL_ID);
 
-	lwm2m_set_s32(&path, 0);
+	lwm2m_coalesce_set_s32(&path, 0);
 	path.res_id = SIGNAL_MEAS_INFO_ARFCN_EUTRA;
-	lwm2m_set_s32(&path, 0);
+	lwm2m_coalesce_set_s32(&path, 0);
 	path.res_id = SIGNAL_MEAS_INFO_RSRP_RESULT;
-	lwm2m_set_s32(&path, 0);
+	lwm2m_coalesce_set_s32(&path, 0);
 	path.res_id = SIGNAL_MEAS_INFO_RSRQ_RESULT;
-	lwm2m_set_s32(&path, 0);
+	lwm2m_coalesce_set_s32(&path, 0);
 	path.res_id = SIGNAL_MEAS_INFO_UE_RXTX_TIMEDIFF;
-	lwm2m_set_s32(&path, 0);
+	lwm2m_coalesce_set_s32(&path, 0);
 }
 
 int lwm2m_update_signal_meas_objects(const struct lte_lc_cells_info *const cells)
@@ -226,6 +227,11 @@ static int lwm2m_signal_meas_info_init(void)
 		if (ret < 0) {
 			LOG_ERR("Create LWM2M server instance %d error: %d", i, ret);
 		}
+#if defined(CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE)
+		lwm2m_coalesce_step_set(&LWM2M_OBJ(ECID_SIGNAL_MEASUREMENT_INFO_OBJECT_ID, i,
+						   SIGNAL_MEAS_INFO_RSRP_RESULT),
+					CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE_SIGNAL_STEP);
+#endif
 	}
 
 	return 0;
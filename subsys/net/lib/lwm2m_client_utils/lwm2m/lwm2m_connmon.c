@@ -101,15 +101,15 @@ static void modem_data_update(struct k_work *work)
 			 CONNMON_APN, 0), modem_param.network.apn.value_string);
 	lwm2m_set_string(&LWM2M_OBJ(LWM2M_OBJECT_DEVICE_ID, 0, DEVICE_FIRMWARE_VERSION_ID),
 			 modem_param.device.modem_fw.value_string);
-	lwm2m_set_u32(&LWM2M_OBJ(LWM2M_OBJECT_CONNECTIVITY_MONITORING_ID, 0, CONNMON_CELLID),
-		      (uint32_t)modem_param.network.cellid_dec);
-	lwm2m_set_u16(&LWM2M_OBJ(LWM2M_OBJECT_CONNECTIVITY_MONITORING_ID, 0, CONNMON_SMNC),
-		      modem_param.network.mnc.value);
-	lwm2m_set_u16(&LWM2M_OBJ(LWM2M_OBJECT_CONNECTIVITY_MONITORING_ID, 0, CONNMON_SMCC),
-		      modem_param.network.mcc.value);
+	lwm2m_coalesce_set_u32(&LWM2M_OBJ(LWM2M_OBJECT_CONNECTIVITY_MONITORING_ID, 0,
+					  CONNMON_CELLID), (uint32_t)modem_param.network.cellid_dec);
+	lwm2m_coalesce_set_u16(&LWM2M_OBJ(LWM2M_OBJECT_CONNECTIVITY_MONITORING_ID, 0, CONNMON_SMNC),
+			       modem_param.network.mnc.value);
+	lwm2m_coalesce_set_u16(&LWM2M_OBJ(LWM2M_OBJECT_CONNECTIVITY_MONITORING_ID, 0, CONNMON_SMCC),
+			       modem_param.network.mcc.value);
 #if defined(CONNMON_LAC)
-	lwm2m_set_u16(&LWM2M_OBJ(LWM2M_OBJECT_CONNECTIVITY_MONITORING_ID, 0, CONNMON_LAC),
-		      modem_param.network.area_code.value);
+	lwm2m_coalesce_set_u16(&LWM2M_OBJ(LWM2M_OBJECT_CONNECTIVITY_MONITORING_ID, 0, CONNMON_LAC),
+			       modem_param.network.area_code.value);
 #endif
 }
 
@@ -135,7 +135,7 @@ static void modem_signal_update(struct k_work *work)
 		return;
 	}
 
-	lwm2m_set_s16(&LWM2M_OBJ(4, 0, 2), modem_rsrp);
+	lwm2m_coalesce_set_s16(&LWM2M_OBJ(4, 0, 2), modem_rsrp);
 	timestamp_prev = k_uptime_get_32();
 }
 
@@ -215,6 +215,12 @@ static int lwm2m_init_connmon_cb(void)
 	}
 	connmon_data_init();
 
+#if defined(CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE)
+	lwm2m_coalesce_step_set(&LWM2M_OBJ(LWM2M_OBJECT_CONNECTIVITY_MONITORING_ID, 0,
+					   CONNMON_RADIO_SIGNAL_STRENGTH),
+				CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE_SIGNAL_STEP);
+#endif
+
 	lte_lc_register_handler(connmon_lte_notify_handler);
 	return 0;
 }
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/net/lwm2m.h>
+#include <net/lwm2m_client_utils.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(lwm2m_notify_coalesce, CONFIG_LWM2M_CLIENT_UTILS_LOG_LEVEL);
+
+#define COALESCE_RESOURCES CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE_RESOURCES
+
+enum coalesce_type {
+	COALESCE_TYPE_U16,
+	COALESCE_TYPE_U32,
+	COALESCE_TYPE_S16,
+	COALESCE_TYPE_S32,
+};
+
+struct coalesce_entry {
+	struct lwm2m_obj_path path;
+	enum coalesce_type type;
+	uint32_t step;
+	int64_t reported;
+	int64_t pending;
+	bool in_use;
+	bool has_reported;
+	bool has_pending;
+};
+
+static struct coalesce_entry entries[COALESCE_RESOURCES];
+static struct lwm2m_coalesce_stats stats;
+static K_MUTEX_DEFINE(coalesce_mutex);
+
+static void coalesce_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(coalesce_work, coalesce_work_fn);
+
+static bool path_equal(const struct lwm2m_obj_path *a, const struct lwm2m_obj_path *b)
+{
+	return a->level == b->level && a->obj_id == b->obj_id &&
+	       a->obj_inst_id == b->obj_inst_id && a->res_id == b->res_id &&
+	       a->res_inst_id == b->res_inst_id;
+}
+
+/* Must be called with coalesce_mutex held. */
+static struct coalesce_entry *entry_get(const struct lwm2m_obj_path *path, bool create)
+{
+	struct coalesce_entry *unused = NULL;
+
+	for (int i = 0; i < COALESCE_RESOURCES; i++) {
+		if (!entries[i].in_use) {
+			if (!unused) {
+				unused = &entries[i];
+			}
+			continue;
+		}
+		if (path_equal(&entries[i].path, path)) {
+			return &entries[i];
+		}
+	}
+
+	if (!create || !unused) {
+		return NULL;
+	}
+
+	memset(unused, 0, sizeof(*unused));
+	unused->path = *path;
+	unused->in_use = true;
+
+	return unused;
+}
+
+static int value_write(const struct lwm2m_obj_path *path, enum coalesce_type type, int64_t value)
+{
+	switch (type) {
+	case COALESCE_TYPE_U16:
+		return lwm2m_set_u16(path, (uint16_t)value);
+	case COALESCE_TYPE_U32:
+		return lwm2m_set_u32(path, (uint32_t)value);
+	case COALESCE_TYPE_S16:
+		return lwm2m_set_s16(path, (int16_t)value);
+	case COALESCE_TYPE_S32:
+		return lwm2m_set_s32(path, (int32_t)value);
+	default:
+		return -EINVAL;
+	}
+}
+
+static void coalesce_flush(void)
+{
+	int count = 0;
+	int ret;
+
+	k_mutex_lock(&coalesce_mutex, K_FOREVER);
+
+	for (int i = 0; i < COALESCE_RESOURCES; i++) {
+		struct coalesce_entry *entry = &entries[i];
+
+		if (!entry->in_use || !entry->has_pending) {
+			continue;
+		}
+
+		entry->has_pending = false;
+		ret = value_write(&entry->path, entry->type, entry->pending);
+		if (ret) {
+			LOG_WRN("Unable to write %d/%d/%d (%d)", entry->path.obj_id,
+				entry->path.obj_inst_id, entry->path.res_id, ret);
+			continue;
+		}
+
+		entry->reported = entry->pending;
+		entry->has_reported = true;
+		stats.written++;
+		count++;
+	}
+
+	k_mutex_unlock(&coalesce_mutex);
+
+	LOG_DBG("Wrote %d coalesced updates", count);
+}
+
+static void coalesce_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	coalesce_flush();
+}
+
+static int coalesce_set(const struct lwm2m_obj_path *path, enum coalesce_type type,
+			int64_t value)
+{
+	struct coalesce_entry *entry;
+
+	if (!path) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&coalesce_mutex, K_FOREVER);
+
+	entry = entry_get(path, true);
+	if (!entry) {
+		k_mutex_unlock(&coalesce_mutex);
+		LOG_DBG("No room to coalesce %d/%d/%d", path->obj_id, path->obj_inst_id,
+			path->res_id);
+		return value_write(path, type, value);
+	}
+
+	entry->type = type;
+
+	if (entry->has_reported &&
+	    llabs(value - entry->reported) < (int64_t)MAX(entry->step, 1)) {
+		/* Back within the step of the reported value, nothing to report */
+		entry->has_pending = false;
+		stats.suppressed++;
+		k_mutex_unlock(&coalesce_mutex);
+		return 0;
+	}
+
+	if (entry->has_pending) {
+		stats.coalesced++;
+	}
+
+	entry->pending = value;
+	entry->has_pending = true;
+
+	k_mutex_unlock(&coalesce_mutex);
+
+	/* Keeps the deadline of the first pending update */
+	k_work_schedule(&coalesce_work,
+			K_MSEC(CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE_WINDOW_MS));
+
+	return 0;
+}
+
+int lwm2m_coalesce_step_set(const struct lwm2m_obj_path *path, uint32_t step)
+{
+	struct coalesce_entry *entry;
+
+	if (!path) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&coalesce_mutex, K_FOREVER);
+
+	entry = entry_get(path, true);
+	if (entry) {
+		entry->step = step;
+	}
+
+	k_mutex_unlock(&coalesce_mutex);
+
+	return entry ? 0 : -ENOMEM;
+}
+
+int lwm2m_coalesce_set_u16(const struct lwm2m_obj_path *path, uint16_t value)
+{
+	return coalesce_set(path, COALESCE_TYPE_U16, value);
+}
+
+int lwm2m_coalesce_set_u32(const struct lwm2m_obj_path *path, uint32_t value)
+{
+	return coalesce_set(path, COALESCE_TYPE_U32, value);
+}
+
+int lwm2m_coalesce_set_s16(const struct lwm2m_obj_path *path, int16_t value)
+{
+	return coalesce_set(path, COALESCE_TYPE_S16, value);
+}
+
+int lwm2m_coalesce_set_s32(const struct lwm2m_obj_path *path, int32_t value)
+{
+	return coalesce_set(path, COALESCE_TYPE_S32, value);
+}
+
+void lwm2m_coalesce_flush(void)
+{
+	(void)k_work_cancel_delayable(&coalesce_work);
+	coalesce_flush();
+}
+
+void lwm2m_coalesce_stats_get(struct lwm2m_coalesce_stats *stats_out)
+{
+	if (!stats_out) {
+		return;
+	}
+
+	k_mutex_lock(&coalesce_mutex, K_FOREVER);
+	*stats_out = stats;
+	k_mutex_unlock(&coalesce_mutex);
+}
@@ -37,6 +37,41 @@ MQTT_HELPER_STATIC K_SEM_DEFINE(connection_poll_sem, 0, 1);
 static struct mqtt_helper_cfg current_cfg;
 MQTT_HELPER_STATIC enum mqtt_state mqtt_state = MQTT_STATE_UNINIT;
 
+#if defined(CONFIG_MQTT_HELPER_DNS_CACHE)
+/* Large enough for any valid hostname. Longer hostnames are not cached. */
+#define DNS_CACHE_HOSTNAME_SIZE 254
+
+static struct {
+	char hostname[DNS_CACHE_HOSTNAME_SIZE];
+	struct net_sockaddr_storage addr;
+	int64_t timestamp;
+	bool valid;
+} dns_cache;
+#endif /* CONFIG_MQTT_HELPER_DNS_CACHE */
+
+#if defined(CONFIG_MQTT_HELPER_PUBLISH_QUEUE)
+struct publish_queue_entry {
+	uint16_t message_id;
+	/* The message has been sent and is resent with the DUP flag set. */
+	bool sent;
+	bool retain;
+	uint16_t topic_len;
+	uint16_t payload_len;
+	/* Topic followed by the payload. */
+	uint8_t data[CONFIG_MQTT_HELPER_PUBLISH_QUEUE_MSG_SIZE];
+};
+
+/* QoS 1 messages that have not been acknowledged, in the order they were published. */
+static struct publish_queue_entry publish_queue[CONFIG_MQTT_HELPER_PUBLISH_QUEUE_LEN];
+static size_t publish_queue_count;
+static K_MUTEX_DEFINE(publish_queue_lock);
+#endif /* CONFIG_MQTT_HELPER_PUBLISH_QUEUE */
+
+#if defined(CONFIG_MQTT_HELPER_STATS)
+static struct mqtt_helper_stats stats;
+static int64_t transport_connect_start;
+#endif /* CONFIG_MQTT_HELPER_STATS */
+
 static const char *state_name_get(enum mqtt_state state)
 {
 	switch (state) {
@@ -241,6 +276,143 @@ static int certificates_provision(void)
 }
 #endif /* CONFIG_MQTT_HELPER_PROVISION_CERTIFICATES */
 
+#if defined(CONFIG_MQTT_HELPER_PUBLISH_QUEUE)
+/* Must be called with publish_queue_lock held. */
+static int publish_queue_add(const struct mqtt_publish_param *param, bool sent)
+{
+	struct publish_queue_entry *entry;
+	size_t topic_len = param->message.topic.topic.size;
+	size_t payload_len = param->message.payload.len;
+
+	if (topic_len + payload_len > sizeof(entry->data)) {
+		LOG_ERR("Message ID %d is too large to be queued", param->message_id);
+		return -EMSGSIZE;
+	}
+
+	if (publish_queue_count == ARRAY_SIZE(publish_queue)) {
+		LOG_ERR("Publish queue is full, message ID %d not queued", param->message_id);
+		return -ENOMEM;
+	}
+
+	entry = &publish_queue[publish_queue_count++];
+	entry->message_id = param->message_id;
+	entry->sent = sent;
+	entry->retain = param->retain_flag;
+	entry->topic_len = topic_len;
+	entry->payload_len = payload_len;
+
+	memcpy(entry->data, param->message.topic.topic.utf8, topic_len);
+
+	if (payload_len > 0) {
+		memcpy(entry->data + topic_len, param->message.payload.data, payload_len);
+	}
+
+	return 0;
+}
+
+static void publish_queue_remove(uint16_t message_id)
+{
+	k_mutex_lock(&publish_queue_lock, K_FOREVER);
+
+	for (size_t i = 0; i < publish_queue_count; i++) {
+		if (publish_queue[i].message_id == message_id) {
+			publish_queue_count--;
+			memmove(&publish_queue[i], &publish_queue[i + 1],
+				(publish_queue_count - i) * sizeof(publish_queue[0]));
+			break;
+		}
+	}
+
+	k_mutex_unlock(&publish_queue_lock);
+}
+
+/* Sends all queued messages back-to-back so that they share the radio activity
+ * of the connection setup. Must be called with publish_queue_lock held.
+ */
+static void publish_queue_replay(void)
+{
+	int err;
+	size_t i;
+
+	for (i = 0; i < publish_queue_count; i++) {
+		struct publish_queue_entry *entry = &publish_queue[i];
+		struct mqtt_publish_param param = {
+			.message = {
+				.topic = {
+					.topic = {
+						.utf8 = entry->data,
+						.size = entry->topic_len,
+					},
+					.qos = MQTT_QOS_1_AT_LEAST_ONCE,
+				},
+				.payload = {
+					.data = entry->data + entry->topic_len,
+					.len = entry->payload_len,
+				},
+			},
+			.message_id = entry->message_id,
+			.dup_flag = entry->sent,
+			.retain_flag = entry->retain,
+		};
+
+		err = mqtt_publish(&mqtt_client, &param);
+		if (err) {
+			LOG_WRN("Failed to send queued message ID %d, error: %d",
+				entry->message_id, err);
+			break;
+		}
+
+		entry->sent = true;
+
+#if defined(CONFIG_MQTT_HELPER_STATS)
+		stats.tx_bytes += entry->topic_len + entry->payload_len;
+		stats.replayed_count++;
+#endif /* CONFIG_MQTT_HELPER_STATS */
+	}
+
+	if (i > 0) {
+		LOG_DBG("Sent %d queued messages", (int)i);
+	}
+}
+
+static int publish_qos1(const struct mqtt_publish_param *param)
+{
+	int err;
+
+	/* The state is checked with the lock held so that a message queued while
+	 * connecting is not missed by the replay after CONNACK.
+	 */
+	k_mutex_lock(&publish_queue_lock, K_FOREVER);
+
+	if (mqtt_state_verify(MQTT_STATE_CONNECTED)) {
+		err = mqtt_publish(&mqtt_client, param);
+		if (!err && publish_queue_add(param, true)) {
+			LOG_WRN("Message ID %d is not resent if the connection is lost",
+				param->message_id);
+		}
+
+#if defined(CONFIG_MQTT_HELPER_STATS)
+		if (!err) {
+			stats.tx_bytes += param->message.topic.topic.size +
+					  param->message.payload.len;
+		}
+#endif /* CONFIG_MQTT_HELPER_STATS */
+	} else if (mqtt_state_verify(MQTT_STATE_UNINIT)) {
+		LOG_ERR("Library is not initialized");
+		err = -EOPNOTSUPP;
+	} else {
+		err = publish_queue_add(param, false);
+		if (!err) {
+			LOG_DBG("Not connected, message ID %d queued", param->message_id);
+		}
+	}
+
+	k_mutex_unlock(&publish_queue_lock);
+
+	return err;
+}
+#endif /* CONFIG_MQTT_HELPER_PUBLISH_QUEUE */
+
 static int publish_get_payload(struct mqtt_client *const mqtt_client, size_t length)
 {
 	if (length > sizeof(payload_buf)) {
@@ -296,6 +468,10 @@ MQTT_HELPER_STATIC void on_publish(const struct mqtt_evt *mqtt_evt)
 
 	payload.size = p->message.payload.len;
 
+#if defined(CONFIG_MQTT_HELPER_STATS)
+	stats.rx_bytes += topic.size + payload.size;
+#endif /* CONFIG_MQTT_HELPER_STATS */
+
 	if (current_cfg.cb.on_publish) {
 		current_cfg.cb.on_publish(topic, payload);
 	}
@@ -317,7 +493,22 @@ MQTT_HELPER_STATIC void mqtt_evt_handler(struct mqtt_client *const mqtt_client,
 		LOG_DBG("MQTT mqtt_client connected");
 
 		if (mqtt_evt->param.connack.return_code == MQTT_CONNECTION_ACCEPTED) {
+#if defined(CONFIG_MQTT_HELPER_STATS)
+			stats.connack_time_ms = k_uptime_get() - transport_connect_start;
+#endif /* CONFIG_MQTT_HELPER_STATS */
+
+#if defined(CONFIG_MQTT_HELPER_PUBLISH_QUEUE)
+			/* The state is changed and the queue replayed with the lock held so that
+			 * a message published meanwhile is neither missed nor sent ahead of the
+			 * queued ones.
+			 */
+			k_mutex_lock(&publish_queue_lock, K_FOREVER);
 			mqtt_state_set(MQTT_STATE_CONNECTED);
+			publish_queue_replay();
+			k_mutex_unlock(&publish_queue_lock);
+#else
+			mqtt_state_set(MQTT_STATE_CONNECTED);
+#endif /* CONFIG_MQTT_HELPER_PUBLISH_QUEUE */
 		} else {
 			mqtt_state_set(MQTT_STATE_DISCONNECTED);
 		}
@@ -347,6 +538,10 @@ MQTT_HELPER_STATIC void mqtt_evt_handler(struct mqtt_client *const mqtt_client,
 			mqtt_evt->param.puback.message_id,
 			mqtt_evt->result);
 
+#if defined(CONFIG_MQTT_HELPER_PUBLISH_QUEUE)
+		publish_queue_remove(mqtt_evt->param.puback.message_id);
+#endif /* CONFIG_MQTT_HELPER_PUBLISH_QUEUE */
+
 		if (current_cfg.cb.on_puback) {
 			current_cfg.cb.on_puback(mqtt_evt->param.puback.message_id,
 						 mqtt_evt->result);
@@ -374,6 +569,38 @@ MQTT_HELPER_STATIC void mqtt_evt_handler(struct mqtt_client *const mqtt_client,
 	}
 }
 
+#if defined(CONFIG_MQTT_HELPER_DNS_CACHE)
+static bool dns_cache_get(const char *hostname, struct net_sockaddr_storage *addr)
+{
+	if (!dns_cache.valid || strcmp(dns_cache.hostname, hostname) != 0) {
+		return false;
+	}
+
+	if (k_uptime_get() - dns_cache.timestamp >=
+	    (int64_t)CONFIG_MQTT_HELPER_DNS_CACHE_TTL * MSEC_PER_SEC) {
+		LOG_DBG("Cached address for %s has expired", hostname);
+		dns_cache.valid = false;
+		return false;
+	}
+
+	*addr = dns_cache.addr;
+
+	return true;
+}
+
+static void dns_cache_set(const char *hostname, const struct net_sockaddr_storage *addr)
+{
+	if (strlen(hostname) >= sizeof(dns_cache.hostname)) {
+		return;
+	}
+
+	strcpy(dns_cache.hostname, hostname);
+	dns_cache.addr = *addr;
+	dns_cache.timestamp = k_uptime_get();
+	dns_cache.valid = true;
+}
+#endif /* CONFIG_MQTT_HELPER_DNS_CACHE */
+
 static int broker_init(struct net_sockaddr_storage *broker,
 		       struct mqtt_helper_conn_params *conn_params)
 {
@@ -384,6 +611,7 @@ static int broker_init(struct net_sockaddr_storage *broker,
 		.ai_socktype = NET_SOCK_STREAM
 	};
 	char addr_str[NET_IPV6_ADDR_LEN];
+	bool found = false;
 
 	if (sizeof(CONFIG_MQTT_HELPER_STATIC_IP_ADDRESS) > 1) {
 		conn_params->hostname.ptr = CONFIG_MQTT_HELPER_STATIC_IP_ADDRESS;
@@ -393,6 +621,18 @@ static int broker_init(struct net_sockaddr_storage *broker,
 		LOG_DBG("Resolving IP address for %s", conn_params->hostname.ptr);
 	}
 
+#if defined(CONFIG_MQTT_HELPER_DNS_CACHE)
+	if (dns_cache_get(conn_params->hostname.ptr, broker)) {
+		LOG_DBG("Using cached IP address for %s", conn_params->hostname.ptr);
+
+#if defined(CONFIG_MQTT_HELPER_STATS)
+		stats.dns_cache_hits++;
+#endif /* CONFIG_MQTT_HELPER_STATS */
+
+		return 0;
+	}
+#endif /* CONFIG_MQTT_HELPER_DNS_CACHE */
+
 	err = zsock_getaddrinfo(conn_params->hostname.ptr, NULL, &hints, &result);
 	if (err) {
 		LOG_ERR("getaddrinfo() failed, error %d", err);
@@ -414,6 +654,7 @@ static int broker_init(struct net_sockaddr_storage *broker,
 					addr_str, sizeof(addr_str));
 			LOG_DBG("IPv6 Address found %s (%s)", addr_str,
 				net_family2str(addr->ai_family));
+			found = true;
 			break;
 		} else if (addr->ai_family == NET_AF_INET) {
 			struct net_sockaddr_in *broker4 = ((struct net_sockaddr_in *)broker);
@@ -427,6 +668,7 @@ static int broker_init(struct net_sockaddr_storage *broker,
 					addr_str, sizeof(addr_str));
 			LOG_DBG("IPv4 Address found %s (%s)", addr_str,
 				net_family2str(addr->ai_family));
+			found = true;
 			break;
 		} else {
 			LOG_DBG("Unknown address family %d", (unsigned int)addr->ai_family);
@@ -437,6 +679,14 @@ static int broker_init(struct net_sockaddr_storage *broker,
 
 	zsock_freeaddrinfo(result);
 
+#if defined(CONFIG_MQTT_HELPER_DNS_CACHE)
+	if (found) {
+		dns_cache_set(conn_params->hostname.ptr, broker);
+	}
+#else
+	ARG_UNUSED(found);
+#endif /* CONFIG_MQTT_HELPER_DNS_CACHE */
+
 	return err;
 }
 
@@ -452,11 +702,27 @@ static int client_connect(struct mqtt_helper_conn_params *conn_params)
 		.size = conn_params->password.size,
 	};
 
+#if defined(CONFIG_MQTT_HELPER_STATS)
+	int64_t dns_start = k_uptime_get();
+
+	stats.connect_count++;
+	stats.dns_time_ms = 0;
+	stats.transport_connect_time_ms = 0;
+	stats.connack_time_ms = 0;
+	stats.tx_bytes = 0;
+	stats.rx_bytes = 0;
+	stats.replayed_count = 0;
+#endif /* CONFIG_MQTT_HELPER_STATS */
+
 	err = broker_init(&broker, conn_params);
 	if (err) {
 		return err;
 	}
 
+#if defined(CONFIG_MQTT_HELPER_STATS)
+	stats.dns_time_ms = k_uptime_get() - dns_start;
+#endif /* CONFIG_MQTT_HELPER_STATS */
+
 	mqtt_client.broker	        = &broker;
 	mqtt_client.evt_cb	        = mqtt_evt_handler;
 	mqtt_client.client_id.utf8      = conn_params->device_id.ptr;
@@ -466,6 +732,7 @@ static int client_connect(struct mqtt_helper_conn_params *conn_params)
 	mqtt_client.rx_buf_size	        = sizeof(rx_buffer);
 	mqtt_client.tx_buf	        = tx_buffer;
 	mqtt_client.tx_buf_size	        = sizeof(tx_buffer);
+	mqtt_client.clean_session       = conn_params->persistent_session ? 0U : 1U;
 
 #if defined(CONFIG_MQTT_HELPER_LAST_WILL)
 	static struct mqtt_topic last_will_topic = {
@@ -515,7 +782,9 @@ static int client_connect(struct mqtt_helper_conn_params *conn_params)
 	tls_cfg->peer_verify = ZSOCK_TLS_PEER_VERIFY_REQUIRED;
 	tls_cfg->cipher_count = 0;
 	tls_cfg->cipher_list = NULL; /* Use default */
-	tls_cfg->session_cache = ZSOCK_TLS_SESSION_CACHE_DISABLED;
+	tls_cfg->session_cache = IS_ENABLED(CONFIG_MQTT_HELPER_TLS_SESSION_CACHE) ?
+				 ZSOCK_TLS_SESSION_CACHE_ENABLED :
+				 ZSOCK_TLS_SESSION_CACHE_DISABLED;
 	tls_cfg->hostname = conn_params->hostname.ptr;
 	tls_cfg->set_native_tls = IS_ENABLED(CONFIG_MQTT_HELPER_NATIVE_TLS);
 
@@ -530,12 +799,26 @@ static int client_connect(struct mqtt_helper_conn_params *conn_params)
 
 	mqtt_state_set(MQTT_STATE_TRANSPORT_CONNECTING);
 
+#if defined(CONFIG_MQTT_HELPER_STATS)
+	transport_connect_start = k_uptime_get();
+#endif /* CONFIG_MQTT_HELPER_STATS */
+
 	err = mqtt_connect(&mqtt_client);
 	if (err) {
 		LOG_ERR("mqtt_connect, error: %d", err);
+
+#if defined(CONFIG_MQTT_HELPER_DNS_CACHE)
+		/* The broker address may have changed, resolve it again on the next attempt. */
+		dns_cache.valid = false;
+#endif /* CONFIG_MQTT_HELPER_DNS_CACHE */
+
 		return err;
 	}
 
+#if defined(CONFIG_MQTT_HELPER_STATS)
+	stats.transport_connect_time_ms = k_uptime_get() - transport_connect_start;
+#endif /* CONFIG_MQTT_HELPER_STATS */
+
 	mqtt_state_set(MQTT_STATE_TRANSPORT_CONNECTED);
 
 	mqtt_state_set(MQTT_STATE_CONNECTING);
@@ -585,6 +868,10 @@ int mqtt_helper_init(struct mqtt_helper_cfg *cfg)
 
 	mqtt_client_init(&mqtt_client);
 
+#if defined(CONFIG_MQTT_HELPER_STATS)
+	memset(&stats, 0, sizeof(stats));
+#endif /* CONFIG_MQTT_HELPER_STATS */
+
 	mqtt_state_set(MQTT_STATE_DISCONNECTED);
 
 	return 0;
@@ -678,6 +965,8 @@ int mqtt_helper_subscribe(struct mqtt_subscription_list *sub_list)
 
 int mqtt_helper_publish(const struct mqtt_publish_param *param)
 {
+	int err;
+
 	LOG_DBG("Publishing to topic: %.*s",
 		param->message.topic.topic.size,
 		(char *)param->message.topic.topic.utf8);
@@ -687,6 +976,12 @@ int mqtt_helper_publish(const struct mqtt_publish_param *param)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_MQTT_HELPER_PUBLISH_QUEUE)
+	if (param->message.topic.qos == MQTT_QOS_1_AT_LEAST_ONCE) {
+		return publish_qos1(param);
+	}
+#endif /* CONFIG_MQTT_HELPER_PUBLISH_QUEUE */
+
 	if (!mqtt_state_verify(MQTT_STATE_CONNECTED)) {
 		LOG_ERR("Library is in the wrong state (%s), %s required",
 			state_name_get(mqtt_state_get()),
@@ -695,8 +990,25 @@ int mqtt_helper_publish(const struct mqtt_publish_param *param)
 		return -EOPNOTSUPP;
 	}
 
-	return mqtt_publish(&mqtt_client, param);
+	err = mqtt_publish(&mqtt_client, param);
+
+#if defined(CONFIG_MQTT_HELPER_STATS)
+	if (!err) {
+		stats.tx_bytes += param->message.topic.topic.size + param->message.payload.len;
+	}
+#endif /* CONFIG_MQTT_HELPER_STATS */
+
+	return err;
+}
+
+#if defined(CONFIG_MQTT_HELPER_STATS)
+void mqtt_helper_stats_get(struct mqtt_helper_stats *stats_out)
+{
+	__ASSERT_NO_MSG(stats_out != NULL);
+
+	*stats_out = stats;
 }
+#endif /* CONFIG_MQTT_HELPER_STATS */
 
 uint16_t mqtt_helper_msg_id_get(void)
 {
@@ -724,6 +1036,12 @@ int mqtt_helper_deinit(void)
 	memset(&current_cfg, 0, sizeof(current_cfg));
 	memset(&mqtt_client, 0, sizeof(mqtt_client));
 
+#if defined(CONFIG_MQTT_HELPER_PUBLISH_QUEUE)
+	k_mutex_lock(&publish_queue_lock, K_FOREVER);
+	publish_queue_count = 0;
+	k_mutex_unlock(&publish_queue_lock);
+#endif /* CONFIG_MQTT_HELPER_PUBLISH_QUEUE */
+
 	mqtt_state_set(MQTT_STATE_UNINIT);
 
 	return 0;
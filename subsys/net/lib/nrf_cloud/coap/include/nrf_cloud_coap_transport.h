@@ -35,6 +35,7 @@ struct nrf_cloud_coap_client {
 };
 
 #define NRF_CLOUD_COAP_PROXY_RSC "proxy"
+#define NRF_CLOUD_COAP_D2C_BULK_RSC "msg/d2c/bulk"
 
 /**
  * @defgroup nrf_cloud_coap_transport nRF CoAP API
@@ -260,6 +261,40 @@ int nrf_cloud_coap_patch(const char *resource, const char *query,
  */
 int nrf_cloud_coap_bin_log_send(const uint8_t * const buf, size_t buf_len, bool confirmable);
 
+/**@brief Initialize the path and the options of a CoAP client request.
+ *
+ * The resource and the query are combined into the request path. An Accept option is added
+ * if a response is expected, followed by the user options, if enabled.
+ *
+ * @param request CoAP client request to initialize.
+ * @param resource Resource path.
+ * @param query Query string; can be NULL.
+ * @param fmt_in Content format of the expected response.
+ * @param response_expected Add an Accept option with fmt_in.
+ * @param user User data passed to nrf_cloud_coap_get_user_options().
+ *
+ * @retval 0 If successful.
+ * @retval -ETXTBSY The path does not fit in the request.
+ */
+int nrf_cloud_coap_transport_request_init(struct coap_client_request *request,
+					  const char *resource, const char *query,
+					  enum coap_content_format fmt_in,
+					  bool response_expected, void *user);
+
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+/**@brief Queue an asynchronous request on the provided nrf_cloud_coap_client.
+ *
+ * @param client Client used to send the request.
+ * @param req Request.
+ *
+ * @retval 0 If the request was queued.
+ * @retval -ENOBUFS No free request slot.
+ * @retval -ETXTBSY The path does not fit in the request.
+ */
+int nrf_cloud_coap_transport_async_submit(struct nrf_cloud_coap_client *const client,
+					  const struct nrf_cloud_coap_async_req *req);
+#endif
+
 /**@brief User implements this API to add additional CoAP Options to nRF Cloud CoAP Requests
  *
  * Note: The API is only called if CONFIG_NRF_CLOUD_COAP_MAX_USER_OPTIONS has been set to a value
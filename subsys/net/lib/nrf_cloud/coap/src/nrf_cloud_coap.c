@@ -37,7 +37,7 @@ LOG_MODULE_REGISTER(nrf_cloud_coap, CONFIG_NRF_CLOUD_COAP_LOG_LEVEL);
 #define COAP_SHDW_REP_RSC "state/reported"
 #define COAP_SHDW_DES_RSC "state/desired"
 #define COAP_D2C_RSC "msg/d2c"
-#define COAP_D2C_BULK_RSC COAP_D2C_RSC "/bulk"
+#define COAP_D2C_BULK_RSC NRF_CLOUD_COAP_D2C_BULK_RSC
 #define COAP_D2C_RAW_RSC COAP_D2C_RSC "/raw"
 #define COAP_D2C_BIN_RSC COAP_D2C_RSC "/bin"
 
@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/slist.h>
+#include <zephyr/net/coap.h>
+#include <zephyr/net/coap_client.h>
+#include <net/nrf_cloud_coap.h>
+#include "nrf_cloud_coap_transport.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(nrf_cloud_coap_async, CONFIG_NRF_CLOUD_COAP_LOG_LEVEL);
+
+#define NSTART CONFIG_NRF_CLOUD_COAP_ASYNC_NSTART
+#define NON_TIMEOUT K_MSEC(CONFIG_NRF_CLOUD_COAP_ASYNC_NON_TIMEOUT_MS)
+#define RETRY_DELAY K_MSEC(CONFIG_NRF_CLOUD_COAP_ASYNC_RETRY_DELAY_MS)
+
+/* Leave at least one CoAP client request slot for the blocking API. */
+BUILD_ASSERT(NSTART < CONFIG_COAP_CLIENT_MAX_REQUESTS,
+	     "CONFIG_NRF_CLOUD_COAP_ASYNC_NSTART must be smaller than "
+	     "CONFIG_COAP_CLIENT_MAX_REQUESTS");
+
+enum xfer_state {
+	XFER_FREE,
+	XFER_QUEUED,
+	XFER_IN_FLIGHT,
+	XFER_DONE,
+};
+
+struct async_xfer {
+	sys_snode_t node;
+	struct nrf_cloud_coap_client *client;
+	struct coap_client_request request;
+	coap_client_response_cb_t response_cb;
+	nrf_cloud_coap_async_cb_t done_cb;
+	void *user;
+	/* Timeout of a NON request. */
+	struct k_work_delayable timeout_work;
+	atomic_t state;
+};
+
+static struct async_xfer xfers[CONFIG_NRF_CLOUD_COAP_ASYNC_QUEUE_SIZE];
+
+/* Requests waiting to be sent, in order. */
+static sys_slist_t pending = SYS_SLIST_STATIC_INIT(&pending);
+/* Number of requests sent to the server and not yet completed. */
+static size_t in_flight;
+/* Protects the pending list and the in_flight counter. */
+static struct k_spinlock lock;
+
+static void submit_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(submit_work, submit_work_fn);
+
+static struct async_xfer *xfer_take(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(xfers); i++) {
+		if (atomic_cas(&xfers[i].state, XFER_FREE, XFER_QUEUED)) {
+			return &xfers[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void xfer_complete(struct async_xfer *xfer, int result)
+{
+	k_spinlock_key_t key;
+
+	(void)k_work_cancel_delayable(&xfer->timeout_work);
+
+	LOG_DBG("Request %s completed: %d", xfer->request.path, result);
+
+	if (xfer->done_cb) {
+		xfer->done_cb(result, xfer->user);
+	}
+
+	key = k_spin_lock(&lock);
+	in_flight--;
+	k_spin_unlock(&lock, key);
+
+	atomic_set(&xfer->state, XFER_FREE);
+
+	/* Send the next queued request. */
+	k_work_reschedule(&submit_work, K_NO_WAIT);
+}
+
+/* Complete the request unless it was already completed from another context. */
+static void xfer_finish(struct async_xfer *xfer, int result)
+{
+	if (atomic_cas(&xfer->state, XFER_IN_FLIGHT, XFER_DONE)) {
+		xfer_complete(xfer, result);
+	}
+}
+
+static void client_callback(const struct coap_client_response_data *data, void *user_data)
+{
+	__ASSERT_NO_MSG(user_data != NULL);
+
+	struct async_xfer *xfer = (struct async_xfer *)user_data;
+
+	/* Ignore responses to requests that timed out or were cancelled. */
+	if (atomic_get(&xfer->state) != XFER_IN_FLIGHT) {
+		return;
+	}
+
+	if (data->result_code == COAP_RESPONSE_CODE_UNAUTHORIZED) {
+		LOG_ERR("Device not authenticated; reconnection required.");
+		xfer->client->authenticated = false;
+	}
+
+	if (xfer->response_cb) {
+		xfer->response_cb(data, xfer->user);
+	}
+
+	if ((data->result_code < 0) || (data->result_code >= COAP_RESPONSE_CODE_BAD_REQUEST)) {
+		xfer_finish(xfer, data->result_code);
+	} else if (data->last_block) {
+		xfer_finish(xfer, 0);
+	}
+}
+
+static void timeout_work_fn(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct async_xfer *xfer = CONTAINER_OF(dwork, struct async_xfer, timeout_work);
+
+	if (!atomic_cas(&xfer->state, XFER_IN_FLIGHT, XFER_DONE)) {
+		return;
+	}
+
+	/* The server might never respond to a NON request, which is not an error. */
+	LOG_DBG("No response to NON request %s", xfer->request.path);
+	coap_client_cancel_request(&xfer->client->cc, &xfer->request);
+	xfer_complete(xfer, 0);
+}
+
+static void submit_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	while (true) {
+		struct async_xfer *xfer;
+		k_spinlock_key_t key;
+		int err;
+
+		key = k_spin_lock(&lock);
+		if ((in_flight >= NSTART) || sys_slist_is_empty(&pending)) {
+			k_spin_unlock(&lock, key);
+			break;
+		}
+		xfer = CONTAINER_OF(sys_slist_get_not_empty(&pending), struct async_xfer, node);
+		in_flight++;
+		k_spin_unlock(&lock, key);
+
+		atomic_set(&xfer->state, XFER_IN_FLIGHT);
+
+		if (xfer->client->sock < 0) {
+			xfer_finish(xfer, -ENOTCONN);
+			continue;
+		}
+
+		/* Armed before sending, because the response can arrive before
+		 * coap_client_req() returns.
+		 */
+		if (!xfer->request.confirmable) {
+			k_work_reschedule(&xfer->timeout_work, NON_TIMEOUT);
+		}
+
+		err = coap_client_req(&xfer->client->cc, xfer->client->sock, NULL,
+				      &xfer->request, NULL);
+		if (err == -EAGAIN) {
+			/* All CoAP client request slots are in use, most likely by
+			 * the blocking API. Put the request back and retry later.
+			 */
+			LOG_DBG("CoAP client busy");
+			(void)k_work_cancel_delayable(&xfer->timeout_work);
+			atomic_set(&xfer->state, XFER_QUEUED);
+
+			key = k_spin_lock(&lock);
+			sys_slist_prepend(&pending, &xfer->node);
+			in_flight--;
+			k_spin_unlock(&lock, key);
+
+			k_work_reschedule(&submit_work, RETRY_DELAY);
+			break;
+		} else if (err < 0) {
+			LOG_ERR("Error sending CoAP request: %d", err);
+			xfer_finish(xfer, err);
+		} else {
+			LOG_DBG("%s %s sent, %zd bytes",
+				xfer->request.confirmable ? "CON" : "NON",
+				xfer->request.path, xfer->request.len);
+		}
+	}
+}
+
+int nrf_cloud_coap_transport_async_submit(struct nrf_cloud_coap_client *const client,
+					  const struct nrf_cloud_coap_async_req *req)
+{
+	__ASSERT_NO_MSG(client != NULL);
+
+	struct async_xfer *xfer;
+	k_spinlock_key_t key;
+	int err;
+
+	if (!req || !req->resource) {
+		return -EINVAL;
+	}
+
+	xfer = xfer_take();
+	if (!xfer) {
+		LOG_WRN("Asynchronous request queue full");
+		return -ENOBUFS;
+	}
+
+	xfer->request = (struct coap_client_request) {
+		.method = req->method,
+		.confirmable = req->reliable,
+		.fmt = req->fmt_out,
+		.payload = (uint8_t *)req->buf,
+		.len = req->len,
+		.cb = client_callback,
+		.user_data = xfer
+	};
+
+	err = nrf_cloud_coap_transport_request_init(&xfer->request, req->resource, req->query,
+						    req->fmt_in, req->response_expected,
+						    req->user);
+	if (err) {
+		atomic_set(&xfer->state, XFER_FREE);
+		return err;
+	}
+
+	xfer->client = client;
+	xfer->response_cb = req->response_cb;
+	xfer->done_cb = req->done_cb;
+	xfer->user = req->user;
+
+	key = k_spin_lock(&lock);
+	sys_slist_append(&pending, &xfer->node);
+	k_spin_unlock(&lock, key);
+
+	k_work_reschedule(&submit_work, K_NO_WAIT);
+
+	return 0;
+}
+
+int nrf_cloud_coap_batch_init(struct nrf_cloud_coap_batch *batch, char *buf, size_t size)
+{
+	/* Room for an empty JSON array. */
+	if (!batch || !buf || (size < 2)) {
+		return -EINVAL;
+	}
+
+	batch->buf = buf;
+	batch->size = size;
+	batch->buf[0] = '[';
+	batch->len = 1;
+	batch->count = 0;
+	batch->busy = false;
+
+	return 0;
+}
+
+int nrf_cloud_coap_batch_json_add(struct nrf_cloud_coap_batch *batch, const char *message)
+{
+	if (!batch || !batch->buf || !message) {
+		return -EINVAL;
+	}
+
+	if (batch->busy) {
+		return -EBUSY;
+	}
+
+	const size_t msg_len = strlen(message);
+	const size_t sep_len = batch->count ? 1 : 0;
+
+	/* Keep room for the closing bracket. */
+	if ((batch->len + sep_len + msg_len + 1) > batch->size) {
+		return -ENOMEM;
+	}
+
+	if (sep_len) {
+		batch->buf[batch->len++] = ',';
+	}
+	memcpy(&batch->buf[batch->len], message, msg_len);
+	batch->len += msg_len;
+	batch->count++;
+
+	return 0;
+}
+
+int nrf_cloud_coap_batch_send(struct nrf_cloud_coap_batch *batch, bool confirmable,
+			      nrf_cloud_coap_async_cb_t cb, void *user)
+{
+	int err;
+
+	if (!batch || !batch->buf) {
+		return -EINVAL;
+	}
+
+	if (batch->busy) {
+		return -EBUSY;
+	}
+
+	if (!batch->count) {
+		return -ENODATA;
+	}
+
+	const struct nrf_cloud_coap_async_req req = {
+		.method = COAP_METHOD_POST,
+		.resource = NRF_CLOUD_COAP_D2C_BULK_RSC,
+		.buf = (const uint8_t *)batch->buf,
+		.len = batch->len + 1,
+		.fmt_out = COAP_CONTENT_FORMAT_APP_JSON,
+		.reliable = confirmable,
+		.done_cb = cb,
+		.user = user
+	};
+
+	batch->buf[batch->len] = ']';
+	batch->busy = true;
+
+	LOG_DBG("Sending batch of %zu messages, %zu bytes", batch->count, req.len);
+
+	err = nrf_cloud_coap_async_request(&req);
+	if (err) {
+		batch->busy = false;
+	}
+
+	return err;
+}
+
+static int nrf_cloud_coap_async_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(xfers); i++) {
+		k_work_init_delayable(&xfers[i].timeout_work, timeout_work_fn);
+	}
+
+	return 0;
+}
+
+SYS_INIT(nrf_cloud_coap_async_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
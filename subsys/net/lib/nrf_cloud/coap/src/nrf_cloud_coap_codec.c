@@ -16,6 +16,7 @@
 #include <cJSON.h>
 #include "nrf_cloud_codec_internal.h"
 #include "nrf_cloud_mem.h"
+#include "nrf_cloud_msg_stream.h"
 #include "ground_fix_encode_types.h"
 #include "ground_fix_encode.h"
 #include "ground_fix_decode_types.h"
@@ -38,6 +39,75 @@ LOG_MODULE_REGISTER(coap_codec, CONFIG_NRF_CLOUD_COAP_LOG_LEVEL);
  */
 #define DEFAULT_MASK_ANGLE 5
 
+static void json_pvt_add(struct nrf_cloud_msg_stream *const s,
+			 const struct nrf_cloud_gnss_pvt *const pvt)
+{
+	(void)nrf_cloud_msg_stream_obj_start(s, NRF_CLOUD_JSON_DATA_KEY);
+	(void)nrf_cloud_msg_stream_num_add(s, NRF_CLOUD_JSON_GNSS_PVT_KEY_LAT, pvt->lat);
+	(void)nrf_cloud_msg_stream_num_add(s, NRF_CLOUD_JSON_GNSS_PVT_KEY_LON, pvt->lon);
+	(void)nrf_cloud_msg_stream_num_add(s, NRF_CLOUD_JSON_GNSS_PVT_KEY_ACCURACY,
+					   pvt->accuracy);
+	if (pvt->has_speed) {
+		(void)nrf_cloud_msg_stream_num_add(s, NRF_CLOUD_JSON_GNSS_PVT_KEY_SPEED,
+						   pvt->speed);
+	}
+	if (pvt->has_heading) {
+		(void)nrf_cloud_msg_stream_num_add(s, NRF_CLOUD_JSON_GNSS_PVT_KEY_HEADING,
+						   pvt->heading);
+	}
+	if (pvt->has_alt) {
+		(void)nrf_cloud_msg_stream_num_add(s, NRF_CLOUD_JSON_GNSS_PVT_KEY_ALTITUDE,
+						   pvt->alt);
+	}
+	(void)nrf_cloud_msg_stream_obj_end(s);
+}
+
+/* Encode the message directly into the buffer, without building a cJSON tree. */
+static int json_message_encode(const struct nrf_cloud_obj_coap_cbor *const msg, uint8_t *buf,
+			       size_t *len)
+{
+	struct nrf_cloud_msg_stream s;
+	int err;
+
+	nrf_cloud_msg_stream_init(&s, NRF_CLOUD_MSG_STREAM_JSON, buf, *len);
+
+	(void)nrf_cloud_msg_stream_obj_start(&s, NULL);
+	(void)nrf_cloud_msg_stream_msg_start(&s, NRF_CLOUD_REST_MSG_KEY, msg->app_id,
+					     NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	(void)nrf_cloud_msg_stream_int_add(&s, NRF_CLOUD_MSG_TIMESTAMP_KEY, msg->ts);
+
+	switch (msg->type) {
+	case NRF_CLOUD_DATA_TYPE_STR:
+		(void)nrf_cloud_msg_stream_str_add(&s, NRF_CLOUD_JSON_DATA_KEY, msg->str_val);
+		break;
+	case NRF_CLOUD_DATA_TYPE_PVT:
+		json_pvt_add(&s, msg->pvt);
+		break;
+	case NRF_CLOUD_DATA_TYPE_INT:
+		(void)nrf_cloud_msg_stream_int_add(&s, NRF_CLOUD_JSON_DATA_KEY, msg->int_val);
+		break;
+	case NRF_CLOUD_DATA_TYPE_DOUBLE:
+		(void)nrf_cloud_msg_stream_num_add(&s, NRF_CLOUD_JSON_DATA_KEY, msg->double_val);
+		break;
+	default:
+		LOG_ERR("Cannot encode unknown type.");
+		*len = 0;
+		return -EINVAL;
+	}
+
+	(void)nrf_cloud_msg_stream_obj_end(&s);
+	(void)nrf_cloud_msg_stream_obj_end(&s);
+
+	err = nrf_cloud_msg_stream_finish(&s, len);
+	if (err) {
+		LOG_ERR("Error %d encoding message", err);
+		*len = 0;
+		return (err == -ENOMEM) ? -E2BIG : err;
+	}
+
+	return 0;
+}
+
 static int encode_message(struct nrf_cloud_obj_coap_cbor *msg, uint8_t *buf, size_t *len,
 			  enum coap_content_format fmt)
 {
@@ -98,22 +168,7 @@ static int encode_message(struct nrf_cloud_obj_coap_cbor *msg, uint8_t *buf, siz
 			*len = out_len;
 		}
 	} else if (fmt == COAP_CONTENT_FORMAT_APP_JSON) {
-		struct nrf_cloud_data out;
-
-		err = nrf_cloud_encode_message(msg->app_id, msg->double_val, msg->str_val, NULL,
-					       msg->ts, &out);
-		if (err) {
-			*len = 0;
-		} else if (*len <= out.len) {
-			*len = 0;
-			cJSON_free((void *)out.ptr);
-			err = -E2BIG;
-		} else {
-			*len = out.len;
-			memcpy(buf, out.ptr, *len);
-			buf[*len - 1] = '\0';
-			cJSON_free((void *)out.ptr);
-		}
+		err = json_message_encode(msg, buf, len);
 	} else {
 		err = -EINVAL;
 	}
@@ -501,6 +501,49 @@ static void client_callback(const struct coap_client_response_data *data, void *
 
 BUILD_ASSERT((NRF_CLOUD_COAP_NUM_INTERNAL_OPTIONS + CONFIG_NRF_CLOUD_COAP_MAX_USER_OPTIONS) <=
 		CONFIG_COAP_CLIENT_MAX_EXTRA_OPTIONS);
+
+int nrf_cloud_coap_transport_request_init(struct coap_client_request *request,
+					  const char *resource, const char *query,
+					  enum coap_content_format fmt_in,
+					  bool response_expected, void *user)
+{
+	__ASSERT_NO_MSG(request != NULL);
+	__ASSERT_NO_MSG(resource != NULL);
+
+	int err;
+	size_t num_internal_options = 0;
+
+	if (response_expected) {
+		num_internal_options += 1;
+		request->options[0] = (struct coap_client_option) {
+			.code = COAP_OPTION_ACCEPT,
+			.len = 1,
+			.value[0] = fmt_in
+		};
+	}
+
+	size_t num_user_options = CONFIG_NRF_CLOUD_COAP_MAX_USER_OPTIONS;
+#if (CONFIG_NRF_CLOUD_COAP_MAX_USER_OPTIONS > 0)
+	nrf_cloud_coap_get_user_options(&request->options[num_internal_options],
+					&num_user_options, resource, user);
+#endif
+	request->num_options = num_internal_options + num_user_options;
+
+	if (!query) {
+		strncpy(request->path, resource, MAX_PATH_SIZE);
+		request->path[MAX_PATH_SIZE - 1] = '\0';
+	} else {
+		err = snprintk(request->path, sizeof(request->path), "%s?%s", resource, query);
+		if ((err <= 0) || (err >= sizeof(request->path))) {
+			/* If we get here, CONFIG_COAP_CLIENT_MAX_PATH_LENGTH needs a bump */
+			LOG_ERR("Could not format string: %s?%s", resource, query);
+			return -ETXTBSY;
+		}
+	}
+
+	return 0;
+}
+
 static int client_transfer(enum coap_method method,
 			   const char *resource, const char *query,
 			   const uint8_t *buf, size_t buf_len,
@@ -528,36 +571,10 @@ static int client_transfer(enum coap_method method,
 	};
 	struct coap_client *const cc = &xfer->nrfc_cc->cc;
 
-	size_t num_internal_options = 0;
-	if (response_expected) {
-		num_internal_options += 1;
-		request.options[0] = (struct coap_client_option) {
-			.code = COAP_OPTION_ACCEPT,
-			.len = 1,
-			.value[0] = fmt_in
-		};
-	}
-
-	size_t num_user_options = CONFIG_NRF_CLOUD_COAP_MAX_USER_OPTIONS;
-#if (CONFIG_NRF_CLOUD_COAP_MAX_USER_OPTIONS > 0)
-	nrf_cloud_coap_get_user_options(&request.options[num_internal_options], &num_user_options,
-		resource, xfer->user_data);
-#endif
-	const size_t total_options = num_internal_options + num_user_options;
-
-	request.num_options = total_options;
-
-	if (!query) {
-		strncpy(request.path, resource, MAX_PATH_SIZE);
-		request.path[MAX_PATH_SIZE - 1] = '\0';
-	} else {
-		err = snprintk(request.path, sizeof(request.path), "%s?%s", resource, query);
-		if ((err <= 0) || (err >= sizeof(request.path))) {
-			/* If we get here, CONFIG_COAP_CLIENT_MAX_PATH_LENGTH needs a bump */
-			LOG_ERR("Could not format string: %s?%s", resource, query);
-			err = -ETXTBSY;
-			goto transfer_end;
-		}
+	err = nrf_cloud_coap_transport_request_init(&request, resource, query, fmt_in,
+						    response_expected, xfer->user_data);
+	if (err) {
+		goto transfer_end;
 	}
 
 #if defined(CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG)
@@ -732,6 +749,17 @@ int nrf_cloud_coap_patch(const char *resource, const char *query,
 	return err;
 }
 
+#if defined(CONFIG_NRF_CLOUD_COAP_ASYNC)
+int nrf_cloud_coap_async_request(const struct nrf_cloud_coap_async_req *req)
+{
+	if (!nrf_cloud_coap_is_connected()) {
+		return -EACCES;
+	}
+
+	return nrf_cloud_coap_transport_async_submit(&internal_cc, req);
+}
+#endif /* CONFIG_NRF_CLOUD_COAP_ASYNC */
+
 static void auth_cb(const struct coap_client_response_data *data, void *user_data)
 {
 	struct nrf_cloud_coap_client *client = (struct nrf_cloud_coap_client *)user_data;
@@ -12,3 +12,15 @@
  * @param in_progress whether an A-GNSS request is in progress.
  */
 void nrf_cloud_agnss_set_request_in_progress(bool in_progress);
+
+/**
+ * @brief Store A-GNSS data that was injected to GNSS.
+ *
+ * @note Only GPS ephemerides, almanacs, UTC parameters and ionospheric corrections are
+ * stored, other data is ignored.
+ *
+ * @param type A-GNSS data type, NRF_MODEM_GNSS_AGNSS_*.
+ * @param data A-GNSS data in the format used by nrf_modem_gnss_agnss_write().
+ * @param data_len Length of the data.
+ */
+void nrf_cloud_agnss_store_add(uint16_t type, const void *data, size_t data_len);
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_CLOUD_MSG_STREAM_H__
+#define NRF_CLOUD_MSG_STREAM_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum nesting depth of objects and arrays in a message stream. */
+#define NRF_CLOUD_MSG_STREAM_MAX_DEPTH 6
+
+/** @brief Output format of a message stream. */
+enum nrf_cloud_msg_stream_fmt {
+	NRF_CLOUD_MSG_STREAM_JSON,
+	NRF_CLOUD_MSG_STREAM_CBOR,
+};
+
+/** @brief Streaming encoder for nRF Cloud messages.
+ *
+ *  The encoder writes the message directly into the output buffer as the
+ *  items are added, without building an object tree or allocating memory.
+ *  Errors are sticky: after the first error nothing more is written to the
+ *  buffer, so the return value only needs to be checked when the message is
+ *  finished.
+ *
+ *  If no output buffer is given, only the length of the encoded message is
+ *  computed. This can be used to allocate a buffer of the exact size.
+ */
+struct nrf_cloud_msg_stream {
+	/** Output buffer, NULL to only compute the length */
+	uint8_t *buf;
+	/** Size of the output buffer */
+	size_t size;
+	/** Length of the encoded data, including data that did not fit */
+	size_t len;
+	/** First error that occurred */
+	int err;
+	/** Output format */
+	enum nrf_cloud_msg_stream_fmt fmt;
+	/** Number of open objects and arrays */
+	uint8_t depth;
+	/** State of the open objects and arrays */
+	struct {
+		/** Offset of the CBOR container header */
+		size_t hdr;
+		/** Number of items added to the container */
+		uint32_t count;
+		/** The container is an object */
+		bool obj;
+	} level[NRF_CLOUD_MSG_STREAM_MAX_DEPTH];
+};
+
+/** @brief Initialize a message stream.
+ *
+ * @param[out] stream Message stream.
+ * @param[in] fmt Output format.
+ * @param[in] buf Output buffer, or NULL to only compute the length.
+ * @param[in] size Size of the output buffer.
+ */
+void nrf_cloud_msg_stream_init(struct nrf_cloud_msg_stream *const stream,
+			       enum nrf_cloud_msg_stream_fmt fmt, void *buf, size_t size);
+
+/** @brief Start an object.
+ *
+ * @param[in,out] stream Message stream.
+ * @param[in] key Key of the object in the enclosing object, or NULL if the
+ *		  object is the root or an array element.
+ *
+ * @retval 0 or the first error of the stream.
+ */
+int nrf_cloud_msg_stream_obj_start(struct nrf_cloud_msg_stream *const stream,
+				   const char *const key);
+
+/** @brief End the innermost object. */
+int nrf_cloud_msg_stream_obj_end(struct nrf_cloud_msg_stream *const stream);
+
+/** @brief Start an array. The key follows the rules of @ref nrf_cloud_msg_stream_obj_start. */
+int nrf_cloud_msg_stream_arr_start(struct nrf_cloud_msg_stream *const stream,
+				   const char *const key);
+
+/** @brief End the innermost array. */
+int nrf_cloud_msg_stream_arr_end(struct nrf_cloud_msg_stream *const stream);
+
+/** @brief Add a string. The key follows the rules of @ref nrf_cloud_msg_stream_obj_start. */
+int nrf_cloud_msg_stream_str_add(struct nrf_cloud_msg_stream *const stream,
+				 const char *const key, const char *const val);
+
+/** @brief Add a floating point number.
+ *
+ *  The JSON output matches the number formatting of cJSON.
+ *  NaN and infinity are encoded as null in JSON.
+ */
+int nrf_cloud_msg_stream_num_add(struct nrf_cloud_msg_stream *const stream,
+				 const char *const key, const double val);
+
+/** @brief Add an integer. */
+int nrf_cloud_msg_stream_int_add(struct nrf_cloud_msg_stream *const stream,
+				 const char *const key, const int64_t val);
+
+/** @brief Add a boolean. */
+int nrf_cloud_msg_stream_bool_add(struct nrf_cloud_msg_stream *const stream,
+				  const char *const key, const bool val);
+
+/** @brief Start an nRF Cloud device message object.
+ *
+ *  Starts an object and adds the application ID and, if provided, the message type.
+ *  The caller adds the timestamp and the data, and ends the object.
+ *
+ * @param[in,out] stream Message stream.
+ * @param[in] key Key of the message in the enclosing object, or NULL.
+ * @param[in] app_id Application ID.
+ * @param[in] msg_type Message type, or NULL.
+ *
+ * @retval 0 or the first error of the stream.
+ */
+int nrf_cloud_msg_stream_msg_start(struct nrf_cloud_msg_stream *const stream,
+				   const char *const key, const char *const app_id,
+				   const char *const msg_type);
+
+/** @brief Finish a message stream.
+ *
+ *  JSON output is NULL-terminated if there is room in the buffer.
+ *  The terminator is not included in the length.
+ *
+ * @param[in] stream Message stream.
+ * @param[out] len Length of the encoded message. If the buffer was too small,
+ *		   this is the size that is needed. Can be NULL.
+ *
+ * @retval 0 Success.
+ * @retval -ENOMEM The output buffer is too small.
+ * @retval -EINVAL An item was added in an invalid position, objects or arrays
+ *		   were not ended, or they are nested too deeply.
+ * @retval -E2BIG A CBOR object or array has more than 255 items.
+ */
+int nrf_cloud_msg_stream_finish(const struct nrf_cloud_msg_stream *const stream,
+				size_t *const len);
+
+/** @brief Find a string in the root object of a JSON message without parsing it.
+ *
+ *  Nested objects and arrays are skipped. Escape sequences in the string are
+ *  not decoded.
+ *
+ * @param[in] json JSON message.
+ * @param[in] json_len Length of the JSON message.
+ * @param[in] key Key to look for.
+ * @param[out] val Start of the string value in the JSON message.
+ * @param[out] val_len Length of the string value.
+ *
+ * @retval 0 Success.
+ * @retval -ENOENT The key was not found.
+ * @retval -ENOMSG The value is not a string.
+ * @retval -EBADMSG The message is not a valid JSON object.
+ */
+int nrf_cloud_msg_stream_json_str_get(const char *const json, size_t json_len,
+				      const char *const key, const char **val, size_t *val_len);
+
+/** @brief Find a number in the root object of a JSON message without parsing it.
+ *
+ *  Return values are the same as for @ref nrf_cloud_msg_stream_json_str_get.
+ */
+int nrf_cloud_msg_stream_json_num_get(const char *const json, size_t json_len,
+				      const char *const key, double *val);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_CLOUD_MSG_STREAM_H__ */
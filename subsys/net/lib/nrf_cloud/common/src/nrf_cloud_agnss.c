@@ -24,6 +24,7 @@ LOG_MODULE_REGISTER(nrf_cloud_agnss, CONFIG_NRF_CLOUD_GPS_LOG_LEVEL);
 #include "nrf_cloud_codec_internal.h"
 #include "nrf_cloud_transport.h"
 #include "nrf_cloud_agnss_schema_v1.h"
+#include "nrf_cloud_agnss_internal.h"
 
 extern void agnss_print(enum nrf_cloud_agnss_type type, void *data);
 
@@ -69,11 +70,20 @@ void nrf_cloud_agnss_set_request_in_progress(bool in_progress)
 
 static int send_to_modem(void *data, size_t data_len, uint16_t type)
 {
+	int err;
+
 	if (agnss_print_enabled) {
 		agnss_print(type, data);
 	}
 
-	return nrf_modem_gnss_agnss_write(data, data_len, type);
+	err = nrf_modem_gnss_agnss_write(data, data_len, type);
+#if defined(CONFIG_NRF_CLOUD_AGNSS_STORE)
+	if (!err) {
+		nrf_cloud_agnss_store_add(type, data, data_len);
+	}
+#endif
+
+	return err;
 }
 
 static void copy_gps_utc(struct nrf_modem_gnss_agnss_gps_data_utc *dst,
@@ -0,0 +1,429 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <nrf_modem_gnss.h>
+#include <date_time.h>
+#include <net/nrf_cloud_agnss.h>
+#if defined(CONFIG_NRF_CLOUD_AGNSS_STORE_PERSISTENT)
+#include <zephyr/settings/settings.h>
+#endif
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(nrf_cloud_agnss_store, CONFIG_NRF_CLOUD_GPS_LOG_LEVEL);
+
+#include "nrf_cloud_agnss_internal.h"
+#include "nrf_cloud_pgps_utils.h"
+
+#define GPS_SV_COUNT 32
+
+/* Record indices: GPS ephemerides and almanacs by satellite, followed by the other data. */
+#define EPHE_FIRST	0
+#define ALM_FIRST	(EPHE_FIRST + GPS_SV_COUNT)
+#define UTC_INDEX	(ALM_FIRST + GPS_SV_COUNT)
+#define KLOBUCHAR_INDEX	(UTC_INDEX + 1)
+#define NEQUICK_INDEX	(UTC_INDEX + 2)
+#define RECORD_COUNT	(UTC_INDEX + 3)
+
+#define EPHE_VALIDITY_S ((int64_t)CONFIG_NRF_CLOUD_AGNSS_STORE_EPHEMERIS_VALIDITY * SEC_PER_MIN)
+#define ALM_VALIDITY_S	((int64_t)CONFIG_NRF_CLOUD_AGNSS_STORE_ALMANAC_VALIDITY * SEC_PER_DAY)
+
+/* Scale factors of the ephemeris toe and almanac toa, and the range of the almanac week. */
+#define EPHE_TOE_SCALE	16
+#define ALM_TOA_SCALE	4096
+#define ALM_WN_MODULO	256
+#define GPS_WEEK_S	((int64_t)SECONDS_PER_WEEK)
+
+#define STORE_SETTINGS_NAME "agnss_store"
+/* Saving is delayed until the whole assistance data set has been injected. */
+#define STORE_SAVE_DELAY K_SECONDS(5)
+
+union store_data {
+	struct nrf_modem_gnss_agnss_gps_data_ephemeris ephemeris;
+	struct nrf_modem_gnss_agnss_gps_data_almanac almanac;
+	struct nrf_modem_gnss_agnss_gps_data_utc utc;
+	struct nrf_modem_gnss_agnss_data_klobuchar klobuchar;
+	struct nrf_modem_gnss_agnss_data_nequick nequick;
+};
+
+struct store_record {
+	/* UNIX time in milliseconds when the data was received, zero if there is no data. */
+	int64_t timestamp;
+	union store_data data;
+};
+
+static struct store_record records[RECORD_COUNT];
+static K_MUTEX_DEFINE(store_lock);
+
+#if defined(CONFIG_NRF_CLOUD_AGNSS_STORE_PERSISTENT)
+static ATOMIC_DEFINE(dirty, RECORD_COUNT);
+
+static void store_save_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(store_save_work, store_save_work_fn);
+
+static int store_settings_set(const char *key, size_t len_rd, settings_read_cb read_cb,
+			      void *cb_arg);
+
+SETTINGS_STATIC_HANDLER_DEFINE(agnss_store, STORE_SETTINGS_NAME, NULL, store_settings_set,
+			       NULL, NULL);
+#endif
+
+static uint16_t record_type(int index)
+{
+	if (index < ALM_FIRST) {
+		return NRF_MODEM_GNSS_AGNSS_GPS_EPHEMERIDES;
+	} else if (index < UTC_INDEX) {
+		return NRF_MODEM_GNSS_AGNSS_GPS_ALMANAC;
+	} else if (index == UTC_INDEX) {
+		return NRF_MODEM_GNSS_AGNSS_GPS_UTC_PARAMETERS;
+	} else if (index == KLOBUCHAR_INDEX) {
+		return NRF_MODEM_GNSS_AGNSS_KLOBUCHAR_IONOSPHERIC_CORRECTION;
+	}
+
+	return NRF_MODEM_GNSS_AGNSS_NEQUICK_IONOSPHERIC_CORRECTION;
+}
+
+static size_t record_data_size(int index)
+{
+	switch (record_type(index)) {
+	case NRF_MODEM_GNSS_AGNSS_GPS_EPHEMERIDES:
+		return sizeof(struct nrf_modem_gnss_agnss_gps_data_ephemeris);
+	case NRF_MODEM_GNSS_AGNSS_GPS_ALMANAC:
+		return sizeof(struct nrf_modem_gnss_agnss_gps_data_almanac);
+	case NRF_MODEM_GNSS_AGNSS_GPS_UTC_PARAMETERS:
+		return sizeof(struct nrf_modem_gnss_agnss_gps_data_utc);
+	case NRF_MODEM_GNSS_AGNSS_KLOBUCHAR_IONOSPHERIC_CORRECTION:
+		return sizeof(struct nrf_modem_gnss_agnss_data_klobuchar);
+	default:
+		return sizeof(struct nrf_modem_gnss_agnss_data_nequick);
+	}
+}
+
+/* Returns the record index for the data, or -1 if the data is not stored. */
+static int record_index(uint16_t type, const void *data)
+{
+	uint8_t sv_id;
+
+	switch (type) {
+	case NRF_MODEM_GNSS_AGNSS_GPS_EPHEMERIDES:
+		/* QZSS ephemerides use the same type, but are only valid for a short time. */
+		sv_id = ((const struct nrf_modem_gnss_agnss_gps_data_ephemeris *)data)->sv_id;
+		return (sv_id >= 1 && sv_id <= GPS_SV_COUNT) ? EPHE_FIRST + sv_id - 1 : -1;
+	case NRF_MODEM_GNSS_AGNSS_GPS_ALMANAC:
+		sv_id = ((const struct nrf_modem_gnss_agnss_gps_data_almanac *)data)->sv_id;
+		return (sv_id >= 1 && sv_id <= GPS_SV_COUNT) ? ALM_FIRST + sv_id - 1 : -1;
+	case NRF_MODEM_GNSS_AGNSS_GPS_UTC_PARAMETERS:
+		return UTC_INDEX;
+	case NRF_MODEM_GNSS_AGNSS_KLOBUCHAR_IONOSPHERIC_CORRECTION:
+		return KLOBUCHAR_INDEX;
+	case NRF_MODEM_GNSS_AGNSS_NEQUICK_IONOSPHERIC_CORRECTION:
+		return NEQUICK_INDEX;
+	default:
+		return -1;
+	}
+}
+
+static int64_t unix_ms_to_gps_sec(int64_t unix_ms)
+{
+	return unix_ms / MSEC_PER_SEC - (int64_t)GPS_TO_UNIX_UTC_OFFSET_SECONDS +
+	       (int64_t)GPS_TO_UTC_LEAP_SECONDS;
+}
+
+/* Returns the GPS time of the ephemeris reference time. The ephemeris only contains the
+ * time of week, so the week is the one that puts toe closest to the reception time.
+ */
+static int64_t ephe_ref_time(int index, int64_t received)
+{
+	int64_t toe = (int64_t)records[index].data.ephemeris.toe * EPHE_TOE_SCALE;
+	int64_t delta = toe - received % GPS_WEEK_S;
+
+	if (delta > GPS_WEEK_S / 2) {
+		delta -= GPS_WEEK_S;
+	} else if (delta < -GPS_WEEK_S / 2) {
+		delta += GPS_WEEK_S;
+	}
+
+	return received + delta;
+}
+
+/* Returns the GPS time of the almanac reference time. The almanac week number is
+ * truncated, so the full week is the one closest to the reception time.
+ */
+static int64_t alm_ref_time(int index, int64_t received)
+{
+	const struct nrf_modem_gnss_agnss_gps_data_almanac *almanac = &records[index].data.almanac;
+	int64_t week = received / GPS_WEEK_S;
+	int64_t delta = ((int64_t)almanac->wn - week) % ALM_WN_MODULO;
+
+	if (delta >= ALM_WN_MODULO / 2) {
+		delta -= ALM_WN_MODULO;
+	} else if (delta < -ALM_WN_MODULO / 2) {
+		delta += ALM_WN_MODULO;
+	}
+
+	return (week + delta) * GPS_WEEK_S + (int64_t)almanac->toa * ALM_TOA_SCALE;
+}
+
+static bool record_valid(int index, int64_t now_ms)
+{
+	int64_t received;
+	int64_t now;
+
+	if (records[index].timestamp == 0 || now_ms < records[index].timestamp) {
+		return false;
+	}
+
+	received = unix_ms_to_gps_sec(records[index].timestamp);
+	now = unix_ms_to_gps_sec(now_ms);
+
+	switch (record_type(index)) {
+	case NRF_MODEM_GNSS_AGNSS_GPS_EPHEMERIDES:
+		/* The ephemeris fits the orbit on both sides of its reference time */
+		return llabs(now - ephe_ref_time(index, received)) < EPHE_VALIDITY_S;
+	case NRF_MODEM_GNSS_AGNSS_GPS_ALMANAC:
+		return now - alm_ref_time(index, received) < ALM_VALIDITY_S;
+	default:
+		/* UTC parameters and ionospheric corrections are used from their reception */
+		return now - received < ALM_VALIDITY_S;
+	}
+}
+
+#if defined(CONFIG_NRF_CLOUD_AGNSS_STORE_PERSISTENT)
+static int store_settings_set(const char *key, size_t len_rd, settings_read_cb read_cb,
+			      void *cb_arg)
+{
+	struct store_record record;
+	char *end;
+	long index;
+	ssize_t len;
+
+	index = strtol(key, &end, 10);
+	if (end == key || *end != '\0' || index < 0 || index >= RECORD_COUNT) {
+		return -ENOENT;
+	}
+
+	if (len_rd != offsetof(struct store_record, data) + record_data_size(index)) {
+		LOG_WRN("Unexpected length of stored A-GNSS data %ld: %d", index, (int)len_rd);
+		return 0;
+	}
+
+	len = read_cb(cb_arg, &record, len_rd);
+	if (len != (ssize_t)len_rd) {
+		LOG_ERR("Failed to read stored A-GNSS data %ld: %d", index, (int)len);
+		return len < 0 ? len : -EIO;
+	}
+
+	k_mutex_lock(&store_lock, K_FOREVER);
+	/* Keep data received after boot if the stored data is older */
+	if (record.timestamp > records[index].timestamp) {
+		memcpy(&records[index], &record, len_rd);
+	}
+	k_mutex_unlock(&store_lock);
+
+	return 0;
+}
+
+static int store_load(void)
+{
+	static bool loaded;
+	int err;
+
+	if (loaded) {
+		return 0;
+	}
+
+	err = settings_subsys_init();
+	if (err) {
+		LOG_ERR("Settings init failed: %d", err);
+		return err;
+	}
+
+	err = settings_load_subtree(STORE_SETTINGS_NAME);
+	if (err) {
+		LOG_ERR("Cannot load stored A-GNSS data: %d", err);
+		return err;
+	}
+
+	loaded = true;
+
+	return 0;
+}
+
+static void store_save_work_fn(struct k_work *work)
+{
+	struct store_record record;
+	char key[sizeof(STORE_SETTINGS_NAME "/") + 3];
+	size_t len;
+	int err;
+
+	ARG_UNUSED(work);
+
+	for (int i = 0; i < RECORD_COUNT; i++) {
+		if (!atomic_test_and_clear_bit(dirty, i)) {
+			continue;
+		}
+
+		len = offsetof(struct store_record, data) + record_data_size(i);
+
+		k_mutex_lock(&store_lock, K_FOREVER);
+		memcpy(&record, &records[i], len);
+		k_mutex_unlock(&store_lock);
+
+		(void)snprintf(key, sizeof(key), STORE_SETTINGS_NAME "/%d", i);
+
+		err = settings_save_one(key, &record, len);
+		if (err) {
+			LOG_WRN("Failed to save A-GNSS data %d: %d", i, err);
+		}
+	}
+}
+#else
+static int store_load(void)
+{
+	return 0;
+}
+#endif /* CONFIG_NRF_CLOUD_AGNSS_STORE_PERSISTENT */
+
+void nrf_cloud_agnss_store_add(uint16_t type, const void *data, size_t data_len)
+{
+	int64_t now;
+	int index;
+
+	if (!data) {
+		return;
+	}
+
+	index = record_index(type, data);
+	if (index < 0 || data_len != record_data_size(index)) {
+		return;
+	}
+
+	if (date_time_now(&now)) {
+		LOG_DBG("Current time not known, A-GNSS data not stored");
+		return;
+	}
+
+	k_mutex_lock(&store_lock, K_FOREVER);
+	(void)store_load();
+	records[index].timestamp = now;
+	memcpy(&records[index].data, data, data_len);
+	k_mutex_unlock(&store_lock);
+
+#if defined(CONFIG_NRF_CLOUD_AGNSS_STORE_PERSISTENT)
+	atomic_set_bit(dirty, index);
+	(void)k_work_reschedule(&store_save_work, STORE_SAVE_DELAY);
+#endif
+}
+
+static bool record_inject(int index, int64_t now)
+{
+	int err;
+
+	if (!record_valid(index, now)) {
+		return false;
+	}
+
+	err = nrf_modem_gnss_agnss_write(&records[index].data, record_data_size(index),
+					 record_type(index));
+	if (err) {
+		LOG_WRN("Failed to inject stored A-GNSS data %d: %d", index, err);
+		return false;
+	}
+
+	return true;
+}
+
+int nrf_cloud_agnss_store_inject(struct nrf_modem_gnss_agnss_data_frame *request)
+{
+	static const struct {
+		uint32_t flag;
+		int index;
+	} other_data[] = {
+		{ NRF_MODEM_GNSS_AGNSS_GPS_UTC_REQUEST, UTC_INDEX },
+		{ NRF_MODEM_GNSS_AGNSS_KLOBUCHAR_REQUEST, KLOBUCHAR_INDEX },
+		{ NRF_MODEM_GNSS_AGNSS_NEQUICK_REQUEST, NEQUICK_INDEX },
+	};
+	int64_t now;
+	int count = 0;
+
+	if (!request) {
+		return -EINVAL;
+	}
+
+	if (date_time_now(&now)) {
+		LOG_DBG("Current time not known, stored A-GNSS data not used");
+		return -ENODATA;
+	}
+
+	k_mutex_lock(&store_lock, K_FOREVER);
+	(void)store_load();
+
+	for (int i = 0; i < request->system_count; i++) {
+		if (request->system[i].system_id != NRF_MODEM_GNSS_SYSTEM_GPS) {
+			continue;
+		}
+
+		for (int sv = 0; sv < GPS_SV_COUNT; sv++) {
+			uint64_t sv_bit = BIT64(sv);
+
+			if ((request->system[i].sv_mask_ephe & sv_bit) &&
+			    record_inject(EPHE_FIRST + sv, now)) {
+				request->system[i].sv_mask_ephe &= ~sv_bit;
+				count++;
+			}
+			if ((request->system[i].sv_mask_alm & sv_bit) &&
+			    record_inject(ALM_FIRST + sv, now)) {
+				request->system[i].sv_mask_alm &= ~sv_bit;
+				count++;
+			}
+		}
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(other_data); i++) {
+		if ((request->data_flags & other_data[i].flag) &&
+		    record_inject(other_data[i].index, now)) {
+			request->data_flags &= ~other_data[i].flag;
+			count++;
+		}
+	}
+
+	k_mutex_unlock(&store_lock);
+
+	LOG_DBG("Injected %d stored A-GNSS data elements", count);
+
+	return count;
+}
+
+void nrf_cloud_agnss_store_clear(void)
+{
+#if defined(CONFIG_NRF_CLOUD_AGNSS_STORE_PERSISTENT)
+	char key[sizeof(STORE_SETTINGS_NAME "/") + 3];
+#endif
+
+	k_mutex_lock(&store_lock, K_FOREVER);
+
+#if defined(CONFIG_NRF_CLOUD_AGNSS_STORE_PERSISTENT)
+	(void)k_work_cancel_delayable(&store_save_work);
+	(void)store_load();
+
+	for (int i = 0; i < RECORD_COUNT; i++) {
+		atomic_clear_bit(dirty, i);
+		if (records[i].timestamp == 0) {
+			continue;
+		}
+
+		(void)snprintf(key, sizeof(key), STORE_SETTINGS_NAME "/%d", i);
+		(void)settings_delete(key);
+	}
+#endif
+
+	memset(records, 0, sizeof(records));
+
+	k_mutex_unlock(&store_lock);
+}
@@ -6,6 +6,7 @@
 
 #include "nrf_cloud_codec_internal.h"
 #include "nrf_cloud_mem.h"
+#include "nrf_cloud_msg_stream.h"
 #include <net/nrf_cloud_codec.h>
 #include "nrf_cloud_log_internal.h"
 #include <net/nrf_cloud_location.h>
@@ -2582,6 +2583,15 @@ cleanup:
 	return ret;
 }
 
+static bool json_str_equal(const char *const buf, const char *const key, const char *const val)
+{
+	const char *str;
+	size_t str_len;
+
+	return !nrf_cloud_msg_stream_json_str_get(buf, strlen(buf), key, &str, &str_len) &&
+	       (str_len == strlen(val)) && !memcmp(str, val, str_len);
+}
+
 bool nrf_cloud_disconnection_request_decode(const char *const buf)
 {
 	if (buf == NULL) {
@@ -2601,21 +2611,10 @@ bool nrf_cloud_disconnection_request_decode(const char *const buf)
 		return false;
 	}
 
-	/* If the quick test passes, use cJSON to get certainty */
-	bool ret = true;
-	cJSON *discon_request_obj = cJSON_Parse(buf);
-
-	/* Check for nRF Cloud disconnection request MQTT message */
-	if (!json_item_string_exists(discon_request_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY,
-				     NRF_CLOUD_JSON_MSG_TYPE_VAL_DISCONNECT) ||
-	    !json_item_string_exists(discon_request_obj, NRF_CLOUD_JSON_APPID_KEY,
-				     NRF_CLOUD_JSON_APPID_VAL_DEVICE)) {
-		/* Not a disconnection request message */
-		ret = false;
-	}
-
-	cJSON_Delete(discon_request_obj);
-	return ret;
+	/* If the quick test passes, check the values without parsing the whole message */
+	return json_str_equal(buf, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+			      NRF_CLOUD_JSON_MSG_TYPE_VAL_DISCONNECT) &&
+	       json_str_equal(buf, NRF_CLOUD_JSON_APPID_KEY, NRF_CLOUD_JSON_APPID_VAL_DEVICE);
 }
 
 int nrf_cloud_gnss_msg_json_encode(const struct nrf_cloud_gnss_data *const gnss,
@@ -13,6 +13,9 @@
 #include <zephyr/sys/ring_buffer.h>
 #include <zephyr/sys/base64.h>
 #include <date_time.h>
+#if defined(CONFIG_NRF_CLOUD_LOG_BATCH_LINK_AWARE)
+#include <modem/lte_lc.h>
+#endif
 #include "nrf_cloud_fsm.h"
 #include "nrf_cloud_mem.h"
 #include "nrf_cloud_codec_internal.h"
@@ -64,8 +67,10 @@ static struct nrf_cloud_log_stats {
 	uint32_t lines_sent;
 	/** Total number of bytes (before TLS) sent */
 	uint32_t bytes_sent;
-	/** Total number of bytes (before TLS) sent */
+	/** Total number of lines dropped */
 	uint32_t lines_dropped;
+	/** Total number of uploads */
+	uint32_t uploads;
 } stats;
 
 /* Information about a log message is stored in the log_context by the logger_process backend
@@ -118,6 +123,31 @@ static const char *const filtered_modules[] = {
 static int filtered_ids[ARRAY_SIZE(filtered_modules)];
 
 static K_SEM_DEFINE(ncl_active, 1, 1);
+/* Thread holding ncl_active, used to detect logs generated while storing logs. */
+static k_tid_t ncl_owner;
+
+/* Taken while a batch of logs is uploaded. The logs are stored to the other ring buffer
+ * meanwhile, so ncl_active is not held during the upload.
+ */
+static K_SEM_DEFINE(ncl_upload, 1, 1);
+/* Thread uploading logs, used to detect logs generated while sending logs. */
+static k_tid_t upload_owner;
+
+#if defined(CONFIG_NRF_CLOUD_LOG_BATCHING)
+/* Uptime when the first message of the current batch was buffered. */
+static int64_t batch_start;
+/* The LTE link is in RRC connected mode, so the radio is already on. */
+static atomic_t link_active;
+
+/* The age and link triggers upload the logs from a dedicated work queue, so that neither the
+ * logging thread nor the system work queue is blocked while the logs are being sent.
+ */
+static K_THREAD_STACK_DEFINE(flush_workq_stack, CONFIG_NRF_CLOUD_LOG_BATCH_STACK_SIZE);
+static struct k_work_q flush_workq;
+
+static void flush_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(flush_work, flush_work_fn);
+#endif
 
 BUILD_ASSERT(CONFIG_NRF_CLOUD_LOG_BUF_SIZE < CONFIG_NRF_CLOUD_LOG_RING_BUF_SIZE,
 	     "Ring buffer size must be larger than log buffer size");
@@ -137,8 +167,118 @@ LOG_BACKEND_DEFINE(log_nrf_cloud_backend, logger_api, false);
 /* Reduce reported log_buf size by 1 so we can null terminate */
 LOG_OUTPUT_DEFINE(log_nrf_cloud_output, logger_out, log_buf, (sizeof(log_buf) - 1));
 RING_BUF_DECLARE(log_nrf_cloud_rb, RING_BUF_SIZE);
+RING_BUF_DECLARE(log_nrf_cloud_rb_alt, RING_BUF_SIZE);
+
+/* Ring buffer the logs are stored to. The other ring buffer holds the batch being uploaded. */
+static struct ring_buf *log_rb = &log_nrf_cloud_rb;
+
+static int batch_upload(void);
+
+/* The lock is only held while logs are stored and while the ring buffers are swapped, so it
+ * is never waited for. Logs generated while storing or sending logs are dropped to avoid an
+ * endless loop.
+ */
+static bool ncl_lock(void)
+{
+	if ((ncl_owner == k_current_get()) || (upload_owner == k_current_get())) {
+		return false;
+	}
+	if (k_sem_take(&ncl_active, K_NO_WAIT) < 0) {
+		return false;
+	}
+	ncl_owner = k_current_get();
+	return true;
+}
+
+static void ncl_unlock(void)
+{
+	ncl_owner = NULL;
+	k_sem_give(&ncl_active);
+}
+
+#if defined(CONFIG_NRF_CLOUD_LOG_BATCHING)
+static void flush_schedule(k_timeout_t delay)
+{
+	(void)k_work_reschedule_for_queue(&flush_workq, &flush_work, delay);
+}
+
+static bool batch_flush_due(void)
+{
+	if (num_msgs == 0) {
+		return false;
+	}
+	/* Sending while the radio is already on costs little extra energy. */
+	if (atomic_get(&link_active)) {
+		return true;
+	}
+	if (ring_buf_size_get(log_rb) >=
+	    (ring_buf_capacity_get(log_rb) * CONFIG_NRF_CLOUD_LOG_BATCH_THRESHOLD / 100)) {
+		return true;
+	}
+	return (k_uptime_get() - batch_start) >=
+	       (CONFIG_NRF_CLOUD_LOG_BATCH_MAX_AGE_S * MSEC_PER_SEC);
+}
 
-static int send_ring_buffer(void);
+static void batch_started(void)
+{
+	batch_start = k_uptime_get();
+	flush_schedule(K_SECONDS(CONFIG_NRF_CLOUD_LOG_BATCH_MAX_AGE_S));
+}
+
+static void flush_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	if (!ncl_lock()) {
+		/* The logging thread is busy; it might flush the buffer itself. */
+		flush_schedule(K_MSEC(LOG_OUTPUT_RETRY_DELAY_MS));
+		return;
+	}
+
+	if (num_msgs && (logger_is_ready(&log_nrf_cloud_backend) == 0)) {
+		LOG_DBG("Flushing %d buffered messages", num_msgs);
+		(void)batch_upload();
+	}
+
+	if (num_msgs) {
+		/* Not connected; try again later. */
+		flush_schedule(K_SECONDS(CONFIG_NRF_CLOUD_LOG_BATCH_MAX_AGE_S));
+	}
+
+	ncl_unlock();
+}
+#else
+static bool batch_flush_due(void)
+{
+	return true;
+}
+
+static void batch_started(void)
+{
+}
+#endif /* CONFIG_NRF_CLOUD_LOG_BATCHING */
+
+#if defined(CONFIG_NRF_CLOUD_LOG_BATCH_LINK_AWARE)
+static void lte_handler(const struct lte_lc_evt *const evt)
+{
+	switch (evt->type) {
+	case LTE_LC_EVT_RRC_UPDATE:
+		atomic_set(&link_active, evt->rrc_mode == LTE_LC_RRC_MODE_CONNECTED);
+		if (evt->rrc_mode == LTE_LC_RRC_MODE_CONNECTED) {
+			flush_schedule(K_NO_WAIT);
+		}
+		break;
+#if defined(CONFIG_LTE_LC_TAU_PRE_WARNING_MODULE)
+	case LTE_LC_EVT_TAU_PRE_WARNING:
+		/* Send together with the upcoming tracking area update. */
+		flush_schedule(K_NO_WAIT);
+		break;
+#endif
+	default:
+		break;
+	}
+}
+#endif /* CONFIG_NRF_CLOUD_LOG_BATCH_LINK_AWARE */
 
 static void logger_init(const struct log_backend *const backend)
 {
@@ -179,6 +319,19 @@ static void logger_init(const struct log_backend *const backend)
 			actual_level);
 	}
 
+#if defined(CONFIG_NRF_CLOUD_LOG_BATCHING)
+	struct k_work_queue_config workq_cfg = {
+		.name = "nrf_cloud_log",
+	};
+
+	k_work_queue_start(&flush_workq, flush_workq_stack,
+			   K_THREAD_STACK_SIZEOF(flush_workq_stack),
+			   K_LOWEST_APPLICATION_THREAD_PRIO, &workq_cfg);
+#endif
+#if defined(CONFIG_NRF_CLOUD_LOG_BATCH_LINK_AWARE)
+	lte_lc_register_handler(lte_handler);
+#endif
+
 	LOG_DBG("domain name:%s, num domains:%u, num sources:%u",
 		log_domain_name_get(Z_LOG_LOCAL_DOMAIN_ID), log_domains_count(),
 		log_src_cnt_get(Z_LOG_LOCAL_DOMAIN_ID));
@@ -267,25 +420,40 @@ static void logger_process(const struct log_backend *const backend, union log_ms
 		src_id != UNKNOWN_LOG_SOURCE ? log_source_name_get(dom_id, src_id) : NULL;
 	int64_t ts = log_output_timestamp_to_us(log_msg_get_timestamp(&msg->log)) / 1000U;
 
+	/* The log is rendered and stored by logger_out() with the lock held. */
+	if (!ncl_lock()) {
+		stats.lines_dropped++;
+		return;
+	}
+
 	nrf_cloud_log_init_context_internal(rest_ctx, device_id, level, src_id, src_name, dom_id,
 					    ts, &log_context);
 
 	log_output_func = log_format_func_t_get(log_format_current);
 	log_output_func(&log_nrf_cloud_output, &msg->log, log_output_flags);
+
+	ncl_unlock();
 }
 
 static void logger_dropped(const struct log_backend *const backend, uint32_t cnt)
 {
-	if (backend == &log_nrf_cloud_backend) {
+	if (backend != &log_nrf_cloud_backend) {
+		return;
+	}
+
+	stats.lines_dropped += cnt;
+
+	if (ncl_lock()) {
 		log_output_dropped_process(&log_nrf_cloud_output, cnt);
-		stats.lines_dropped += cnt;
+		ncl_unlock();
 	}
 }
 
 static void logger_panic(const struct log_backend *const backend)
 {
-	if (backend == &log_nrf_cloud_backend) {
+	if ((backend == &log_nrf_cloud_backend) && ncl_lock()) {
 		log_output_flush(&log_nrf_cloud_output);
+		ncl_unlock();
 	}
 }
 
@@ -340,14 +508,27 @@ static void logger_notify(const struct log_backend *const backend, enum log_back
 		return;
 	}
 
+	/* If the lock is taken, the buffer is being sent already. */
+	if (!ncl_lock()) {
+		return;
+	}
+
+	/* Without batching, the buffer is flushed each time the logging thread is done. */
+	if (!batch_flush_due()) {
+		ncl_unlock();
+		return;
+	}
+
 	/* Flush our transmission buffer */
-	send_ring_buffer();
+	(void)batch_upload();
+	ncl_unlock();
+
 	if (CONFIG_NRF_CLOUD_LOG_LOG_LEVEL >= LOG_LEVEL_DBG) {
 		LOG_DBG("Buffered lines:%u, bytes:%u; logged lines:%u, bytes:%u; "
-			"sent lines:%u, bytes:%u; dropped lines:%u",
-			log_buffered_cnt(), ring_buf_size_get(&log_nrf_cloud_rb),
+			"sent lines:%u, bytes:%u, uploads:%u; dropped lines:%u",
+			log_buffered_cnt(), ring_buf_size_get(log_rb),
 			stats.lines_rendered, stats.bytes_rendered, stats.lines_sent,
-			stats.bytes_sent, stats.lines_dropped);
+			stats.bytes_sent, stats.uploads, stats.lines_dropped);
 	} else {
 		LOG_INF("Sent lines:%u, bytes:%u", stats.lines_sent, stats.bytes_sent);
 	}
@@ -412,7 +593,10 @@ static char *get_dict_topic(void)
 	return topic;
 }
 
-static int send_ring_buffer(void)
+/* Sends the messages stored in the given ring buffer and empties it. The ring buffer is not
+ * used by the other threads meanwhile, so ncl_active is not needed.
+ */
+static int send_ring_buffer(struct ring_buf *rb, int msgs)
 {
 	int err = 0;
 	int ret = 0;
@@ -424,19 +608,12 @@ static int send_ring_buffer(void)
 	uint32_t log_b64_len;
 	struct nrf_cloud_data output_data;
 
-	/* The bulk topic requires the multiple JSON messages to be placed in
-	 * a JSON array. Close the array then send it.
-	 */
-	if ((num_msgs != 0) && (log_format_current == LOG_OUTPUT_TEXT)) {
-		ring_buf_put(&log_nrf_cloud_rb, "]", 1);
-	}
-
-	stored = ring_buf_size_get(&log_nrf_cloud_rb);
-	log_rb_len = ring_buf_get_claim(&log_nrf_cloud_rb, &log_rb_ptr, stored);
+	stored = ring_buf_size_get(rb);
+	log_rb_len = ring_buf_get_claim(rb, &log_rb_ptr, stored);
 	if (log_rb_len != stored) {
 		LOG_WRN("Capacity:%u, free:%u, stored:%u, claimed:%u",
-			ring_buf_capacity_get(&log_nrf_cloud_rb),
-			ring_buf_space_get(&log_nrf_cloud_rb), stored, log_rb_len);
+			ring_buf_capacity_get(rb),
+			ring_buf_space_get(rb), stored, log_rb_len);
 		stored = log_rb_len;
 	}
 	if (!log_rb_len) {
@@ -497,18 +674,19 @@ static int send_ring_buffer(void)
 		err = -ENODEV;
 	}
 	if (!err) {
-		stats.lines_sent += num_msgs;
+		stats.lines_sent += msgs;
 		stats.bytes_sent += output_data.len;
+		stats.uploads++;
 	}
 
 cleanup:
 	if (err) {
 		LOG_ERR("Error %d ret %d processing ring buffer", err, ret);
+		stats.lines_dropped += msgs;
 	}
 
-	ret = ring_buf_get_finish(&log_nrf_cloud_rb, stored);
-	ring_buf_reset(&log_nrf_cloud_rb);
-	num_msgs = 0;
+	ret = ring_buf_get_finish(rb, stored);
+	ring_buf_reset(rb);
 
 	if (ret) {
 		LOG_ERR("Error finishing ring buffer: %d", ret);
@@ -524,6 +702,44 @@ cleanup:
 	return err;
 }
 
+/* Swaps the ring buffer holding the stored logs for the empty one and uploads the logs.
+ * Must be called with ncl_active held. The lock is released during the upload, so that new
+ * logs can be stored meanwhile, and taken again before returning.
+ */
+static int batch_upload(void)
+{
+	struct ring_buf *rb = log_rb;
+	int msgs = num_msgs;
+	int err;
+
+	/* The logs stay in the ring buffer until the upload in progress is done. */
+	if (k_sem_take(&ncl_upload, K_NO_WAIT) < 0) {
+		return -EBUSY;
+	}
+
+	/* The bulk topic requires the multiple JSON messages to be placed in
+	 * a JSON array. Close the array then send it.
+	 */
+	if ((msgs != 0) && (log_format_current == LOG_OUTPUT_TEXT)) {
+		ring_buf_put(rb, "]", 1);
+	}
+
+	log_rb = (rb == &log_nrf_cloud_rb) ? &log_nrf_cloud_rb_alt : &log_nrf_cloud_rb;
+	num_msgs = 0;
+
+	upload_owner = k_current_get();
+	ncl_unlock();
+
+	err = send_ring_buffer(rb, msgs);
+
+	(void)k_sem_take(&ncl_active, K_FOREVER);
+	ncl_owner = k_current_get();
+	upload_owner = NULL;
+	k_sem_give(&ncl_upload);
+
+	return err;
+}
+
 static int logger_out(uint8_t *buf, size_t size, void *ctx)
 {
 	ARG_UNUSED(ctx);
@@ -534,14 +750,11 @@ static int logger_out(uint8_t *buf, size_t size, void *ctx)
 	int extra;
 	static int retry_count;
 
+	/* Called with ncl_active held. */
 	if (!size) {
 		return 0;
 	}
 
-	if (k_sem_take(&ncl_active, K_NO_WAIT) < 0) {
-		return orig_size;
-	}
-
 	if (log_format_current == LOG_OUTPUT_TEXT) {
 		if ((buf >= log_buf) && (&buf[size] <= &log_buf[CONFIG_NRF_CLOUD_LOG_BUF_SIZE])) {
 			/* Our log_buf has 1 extra byte, and we always dump the whole buffer
@@ -551,7 +764,7 @@ static int logger_out(uint8_t *buf, size_t size, void *ctx)
 		} else {
 			printk("buf %p..%p is not inside our log_buf %p..%p\n", buf, &buf[size],
 			       log_buf, &log_buf[CONFIG_NRF_CLOUD_LOG_BUF_SIZE]);
-			return orig_size;
+			goto end;
 		}
 
 		extra = 3;
@@ -589,13 +802,14 @@ static int logger_out(uint8_t *buf, size_t size, void *ctx)
 			break;
 		}
 		/* If there is enough room for this rendering, store it and leave. */
-		if (ring_buf_space_get(&log_nrf_cloud_rb) > (data.len + extra)) {
+		if (ring_buf_space_get(log_rb) > (data.len + extra)) {
 
 			if (num_msgs == 0) {
+				batch_started();
 				/* Insert start of buffer marker */
 				if (log_format_current == LOG_OUTPUT_TEXT) {
 					/* Open JSON array */
-					ring_buf_put(&log_nrf_cloud_rb, "[", 1);
+					ring_buf_put(log_rb, "[", 1);
 				} else {
 					struct nrf_cloud_bin_hdr hdr;
 
@@ -603,13 +817,12 @@ static int logger_out(uint8_t *buf, size_t size, void *ctx)
 					hdr.format = NRF_CLOUD_DICT_LOG_FMT;
 					hdr.ts = log_context.ts;
 					hdr.sequence = log_context.sequence;
-					ring_buf_put(&log_nrf_cloud_rb, (const uint8_t *)&hdr,
-						     sizeof(hdr));
+					ring_buf_put(log_rb, (const uint8_t *)&hdr, sizeof(hdr));
 				}
 			} else if (log_format_current == LOG_OUTPUT_TEXT) {
-				ring_buf_put(&log_nrf_cloud_rb, ",", 1);
+				ring_buf_put(log_rb, ",", 1);
 			}
-			stored = ring_buf_put(&log_nrf_cloud_rb, data.ptr, data.len);
+			stored = ring_buf_put(log_rb, data.ptr, data.len);
 			if (stored != data.len) {
 				LOG_WRN("Stored:%u, put:%u", stored, data.len);
 			}
@@ -621,21 +834,29 @@ static int logger_out(uint8_t *buf, size_t size, void *ctx)
 			break;
 		}
 
-		/* Low on space, so send everything. */
-		if (logger_is_ready(&log_nrf_cloud_backend) == 0) {
-			err = send_ring_buffer();
-			if (!err) {
+		/* Low on space, so send everything. The ring buffers are swapped, so there is
+		 * room for this rendering afterwards, even if the upload fails.
+		 */
+		if ((num_msgs != 0) && (logger_is_ready(&log_nrf_cloud_backend) == 0)) {
+			err = batch_upload();
+			if (err != -EBUSY) {
 				retry_count = 0;
+				err = 0;
+				continue;
 			}
-		} else if (retry_count < LOG_OUTPUT_RETRIES) {
+			/* The other ring buffer is still being uploaded, so drop this rendering. */
+		} else if ((num_msgs != 0) && (retry_count < LOG_OUTPUT_RETRIES)) {
 			k_sleep(K_MSEC(LOG_OUTPUT_RETRY_DELAY_MS));
 			retry_count++;
+			continue;
 		} else {
-			if (log_format_current == LOG_OUTPUT_TEXT) {
-				cJSON_free((void *)data.ptr);
-			}
-			err = -ETIMEDOUT;
+			err = (num_msgs != 0) ? -ETIMEDOUT : -EMSGSIZE;
 		}
+
+		if (log_format_current == LOG_OUTPUT_TEXT) {
+			cJSON_free((void *)data.ptr);
+		}
+		stats.lines_dropped++;
 	} while (!err);
 
 	if (err) {
@@ -645,6 +866,5 @@ end:
 	/* Return original size of log buffer. Otherwise, logger_out will be called
 	 * again with the remainder until the full size is sent.
 	 */
-	k_sem_give(&ncl_active);
 	return orig_size;
 }
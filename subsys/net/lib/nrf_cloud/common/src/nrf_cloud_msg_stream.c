@@ -0,0 +1,680 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <float.h>
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+#include <net/nrf_cloud_defs.h>
+#include "nrf_cloud_msg_stream.h"
+
+#define CBOR_MAJOR_UINT		0
+#define CBOR_MAJOR_NINT		1
+#define CBOR_MAJOR_TSTR		3
+#define CBOR_MAJOR_ARRAY	4
+#define CBOR_MAJOR_MAP		5
+#define CBOR_INITIAL(major, info) ((uint8_t)(((major) << 5) | (info)))
+/* Largest argument that fits in the initial byte. */
+#define CBOR_INFO_MAX		23
+#define CBOR_INFO_UINT8		24
+#define CBOR_INFO_UINT16	25
+#define CBOR_INFO_UINT32	26
+#define CBOR_INFO_UINT64	27
+#define CBOR_FALSE		0xf4
+#define CBOR_TRUE		0xf5
+#define CBOR_FLOAT64		0xfb
+
+/* Long enough for "%1.17g" of any double and for any int64_t. */
+#define NUM_STR_SIZE		26
+
+static void err_set(struct nrf_cloud_msg_stream *const s, int err)
+{
+	if (!s->err) {
+		s->err = err;
+	}
+}
+
+static void put(struct nrf_cloud_msg_stream *const s, const void *data, size_t len)
+{
+	/* Keep counting after an error, so the needed buffer size is known. */
+	if (s->buf && !s->err) {
+		if (len > (s->size - s->len)) {
+			err_set(s, -ENOMEM);
+		} else {
+			memcpy(&s->buf[s->len], data, len);
+		}
+	}
+
+	s->len += len;
+}
+
+static void char_put(struct nrf_cloud_msg_stream *const s, char c)
+{
+	put(s, &c, 1);
+}
+
+static void cbor_head_put(struct nrf_cloud_msg_stream *const s, uint8_t major, uint64_t arg)
+{
+	uint8_t head[9];
+	size_t len;
+
+	if (arg <= CBOR_INFO_MAX) {
+		head[0] = CBOR_INITIAL(major, arg);
+		len = 1;
+	} else if (arg <= UINT8_MAX) {
+		head[0] = CBOR_INITIAL(major, CBOR_INFO_UINT8);
+		head[1] = (uint8_t)arg;
+		len = 2;
+	} else if (arg <= UINT16_MAX) {
+		head[0] = CBOR_INITIAL(major, CBOR_INFO_UINT16);
+		sys_put_be16((uint16_t)arg, &head[1]);
+		len = 3;
+	} else if (arg <= UINT32_MAX) {
+		head[0] = CBOR_INITIAL(major, CBOR_INFO_UINT32);
+		sys_put_be32((uint32_t)arg, &head[1]);
+		len = 5;
+	} else {
+		head[0] = CBOR_INITIAL(major, CBOR_INFO_UINT64);
+		sys_put_be64(arg, &head[1]);
+		len = 9;
+	}
+
+	put(s, head, len);
+}
+
+/* Same escaping as cJSON, so the output does not change when switching encoders. */
+static void json_str_put(struct nrf_cloud_msg_stream *const s, const char *str)
+{
+	const char *run = str;
+	const char *p;
+
+	char_put(s, '"');
+
+	for (p = str; *p; p++) {
+		const unsigned char c = (unsigned char)*p;
+		char esc[7];
+		size_t esc_len = 2;
+
+		if ((c >= ' ') && (c != '"') && (c != '\\')) {
+			continue;
+		}
+
+		put(s, run, p - run);
+		run = p + 1;
+
+		esc[0] = '\\';
+		switch (c) {
+		case '"':
+		case '\\':
+			esc[1] = c;
+			break;
+		case '\b':
+			esc[1] = 'b';
+			break;
+		case '\f':
+			esc[1] = 'f';
+			break;
+		case '\n':
+			esc[1] = 'n';
+			break;
+		case '\r':
+			esc[1] = 'r';
+			break;
+		case '\t':
+			esc[1] = 't';
+			break;
+		default:
+			esc_len = snprintf(esc, sizeof(esc), "\\u%04x", c);
+			break;
+		}
+
+		put(s, esc, esc_len);
+	}
+
+	put(s, run, p - run);
+	char_put(s, '"');
+}
+
+static void str_put(struct nrf_cloud_msg_stream *const s, const char *str)
+{
+	if (s->fmt == NRF_CLOUD_MSG_STREAM_JSON) {
+		json_str_put(s, str);
+	} else {
+		const size_t len = strlen(str);
+
+		cbor_head_put(s, CBOR_MAJOR_TSTR, len);
+		put(s, str, len);
+	}
+}
+
+static void json_int_put(struct nrf_cloud_msg_stream *const s, int64_t val)
+{
+	char num[NUM_STR_SIZE];
+	size_t i = sizeof(num);
+	uint64_t mag = (val < 0) ? (0 - (uint64_t)val) : (uint64_t)val;
+
+	do {
+		num[--i] = '0' + (mag % 10);
+		mag /= 10;
+	} while (mag);
+
+	if (val < 0) {
+		num[--i] = '-';
+	}
+
+	put(s, &num[i], sizeof(num) - i);
+}
+
+static bool double_equal(double a, double b)
+{
+	const double max_val = MAX(fabs(a), fabs(b));
+
+	return fabs(a - b) <= (max_val * DBL_EPSILON);
+}
+
+static void json_num_put(struct nrf_cloud_msg_stream *const s, double val)
+{
+	char num[NUM_STR_SIZE];
+	int len;
+
+	if (isnan(val) || isinf(val)) {
+		put(s, "null", 4);
+		return;
+	}
+
+	/* cJSON prints numbers that fit in an int as integers. */
+	if ((val >= INT_MIN) && (val <= INT_MAX) && (val == (double)(int)val)) {
+		json_int_put(s, (int)val);
+		return;
+	}
+
+	/* Use the shortest representation that reads back as the same number. */
+	len = snprintf(num, sizeof(num), "%1.15g", val);
+	if (!double_equal(strtod(num, NULL), val)) {
+		len = snprintf(num, sizeof(num), "%1.17g", val);
+	}
+
+	if ((len < 0) || ((size_t)len >= sizeof(num))) {
+		err_set(s, -EINVAL);
+		return;
+	}
+
+	put(s, num, len);
+}
+
+/* Checks the key, writes the separator and the key. Returns false if the item
+ * cannot be added.
+ */
+static bool item_start(struct nrf_cloud_msg_stream *const s, const char *const key)
+{
+	const bool in_obj = s->depth && s->level[s->depth - 1].obj;
+
+	if (in_obj != (key != NULL)) {
+		err_set(s, -EINVAL);
+		return false;
+	}
+
+	if (!s->depth) {
+		return true;
+	}
+
+	if ((s->fmt == NRF_CLOUD_MSG_STREAM_JSON) && s->level[s->depth - 1].count) {
+		char_put(s, ',');
+	}
+
+	s->level[s->depth - 1].count++;
+
+	if (key) {
+		str_put(s, key);
+		if (s->fmt == NRF_CLOUD_MSG_STREAM_JSON) {
+			char_put(s, ':');
+		}
+	}
+
+	return true;
+}
+
+static int container_start(struct nrf_cloud_msg_stream *const s, const char *const key,
+			   bool obj)
+{
+	if (s->depth >= ARRAY_SIZE(s->level)) {
+		err_set(s, -EINVAL);
+		return s->err;
+	}
+
+	if (!item_start(s, key)) {
+		return s->err;
+	}
+
+	s->level[s->depth].hdr = s->len;
+	s->level[s->depth].count = 0;
+	s->level[s->depth].obj = obj;
+	s->depth++;
+
+	if (s->fmt == NRF_CLOUD_MSG_STREAM_JSON) {
+		char_put(s, obj ? '{' : '[');
+	} else {
+		/* Placeholder, the item count is written when the container ends. */
+		char_put(s, CBOR_INITIAL(obj ? CBOR_MAJOR_MAP : CBOR_MAJOR_ARRAY, 0));
+	}
+
+	return s->err;
+}
+
+static int container_end(struct nrf_cloud_msg_stream *const s, bool obj)
+{
+	const uint8_t major = obj ? CBOR_MAJOR_MAP : CBOR_MAJOR_ARRAY;
+	size_t hdr;
+	uint32_t count;
+
+	if (!s->depth || (s->level[s->depth - 1].obj != obj)) {
+		err_set(s, -EINVAL);
+		return s->err;
+	}
+
+	s->depth--;
+	hdr = s->level[s->depth].hdr;
+	count = s->level[s->depth].count;
+
+	if (s->fmt == NRF_CLOUD_MSG_STREAM_JSON) {
+		char_put(s, obj ? '}' : ']');
+		return s->err;
+	}
+
+	if (count <= CBOR_INFO_MAX) {
+		if (s->buf && !s->err) {
+			s->buf[hdr] = CBOR_INITIAL(major, count);
+		}
+	} else if (count <= UINT8_MAX) {
+		/* The count needs one more byte, move the items to make room for it. */
+		if (s->buf && !s->err) {
+			if (s->len >= s->size) {
+				err_set(s, -ENOMEM);
+			} else {
+				memmove(&s->buf[hdr + 2], &s->buf[hdr + 1], s->len - hdr - 1);
+				s->buf[hdr] = CBOR_INITIAL(major, CBOR_INFO_UINT8);
+				s->buf[hdr + 1] = (uint8_t)count;
+			}
+		}
+		s->len++;
+	} else {
+		err_set(s, -E2BIG);
+	}
+
+	return s->err;
+}
+
+void nrf_cloud_msg_stream_init(struct nrf_cloud_msg_stream *const stream,
+			       enum nrf_cloud_msg_stream_fmt fmt, void *buf, size_t size)
+{
+	__ASSERT_NO_MSG(stream != NULL);
+
+	memset(stream, 0, sizeof(*stream));
+	stream->buf = buf;
+	stream->size = buf ? size : 0;
+	stream->fmt = fmt;
+}
+
+int nrf_cloud_msg_stream_obj_start(struct nrf_cloud_msg_stream *const stream,
+				   const char *const key)
+{
+	__ASSERT_NO_MSG(stream != NULL);
+
+	return container_start(stream, key, true);
+}
+
+int nrf_cloud_msg_stream_obj_end(struct nrf_cloud_msg_stream *const stream)
+{
+	__ASSERT_NO_MSG(stream != NULL);
+
+	return container_end(stream, true);
+}
+
+int nrf_cloud_msg_stream_arr_start(struct nrf_cloud_msg_stream *const stream,
+				   const char *const key)
+{
+	__ASSERT_NO_MSG(stream != NULL);
+
+	return container_start(stream, key, false);
+}
+
+int nrf_cloud_msg_stream_arr_end(struct nrf_cloud_msg_stream *const stream)
+{
+	__ASSERT_NO_MSG(stream != NULL);
+
+	return container_end(stream, false);
+}
+
+int nrf_cloud_msg_stream_str_add(struct nrf_cloud_msg_stream *const stream,
+				 const char *const key, const char *const val)
+{
+	__ASSERT_NO_MSG(stream != NULL);
+
+	if (!val) {
+		err_set(stream, -EINVAL);
+	} else if (item_start(stream, key)) {
+		str_put(stream, val);
+	}
+
+	return stream->err;
+}
+
+int nrf_cloud_msg_stream_num_add(struct nrf_cloud_msg_stream *const stream,
+				 const char *const key, const double val)
+{
+	__ASSERT_NO_MSG(stream != NULL);
+
+	if (!item_start(stream, key)) {
+		return stream->err;
+	}
+
+	if (stream->fmt == NRF_CLOUD_MSG_STREAM_JSON) {
+		json_num_put(stream, val);
+	} else {
+		uint8_t num[9];
+		uint64_t bits;
+
+		memcpy(&bits, &val, sizeof(bits));
+		num[0] = CBOR_FLOAT64;
+		sys_put_be64(bits, &num[1]);
+		put(stream, num, sizeof(num));
+	}
+
+	return stream->err;
+}
+
+int nrf_cloud_msg_stream_int_add(struct nrf_cloud_msg_stream *const stream,
+				 const char *const key, const int64_t val)
+{
+	__ASSERT_NO_MSG(stream != NULL);
+
+	if (!item_start(stream, key)) {
+		return stream->err;
+	}
+
+	if (stream->fmt == NRF_CLOUD_MSG_STREAM_JSON) {
+		json_int_put(stream, val);
+	} else if (val >= 0) {
+		cbor_head_put(stream, CBOR_MAJOR_UINT, (uint64_t)val);
+	} else {
+		/* Negative integers are encoded as -1 - n. */
+		cbor_head_put(stream, CBOR_MAJOR_NINT, (uint64_t)(-(val + 1)));
+	}
+
+	return stream->err;
+}
+
+int nrf_cloud_msg_stream_bool_add(struct nrf_cloud_msg_stream *const stream,
+				  const char *const key, const bool val)
+{
+	__ASSERT_NO_MSG(stream != NULL);
+
+	if (!item_start(stream, key)) {
+		return stream->err;
+	}
+
+	if (stream->fmt == NRF_CLOUD_MSG_STREAM_JSON) {
+		if (val) {
+			put(stream, "true", 4);
+		} else {
+			put(stream, "false", 5);
+		}
+	} else {
+		char_put(stream, val ? CBOR_TRUE : CBOR_FALSE);
+	}
+
+	return stream->err;
+}
+
+int nrf_cloud_msg_stream_msg_start(struct nrf_cloud_msg_stream *const stream,
+				   const char *const key, const char *const app_id,
+				   const char *const msg_type)
+{
+	__ASSERT_NO_MSG(stream != NULL);
+
+	(void)nrf_cloud_msg_stream_obj_start(stream, key);
+	(void)nrf_cloud_msg_stream_str_add(stream, NRF_CLOUD_JSON_APPID_KEY, app_id);
+
+	if (msg_type) {
+		(void)nrf_cloud_msg_stream_str_add(stream, NRF_CLOUD_JSON_MSG_TYPE_KEY, msg_type);
+	}
+
+	return stream->err;
+}
+
+int nrf_cloud_msg_stream_finish(const struct nrf_cloud_msg_stream *const stream,
+				size_t *const len)
+{
+	__ASSERT_NO_MSG(stream != NULL);
+
+	int err = stream->err;
+
+	if (!err && stream->depth) {
+		err = -EINVAL;
+	}
+
+	if (len) {
+		*len = stream->len;
+	}
+
+	if (!err && stream->buf && (stream->fmt == NRF_CLOUD_MSG_STREAM_JSON) &&
+	    (stream->len < stream->size)) {
+		stream->buf[stream->len] = '\0';
+	}
+
+	return err;
+}
+
+struct json_scan {
+	const char *p;
+	const char *end;
+};
+
+static void ws_skip(struct json_scan *const sc)
+{
+	while ((sc->p < sc->end) &&
+	       ((*sc->p == ' ') || (*sc->p == '\t') || (*sc->p == '\n') || (*sc->p == '\r'))) {
+		sc->p++;
+	}
+}
+
+static bool char_take(struct json_scan *const sc, char c)
+{
+	ws_skip(sc);
+
+	if ((sc->p < sc->end) && (*sc->p == c)) {
+		sc->p++;
+		return true;
+	}
+
+	return false;
+}
+
+static bool scalar_end(char c)
+{
+	return (c == '\0') || (c == ',') || (c == '}') || (c == ']') ||
+	       (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r');
+}
+
+/* The scanner must be at the opening quote. */
+static int str_skip(struct json_scan *const sc, const char **str, size_t *str_len)
+{
+	const char *start = ++sc->p;
+
+	while ((sc->p < sc->end) && (*sc->p != '\0')) {
+		if (*sc->p == '\\') {
+			sc->p += 2;
+			continue;
+		}
+
+		if (*sc->p == '"') {
+			*str = start;
+			*str_len = sc->p - start;
+			sc->p++;
+			return 0;
+		}
+
+		sc->p++;
+	}
+
+	return -EBADMSG;
+}
+
+static int value_skip(struct json_scan *const sc)
+{
+	size_t depth = 0;
+	const char *str;
+	size_t str_len;
+	const char *start;
+
+	ws_skip(sc);
+
+	do {
+		if (sc->p >= sc->end) {
+			return -EBADMSG;
+		}
+
+		switch (*sc->p) {
+		case '"':
+			if (str_skip(sc, &str, &str_len)) {
+				return -EBADMSG;
+			}
+			break;
+		case '{':
+		case '[':
+			depth++;
+			sc->p++;
+			break;
+		case '}':
+		case ']':
+			if (!depth) {
+				return -EBADMSG;
+			}
+			depth--;
+			sc->p++;
+			break;
+		case '\0':
+			return -EBADMSG;
+		default:
+			if (depth) {
+				/* Separators and scalars inside a skipped container. */
+				sc->p++;
+				break;
+			}
+
+			start = sc->p;
+			while ((sc->p < sc->end) && !scalar_end(*sc->p)) {
+				sc->p++;
+			}
+			return (sc->p > start) ? 0 : -EBADMSG;
+		}
+	} while (depth);
+
+	return 0;
+}
+
+/* On success, the scanner is at the value of the key. */
+static int member_find(struct json_scan *const sc, const char *const json, size_t json_len,
+		       const char *const key)
+{
+	const size_t key_len = strlen(key);
+	const char *name;
+	size_t name_len;
+
+	sc->p = json;
+	sc->end = json + json_len;
+
+	if (!char_take(sc, '{')) {
+		return -EBADMSG;
+	}
+
+	if (char_take(sc, '}')) {
+		return -ENOENT;
+	}
+
+	do {
+		ws_skip(sc);
+		if ((sc->p >= sc->end) || (*sc->p != '"') || str_skip(sc, &name, &name_len) ||
+		    !char_take(sc, ':')) {
+			return -EBADMSG;
+		}
+
+		ws_skip(sc);
+		if ((name_len == key_len) && !memcmp(name, key, key_len)) {
+			return 0;
+		}
+
+		if (value_skip(sc)) {
+			return -EBADMSG;
+		}
+	} while (char_take(sc, ','));
+
+	return char_take(sc, '}') ? -ENOENT : -EBADMSG;
+}
+
+int nrf_cloud_msg_stream_json_str_get(const char *const json, size_t json_len,
+				      const char *const key, const char **val, size_t *val_len)
+{
+	struct json_scan sc;
+	int err;
+
+	if (!json || !key || !val || !val_len) {
+		return -EINVAL;
+	}
+
+	err = member_find(&sc, json, json_len, key);
+	if (err) {
+		return err;
+	}
+
+	if ((sc.p >= sc.end) || (*sc.p != '"')) {
+		return -ENOMSG;
+	}
+
+	return str_skip(&sc, val, val_len);
+}
+
+int nrf_cloud_msg_stream_json_num_get(const char *const json, size_t json_len,
+				      const char *const key, double *val)
+{
+	struct json_scan sc;
+	char num[NUM_STR_SIZE];
+	char *num_end;
+	size_t len = 0;
+	int err;
+
+	if (!json || !key || !val) {
+		return -EINVAL;
+	}
+
+	err = member_find(&sc, json, json_len, key);
+	if (err) {
+		return err;
+	}
+
+	if ((sc.p >= sc.end) || ((*sc.p != '-') && ((*sc.p < '0') || (*sc.p > '9')))) {
+		return -ENOMSG;
+	}
+
+	/* Copy the number, the message is not necessarily NULL-terminated. */
+	while ((sc.p < sc.end) && !scalar_end(*sc.p)) {
+		if (len >= (sizeof(num) - 1)) {
+			return -EBADMSG;
+		}
+		num[len++] = *sc.p++;
+	}
+	num[len] = '\0';
+
+	*val = strtod(num, &num_end);
+
+	return (num_end == &num[len]) ? 0 : -EBADMSG;
+}
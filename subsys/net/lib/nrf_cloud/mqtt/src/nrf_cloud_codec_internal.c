@@ -11,6 +11,7 @@
 #include "nrf_cloud_mqtt_internal.h"
 #include <zephyr/logging/log.h>
 #include "nrf_cloud_mem.h"
+#include "nrf_cloud_msg_stream.h"
 
 LOG_MODULE_REGISTER(nrf_cloud_codec_internal_mqtt, CONFIG_NRF_CLOUD_LOG_LEVEL);
 
@@ -48,11 +49,29 @@ static int json_decode_and_alloc(cJSON *obj, struct mqtt_utf8 *const ep)
 	return 0;
 }
 
+static void sensor_data_stream(struct nrf_cloud_msg_stream *const s,
+			       const struct nrf_cloud_sensor_data *const sensor,
+			       const char *const sensor_type_str)
+{
+	(void)nrf_cloud_msg_stream_obj_start(s, NULL);
+	(void)nrf_cloud_msg_stream_str_add(s, NRF_CLOUD_JSON_APPID_KEY, sensor_type_str);
+	(void)nrf_cloud_msg_stream_str_add(s, NRF_CLOUD_JSON_DATA_KEY, sensor->data.ptr);
+	(void)nrf_cloud_msg_stream_str_add(s, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+					   NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	if (sensor->ts_ms != NRF_CLOUD_NO_TIMESTAMP) {
+		(void)nrf_cloud_msg_stream_int_add(s, NRF_CLOUD_MSG_TIMESTAMP_KEY, sensor->ts_ms);
+	}
+	(void)nrf_cloud_msg_stream_obj_end(s);
+}
+
 int nrf_cloud_sensor_data_encode(const struct nrf_cloud_sensor_data *sensor,
 				 struct nrf_cloud_data *output)
 {
 	int ret;
 	const char *sensor_type_str = nrf_cloud_get_sensor_type_str_internal(sensor->type);
+	struct nrf_cloud_msg_stream s;
+	size_t len;
+	char *buffer;
 
 	__ASSERT_NO_MSG(sensor != NULL);
 	__ASSERT_NO_MSG(sensor->data.ptr != NULL);
@@ -60,37 +79,29 @@ int nrf_cloud_sensor_data_encode(const struct nrf_cloud_sensor_data *sensor,
 	__ASSERT_NO_MSG(output != NULL);
 	__ASSERT_NO_MSG(sensor_type_str != NULL);
 
-	cJSON *root_obj = cJSON_CreateObject();
-
-	if (root_obj == NULL) {
-		return -ENOMEM;
-	}
-
-	ret = !cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_JSON_APPID_KEY, sensor_type_str);
-	ret += !cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_JSON_DATA_KEY, sensor->data.ptr);
-	ret += !cJSON_AddStringToObjectCS(root_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY,
-					  NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
-	if (sensor->ts_ms != NRF_CLOUD_NO_TIMESTAMP) {
-		ret += !cJSON_AddNumberToObjectCS(root_obj, NRF_CLOUD_MSG_TIMESTAMP_KEY,
-						  sensor->ts_ms);
+	/* Compute the length first, so the message is encoded with a single allocation. */
+	nrf_cloud_msg_stream_init(&s, NRF_CLOUD_MSG_STREAM_JSON, NULL, 0);
+	sensor_data_stream(&s, sensor, sensor_type_str);
+	ret = nrf_cloud_msg_stream_finish(&s, &len);
+	if (ret) {
+		return ret;
 	}
 
-	if (ret != 0) {
-		cJSON_Delete(root_obj);
+	buffer = nrf_cloud_malloc(len + 1);
+	if (buffer == NULL) {
 		return -ENOMEM;
 	}
 
-	char *buffer;
-
-	buffer = cJSON_PrintUnformatted(root_obj);
-	cJSON_Delete(root_obj);
-
-	if (buffer == NULL) {
-		return -ENOMEM;
+	nrf_cloud_msg_stream_init(&s, NRF_CLOUD_MSG_STREAM_JSON, buffer, len + 1);
+	sensor_data_stream(&s, sensor, sensor_type_str);
+	ret = nrf_cloud_msg_stream_finish(&s, &len);
+	if (ret) {
+		nrf_cloud_free(buffer);
+		return ret;
 	}
 
 	output->ptr = buffer;
-	output->len = strlen(buffer);
+	output->len = len;
 
 	return 0;
 }
@@ -297,6 +297,40 @@ int Z7_FASTCALL LZMA_DECODE_REAL(CLzmaDec *p, SizeT limit, const Byte *bufLimit)
 
 #else
 
+#if defined(CONFIG_NRF_COMPRESS_LZMA_FAST_MATCH_COPY)
+/* Matches shorter than this are copied byte by byte, as a call overhead would dominate. */
+#define kMatchCopyMinLen 8
+
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY) && CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
+#define LZMA_DEC_CHUNKED_EXT_COPY 1
+#define kMatchCopyChunkSize 32
+
+/*
+  Copies a match that neither overlaps itself nor wraps around the dictionary buffer
+  in chunks, to limit the number of dictionary interface calls.
+*/
+static BoolInt LzmaDec_CopyMatchExt(DictHandle *handle, SizeT src, SizeT dest, unsigned len)
+{
+	Byte chunk[kMatchCopyChunkSize];
+
+	while (len != 0) {
+		SizeT cur = (len < sizeof(chunk)) ? len : sizeof(chunk);
+
+		if (LzmaDictionaryRead(handle, src, chunk, cur) != cur ||
+		    LzmaDictionaryWrite(handle, dest, chunk, cur) != cur) {
+			return False;
+		}
+
+		src += cur;
+		dest += cur;
+		len -= (unsigned)cur;
+	}
+
+	return True;
+}
+#endif
+#endif
+
 static int Z7_FASTCALL LZMA_DECODE_REAL(CLzmaDec *p, SizeT limit, const Byte *bufLimit)
 {
 	CLzmaProb *probs = GET_PROBS;
@@ -695,10 +729,25 @@ static int Z7_FASTCALL LZMA_DECODE_REAL(CLzmaDec *p, SizeT limit, const Byte *bu
 					ptrdiff_t src = (ptrdiff_t)pos - (ptrdiff_t)dicPos;
 					const Byte *lim = dest + curLen;
 					dicPos += (SizeT)curLen;
+#if defined(CONFIG_NRF_COMPRESS_LZMA_FAST_MATCH_COPY)
+					if (curLen >= kMatchCopyMinLen &&
+					    (src >= (ptrdiff_t)curLen || -src >= (ptrdiff_t)curLen)) {
+						/* Non-overlapping match, let the libc use word copies */
+						memcpy(dest, dest + src, curLen);
+					} else
+#endif
 					do {
 						*(dest) = (Byte) * (dest + src);
 					} while (++dest != lim);
 				} else {
+#elif defined(LZMA_DEC_CHUNKED_EXT_COPY)
+				if (curLen >= kMatchCopyMinLen && rep0 >= curLen &&
+				    curLen <= dicBufSize - pos) {
+					if (!LzmaDec_CopyMatchExt(p->dicHandle, pos, dicPos, curLen)) {
+						len += kMatchSpecLen_Error_Data;
+					}
+					dicPos += (SizeT)curLen;
+				} else {
 #endif
 					do {
 #ifdef CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY
@@ -725,7 +774,7 @@ static int Z7_FASTCALL LZMA_DECODE_REAL(CLzmaDec *p, SizeT limit, const Byte *bu
 							pos = 0;
 						}
 					} while (--curLen != 0);
-#ifndef CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY
+#if !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY) || defined(LZMA_DEC_CHUNKED_EXT_COPY)
 				}
 #endif
 			}
@@ -147,6 +147,25 @@ typedef struct dict_cache_t {
 
 static dict_cache cache;
 #endif
+
+#if CONFIG_NRF_COMPRESS_DICTIONARY_READ_CACHE_SIZE > 0
+/**
+ * @brief Dictionary Read Cache Structure
+ *
+ * Holds a window of the external dictionary read back for match sources, so that
+ * consecutive single byte reads do not result in an external dictionary API call each.
+ */
+typedef struct dict_read_cache_t {
+	/** Cached dictionary data. */
+	uint8_t data[CONFIG_NRF_COMPRESS_DICTIONARY_READ_CACHE_SIZE];
+	/** Indicates which dictionary element is stored as first element of @a data. */
+	SizeT dict_pos;
+	/** Number of valid bytes in @a data, 0 if the cache is invalidated. */
+	SizeT len;
+} dict_read_cache;
+
+static dict_read_cache read_cache;
+#endif
 #endif
 
 static size_t lzma_output_limit = SIZE_MAX;
@@ -157,6 +176,66 @@ static CLzma2Dec lzma_decoder;
 static CLzmaDec lzma_decoder;
 #endif
 
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+/**
+ * @brief Invalidate the part of the read cache that overlaps the given dictionary range.
+ *
+ * @param pos first dictionary position that was written.
+ * @param len number of bytes written.
+ */
+static void read_cache_invalidate(SizeT pos, SizeT len)
+{
+#if CONFIG_NRF_COMPRESS_DICTIONARY_READ_CACHE_SIZE > 0
+	if (pos < read_cache.dict_pos + read_cache.len && read_cache.dict_pos < pos + len) {
+		read_cache.len = 0;
+	}
+#else
+	ARG_UNUSED(pos);
+	ARG_UNUSED(len);
+#endif
+}
+
+/**
+ * @brief Read data from external dictionary through the read cache.
+ *
+ * @param handle pointer to Lzma dictionary handle struct, for dictionary size reference.
+ * @param pos position of the dictionary to start reading from.
+ * @param data data buffer to read into.
+ * @param len number of bytes to read.
+ *
+ * @retval Number of bytes read from the dictionary.
+ */
+static SizeT ext_dict_read(const DictHandle *handle, SizeT pos, Byte *data, SizeT len)
+{
+#if CONFIG_NRF_COMPRESS_DICTIONARY_READ_CACHE_SIZE > 0
+	if (len > sizeof(read_cache.data)) {
+		return ext_dict->read(pos, data, len);
+	}
+
+	if (pos < read_cache.dict_pos || pos + len > read_cache.dict_pos + read_cache.len) {
+		/* Cache miss, read ahead as much as possible. */
+		SizeT fill_len = MIN(sizeof(read_cache.data), handle->dicBufSize - pos);
+
+		if (fill_len < len || ext_dict->read(pos, read_cache.data, fill_len) != fill_len) {
+			read_cache.len = 0;
+			return ext_dict->read(pos, data, len);
+		}
+
+		read_cache.dict_pos = pos;
+		read_cache.len = fill_len;
+	}
+
+	memcpy(data, read_cache.data + (pos - read_cache.dict_pos), len);
+
+	return len;
+#else
+	ARG_UNUSED(handle);
+
+	return ext_dict->read(pos, data, len);
+#endif
+}
+#endif
+
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
 /**
  * @brief Synchronize dictionary cache with external dictionary.
@@ -179,6 +258,8 @@ static int synchronize_cache(const DictHandle *handle)
 		return -EIO;
 	}
 
+	read_cache_invalidate(cache.dict_pos_begin, dict_write_size);
+
 	cache.write_offset = 0;
 
 	cache.dict_pos_begin = cache.dict_pos_end + 1;
@@ -647,6 +728,9 @@ DictHandle *LzmaDictionaryOpen(SizeT size)
 	cache.dict_pos_end = sizeof(cache.data) - 1;
 	cache.write_offset = 0;
 #endif
+#if CONFIG_NRF_COMPRESS_DICTIONARY_READ_CACHE_SIZE > 0
+	read_cache.len = 0;
+#endif
 
 	return &dict_handle;
 }
@@ -696,6 +780,8 @@ SizeT LzmaDictionaryWrite(DictHandle *handle, SizeT pos, const Byte *data, SizeT
 	}
 	return bytes_written;
 #else
+	read_cache_invalidate(pos, write_len);
+
 	return ext_dict->write(pos, data, write_len);
 #endif
 }
@@ -722,7 +808,7 @@ SizeT LzmaDictionaryRead(DictHandle *handle, SizeT pos, Byte *data, SizeT len)
 
 		if (pos < cache.dict_pos_begin) {
 			/* First part of data is from dictionary... */
-			bytes_read = ext_dict->read(pos, data, cache.dict_pos_begin - pos);
+			bytes_read = ext_dict_read(handle, pos, data, cache.dict_pos_begin - pos);
 			if (bytes_read != cache.dict_pos_begin - pos) {
 				return bytes_read;
 			}
@@ -741,16 +827,16 @@ SizeT LzmaDictionaryRead(DictHandle *handle, SizeT pos, Byte *data, SizeT len)
 
 		if (bytes_read != read_len) {
 			/* Last part of data is from dictionary. */
-			bytes_read += ext_dict->read(pos + bytes_read, data + bytes_read,
-								read_len - bytes_read);
+			bytes_read += ext_dict_read(handle, pos + bytes_read, data + bytes_read,
+						    read_len - bytes_read);
 		}
 	} else {
 		/* Requested data is not cached at all. */
-		bytes_read = ext_dict->read(pos, data, read_len);
+		bytes_read = ext_dict_read(handle, pos, data, read_len);
 	}
 	return bytes_read;
 #else
-	return ext_dict->read(pos, data, read_len);
+	return ext_dict_read(handle, pos, data, read_len);
 #endif
 }
 
@@ -772,6 +858,10 @@ SRes LzmaDictionaryClose(DictHandle *handle)
 	/* Clear the cache. */
 	memset(cache.data, 0, sizeof(cache.data));
 #endif
+#if CONFIG_NRF_COMPRESS_DICTIONARY_READ_CACHE_SIZE > 0
+	memset(read_cache.data, 0, sizeof(read_cache.data));
+	read_cache.len = 0;
+#endif
 
 	if (ext_dict->close() != 0) {
 		rc = SZ_ERROR_FAIL;
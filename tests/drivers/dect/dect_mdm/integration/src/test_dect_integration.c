@@ -3958,10 +3958,17 @@ void test_dect_ft_sckt_packet_rx_tx(void)
 	static const char rx_inject_payload[] = "DECT_rx_from_child";
 	const size_t rx_inject_len = sizeof(rx_inject_payload);
 
+	static struct dect_status_info status_info;
+	uint32_t baseline_tx_sent;
+
 	TEST_ASSERT_NOT_NULL_MESSAGE(test_iface, "DECT test iface should be set");
 
 	int baseline_dlc_tx = mock_nrf_modem_dect_dlc_data_tx_call_count;
 
+	ret = test_dect_status_info_get(test_iface, &status_info);
+	TEST_ASSERT_EQUAL_MESSAGE(0, ret, "Status info request should succeed");
+	baseline_tx_sent = status_info.tx_stats.sent;
+
 	sockfd = zsock_socket(AF_PACKET, SOCK_DGRAM, htons(ETH_P_ALL));
 	TEST_ASSERT_TRUE_MESSAGE(sockfd >= 0, "AF_PACKET SOCK_DGRAM socket should be created");
 
@@ -3996,6 +4003,20 @@ void test_dect_ft_sckt_packet_rx_tx(void)
 	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(tx_payload, mock_last_dlc_data_tx_data, tx_len,
 					 "DLC data TX payload should match sent data");
 
+	/* Verify driver TX statistics: sent and acknowledged by the mock, nothing queued */
+	ret = test_dect_status_info_get(test_iface, &status_info);
+	TEST_ASSERT_EQUAL_MESSAGE(0, ret, "Status info request should succeed");
+	TEST_ASSERT_TRUE_MESSAGE(status_info.tx_stats.sent > baseline_tx_sent,
+				 "TX statistics should count the sent packet");
+	TEST_ASSERT_EQUAL_MESSAGE(0, status_info.tx_stats.queue_depth,
+				  "TX queue should be empty after sending");
+	if (IS_ENABLED(CONFIG_DECT_MDM_NRF_TX_QUEUE)) {
+		TEST_ASSERT_TRUE_MESSAGE(status_info.tx_stats.queued >= status_info.tx_stats.sent,
+					 "Every sent packet should have been queued");
+		TEST_ASSERT_TRUE_MESSAGE(status_info.tx_stats.queue_depth_max > 0,
+					 "TX queue depth maximum should be recorded");
+	}
+
 	/* Set recv timeout before injecting RX */
 	struct timeval tv = {.tv_sec = 0, .tv_usec = 300 * 1000};
 
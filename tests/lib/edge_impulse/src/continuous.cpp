@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <ei_test_params.h>
+#include <ei_wrapper.h>
+#include <ei_run_classifier_mock.h>
+
+#define EI_TEST_SEM_TIMEOUT  K_MSEC(200 + (10 * EI_MOCK_BUSY_WAIT_TIME / 1000))
+#define EI_TEST_SLIDE_CNT    10
+
+/* Value of the next input sample. Subsequent samples are ascending by 1. */
+static float next_input;
+
+/* Number of slices processed by the mock before the ongoing prediction. */
+static size_t first_slice;
+static size_t pred_slice_cnt;
+/* Semaphore is used to wait until ei_wrapper returns prediction results. */
+static K_SEM_DEFINE(test_sem, 0, 1)
+
+
+static void add_input_data(size_t sample_cnt)
+{
+	for (size_t i = 0; i < sample_cnt; i++) {
+		int err = ei_wrapper_add_data(&next_input, 1);
+
+		zassert_ok(err, "Cannot add data");
+		next_input++;
+	}
+}
+
+/* Results are provided by the last slice. Timings are summed up over the processed slices. */
+static void verify_result(size_t first_idx, size_t end_idx)
+{
+	int err;
+	const char *label;
+	float value;
+	size_t idx;
+	float anomaly;
+	int dsp_time;
+	int classification_time;
+	int anomaly_time;
+	int exp_dsp_time = 0;
+	int exp_classification_time = 0;
+	int exp_anomaly_time = 0;
+	size_t last_idx = end_idx - 1;
+
+	err = ei_wrapper_get_next_classification_result(&label, &value, &idx);
+	zassert_ok(err, "ei_wrapper_get_next_classification_result returned an error");
+	zassert_false(strcmp(label, EI_MOCK_GEN_LABEL(last_idx)), "Wrong label");
+	zassert_within(value, EI_MOCK_GEN_VALUE(last_idx), FLOAT_CMP_EPSILON, "Wrong value");
+
+	err = ei_wrapper_get_anomaly(&anomaly);
+	zassert_ok(err, "ei_wrapper_get_anomaly returned an error");
+	zassert_within(anomaly, EI_MOCK_GEN_ANOMALY(last_idx), FLOAT_CMP_EPSILON,
+		       "Wrong anomaly value");
+
+	for (size_t i = first_idx; i < end_idx; i++) {
+		exp_dsp_time += EI_MOCK_GEN_DSP_TIME(i);
+		exp_classification_time += EI_MOCK_GEN_CLASSIFICATION_TIME(i);
+		exp_anomaly_time += EI_MOCK_GEN_ANOMALY_TIME(i);
+	}
+
+	err = ei_wrapper_get_timing(&dsp_time, &classification_time, &anomaly_time);
+	zassert_ok(err, "ei_wrapper_get_timing returned an error");
+
+	zassert_equal(dsp_time, exp_dsp_time, "Wrong DSP time");
+	zassert_equal(classification_time, exp_classification_time, "Wrong classification time");
+	zassert_equal(anomaly_time, exp_anomaly_time, "Wrong anomaly time");
+}
+
+static void result_ready_cb(int err)
+{
+	zassert_ok(err, "Callback returned error");
+
+	size_t end_slice = ei_run_classifier_mock_slice_cnt();
+
+	zassert_true(end_slice > first_slice, "No slice was processed");
+	pred_slice_cnt = end_slice - first_slice;
+	verify_result(first_slice, end_slice);
+
+	k_sem_give(&test_sem);
+}
+
+/* Returns the number of reinitializations of the classifier done during the prediction. */
+static size_t run_prediction(size_t window_shift, size_t frame_shift)
+{
+	size_t reinit_cnt = ei_run_classifier_mock_reinit_cnt();
+
+	first_slice = ei_run_classifier_mock_slice_cnt();
+
+	int err = ei_wrapper_start_prediction(window_shift, frame_shift);
+
+	zassert_ok(err, "Cannot start prediction");
+
+	err = k_sem_take(&test_sem, EI_TEST_SEM_TIMEOUT);
+	zassert_ok(err, "Cannot take semaphore");
+
+	return ei_run_classifier_mock_reinit_cnt() - reinit_cnt;
+}
+
+static void verify_full_window(size_t reinit_cnt, float window_first_input)
+{
+	zassert_equal(reinit_cnt, 1, "Classifier was not initialized");
+	zassert_equal(pred_slice_cnt, EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW,
+		      "Whole window was not processed");
+	zassert_within(ei_run_classifier_mock_last_slice_input(),
+		       window_first_input + EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE -
+		       EI_CLASSIFIER_SLICE_SIZE,
+		       FLOAT_CMP_EPSILON, "Wrong last slice");
+}
+
+static void *test_init(void)
+{
+	static bool init_once;
+
+	if (init_once) {
+		return NULL;
+	}
+	init_once = true;
+
+	zassert_equal(ei_wrapper_get_frame_size(), 1, "Wrong frame size");
+	zassert_equal(ei_wrapper_get_window_size(), EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE,
+		      "Wrong window size");
+
+	int err = ei_wrapper_init(result_ready_cb);
+
+	zassert_ok(err, "Initialization failed");
+	return NULL;
+}
+
+ZTEST(suite_continuous, test_full_window)
+{
+	add_input_data(EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE);
+
+	size_t reinit_cnt = run_prediction(0, 0);
+
+	verify_full_window(reinit_cnt, 0);
+}
+
+ZTEST(suite_continuous, test_slide_by_slice)
+{
+	add_input_data(EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE);
+	(void)run_prediction(0, 0);
+
+	for (size_t i = 0; i < EI_TEST_SLIDE_CNT; i++) {
+		add_input_data(EI_CLASSIFIER_SLICE_SIZE);
+
+		size_t reinit_cnt = run_prediction(0, EI_CLASSIFIER_SLICE_SIZE);
+
+		/* Only the slice that was added to the window is processed. */
+		zassert_equal(reinit_cnt, 0, "Cached features were dropped");
+		zassert_equal(pred_slice_cnt, 1, "Wrong number of processed slices");
+		zassert_within(ei_run_classifier_mock_last_slice_input(),
+			       EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE + i * EI_CLASSIFIER_SLICE_SIZE,
+			       FLOAT_CMP_EPSILON, "Wrong slice");
+	}
+}
+
+ZTEST(suite_continuous, test_slide_by_slices)
+{
+	add_input_data(EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE);
+	(void)run_prediction(0, 0);
+
+	add_input_data(2 * EI_CLASSIFIER_SLICE_SIZE);
+
+	size_t reinit_cnt = run_prediction(0, 2 * EI_CLASSIFIER_SLICE_SIZE);
+
+	zassert_equal(reinit_cnt, 0, "Cached features were dropped");
+	zassert_equal(pred_slice_cnt, 2, "Wrong number of processed slices");
+}
+
+ZTEST(suite_continuous, test_slide_by_window)
+{
+	add_input_data(2 * EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE);
+	(void)run_prediction(0, 0);
+
+	size_t reinit_cnt = run_prediction(1, 0);
+
+	verify_full_window(reinit_cnt, EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE);
+}
+
+ZTEST(suite_continuous, test_no_slide)
+{
+	add_input_data(EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE);
+	(void)run_prediction(0, 0);
+
+	/* Window that was already processed is processed again from scratch. */
+	size_t reinit_cnt = run_prediction(0, 0);
+
+	verify_full_window(reinit_cnt, 0);
+}
+
+ZTEST(suite_continuous, test_clear_data)
+{
+	bool cancelled;
+
+	add_input_data(EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE);
+	(void)run_prediction(0, 0);
+
+	int err = ei_wrapper_clear_data(&cancelled);
+
+	zassert_ok(err, "Cannot clear data");
+	zassert_false(cancelled, "Prediction was cancelled");
+
+	float window_first_input = next_input;
+
+	add_input_data(EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE);
+
+	size_t reinit_cnt = run_prediction(0, 0);
+
+	verify_full_window(reinit_cnt, window_first_input);
+}
+
+ZTEST(suite_continuous, test_unaligned_shift)
+{
+	int err = ei_wrapper_start_prediction(0, EI_CLASSIFIER_SLICE_SIZE - 1);
+
+	zassert_equal(err, -EINVAL, "Shift not aligned to the slice was accepted");
+
+	err = ei_wrapper_start_prediction(0, EI_CLASSIFIER_SLICE_SIZE + 1);
+	zassert_equal(err, -EINVAL, "Shift not aligned to the slice was accepted");
+}
+
+static void setup_fn(void *unused)
+{
+	ARG_UNUSED(unused);
+
+	bool cancelled;
+	int err = ei_wrapper_clear_data(&cancelled);
+
+	next_input = 0;
+	ei_run_classifier_mock_init();
+
+	zassert_false(cancelled, "Prediction was not cancelled");
+	zassert_ok(err, "Cannot clear data");
+	err = k_sem_take(&test_sem, K_MSEC(20));
+	zassert_true(err, "Unhandled prediction result");
+}
+
+ZTEST_SUITE(suite_continuous, NULL, test_init, setup_fn, NULL, NULL);
@@ -9,9 +9,33 @@
 
 static size_t prediction_idx;
 
+/* State of the continuous mode. */
+static size_t slice_cnt;
+static size_t reinit_cnt;
+static bool slice_cached;
+static float last_slice_input;
+
 void ei_run_classifier_mock_init(void)
 {
 	prediction_idx = 0;
+	slice_cnt = 0;
+	reinit_cnt = 0;
+	slice_cached = false;
+}
+
+size_t ei_run_classifier_mock_slice_cnt(void)
+{
+	return slice_cnt;
+}
+
+size_t ei_run_classifier_mock_reinit_cnt(void)
+{
+	return reinit_cnt;
+}
+
+float ei_run_classifier_mock_last_slice_input(void)
+{
+	return last_slice_input;
 }
 
 /* Input data must be ascending sequence of floats. Difference between
@@ -46,33 +70,20 @@ static void verify_data_read(signal_t *signal, const size_t prediction_idx,
 	}
 }
 
-EI_IMPULSE_ERROR run_classifier(signal_t *signal,
-				ei_impulse_result_t *result,
-				bool debug)
+/* Results of the given call index. */
+static void result_fill(ei_impulse_result_t *result, const size_t idx)
 {
-	ARG_UNUSED(debug);
-
-	/* Test getting data. */
-	verify_data_read(signal, prediction_idx, 1);
-	verify_data_read(signal, prediction_idx,
-			 EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME);
-	verify_data_read(signal, prediction_idx,
-			 EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE);
-
-	/* Busy wait for predefined amount of time to simulate calculations. */
-	k_busy_wait(EI_MOCK_BUSY_WAIT_TIME);
-
 	/* Timing results. */
-	result->timing.dsp = EI_MOCK_GEN_DSP_TIME(prediction_idx);
-	result->timing.classification = EI_MOCK_GEN_CLASSIFICATION_TIME(prediction_idx);
-	result->timing.anomaly = EI_MOCK_GEN_ANOMALY_TIME(prediction_idx);
+	result->timing.dsp = EI_MOCK_GEN_DSP_TIME(idx);
+	result->timing.classification = EI_MOCK_GEN_CLASSIFICATION_TIME(idx);
+	result->timing.anomaly = EI_MOCK_GEN_ANOMALY_TIME(idx);
 
 	/* Classification results. */
-	result->anomaly = EI_MOCK_GEN_ANOMALY(prediction_idx);
+	result->anomaly = EI_MOCK_GEN_ANOMALY(idx);
 
-	size_t res_idx = EI_MOCK_GEN_LABEL_IDX(prediction_idx);
-	const float value_selected = EI_MOCK_GEN_VALUE(prediction_idx);
-	const float value_others = EI_MOCK_GEN_VALUE_OTHERS(prediction_idx);
+	size_t res_idx = EI_MOCK_GEN_LABEL_IDX(idx);
+	const float value_selected = EI_MOCK_GEN_VALUE(idx);
+	const float value_others = EI_MOCK_GEN_VALUE_OTHERS(idx);
 
 	zassert_true(value_selected < 1.0, "Wrong value of selected label.");
 	zassert_true(value_selected > value_others, "Wrong values");
@@ -83,9 +94,76 @@ EI_IMPULSE_ERROR run_classifier(signal_t *signal,
 			(i == res_idx) ? (value_selected) : (value_others);
 	}
 
-	zassert_false(strcmp(EI_MOCK_GEN_LABEL(prediction_idx),
+	zassert_false(strcmp(EI_MOCK_GEN_LABEL(idx),
 		      ei_classifier_inferencing_categories[res_idx]),
 		      "Wrong label");
+}
+
+void run_classifier_init(void)
+{
+	slice_cached = false;
+	reinit_cnt++;
+}
+
+/* In the continuous mode, the input data must be an ascending sequence of floats with
+ * a difference of 1 between subsequent elements. The first element of a slice must follow
+ * the last element of the previous slice, unless the classifier was initialized in between.
+ */
+EI_IMPULSE_ERROR run_classifier_continuous(signal_t *signal,
+					   ei_impulse_result_t *result,
+					   bool debug,
+					   bool enable_maf)
+{
+	ARG_UNUSED(debug);
+	ARG_UNUSED(enable_maf);
+
+	static float data_buf[EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE];
+
+	zassert_true(signal->total_length <= ARRAY_SIZE(data_buf), "Slice too long");
+
+	int err = signal->get_data(0, signal->total_length, data_buf);
+
+	zassert_ok(err, "get_data returned an error");
+
+	for (size_t off = 1; off < signal->total_length; off++) {
+		zassert_within(data_buf[off], data_buf[0] + off, FLOAT_CMP_EPSILON,
+			       "Input data error");
+	}
+
+	if (slice_cached) {
+		zassert_within(data_buf[0], last_slice_input + signal->total_length,
+			       FLOAT_CMP_EPSILON, "Slices are not consecutive");
+	}
+
+	/* Busy wait for predefined amount of time to simulate calculations. */
+	k_busy_wait(EI_MOCK_BUSY_WAIT_TIME);
+
+	result_fill(result, slice_cnt);
+
+	last_slice_input = data_buf[0];
+	slice_cached = true;
+	slice_cnt++;
+
+	return EI_IMPULSE_OK;
+}
+
+EI_IMPULSE_ERROR run_classifier(signal_t *signal,
+				ei_impulse_result_t *result,
+				bool debug)
+{
+	ARG_UNUSED(debug);
+
+	/* Test getting data. */
+	verify_data_read(signal, prediction_idx, 1);
+	verify_data_read(signal, prediction_idx,
+			 EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME);
+	verify_data_read(signal, prediction_idx,
+			 EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE);
+
+	/* Busy wait for predefined amount of time to simulate calculations. */
+	k_busy_wait(EI_MOCK_BUSY_WAIT_TIME);
+
+	result_fill(result, prediction_idx);
 
 	prediction_idx++;
 
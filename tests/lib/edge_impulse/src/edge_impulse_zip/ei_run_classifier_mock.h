@@ -7,6 +7,17 @@
 #ifndef _EI_RUN_CLASSIFIER_MOCK_H_
 #define _EI_RUN_CLASSIFIER_MOCK_H_
 
+#include <stddef.h>
+
 void ei_run_classifier_mock_init(void);
 
+/* Number of slices processed in the continuous mode since the mock initialization. */
+size_t ei_run_classifier_mock_slice_cnt(void);
+
+/* Number of continuous mode classifier initializations since the mock initialization. */
+size_t ei_run_classifier_mock_reinit_cnt(void);
+
+/* First input value of the last slice processed in the continuous mode. */
+float ei_run_classifier_mock_last_slice_input(void);
+
 #endif /* _EI_RUN_CLASSIFIER_MOCK_H_ */
@@ -14,8 +14,16 @@
 #define FLOAT_CMP_EPSILON			0.000001f
 
 /* Definitions provided by the EI library. */
-#define EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME	15
 #define EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE	300
+#if CONFIG_EI_WRAPPER_CONTINUOUS
+/* Continuous classification is supported only for single-axis impulses. */
+#define EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME	1
+#define EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW	4
+#define EI_CLASSIFIER_SLICE_SIZE		\
+	(EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE / EI_CLASSIFIER_SLICES_PER_MODEL_WINDOW)
+#else
+#define EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME	15
+#endif
 #define EI_CLASSIFIER_HAS_ANOMALY		1
 #define EI_CLASSIFIER_FREQUENCY			60
 
@@ -1425,6 +1425,99 @@ void test_location_wifi_timeout(void)
 #endif
 }
 
+/* Test Wi-Fi location request using the external cloud service. The cloud location request
+ * and the resulting location are reported with the Wi-Fi method.
+ */
+void test_location_wifi_cloud_location_ext_request(void)
+{
+#if defined(CONFIG_LOCATION_METHOD_WIFI) && defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
+	int err;
+	struct location_config config = { 0 };
+	enum location_method methods[] = {LOCATION_METHOD_WIFI};
+
+	location_config_defaults_set(&config, 1, methods);
+
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_STARTED;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_WIFI;
+	location_cb_expected++;
+#endif
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_CLOUD_LOCATION_EXT_REQUEST;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_WIFI;
+	location_cb_expected++;
+
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_LOCATION;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_WIFI;
+	test_location_event_data[location_cb_expected].location.latitude = 51.98765;
+	test_location_event_data[location_cb_expected].location.longitude = 13.12345;
+	test_location_event_data[location_cb_expected].location.accuracy = 50.0;
+	test_location_event_data[location_cb_expected].location.datetime.valid = false;
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	test_location_event_data[location_cb_expected].location.details.wifi.ap_count = 2;
+#endif
+	location_cb_expected++;
+
+	net_mgmt_NET_REQUEST_WIFI_SCAN_expected = true;
+
+	__cmock_net_mgmt_NET_REQUEST_WIFI_SCAN_ExpectAndReturn(0);
+
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(0, err);
+	k_sleep(K_MSEC(1));
+
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	/* Wait for LOCATION_EVT_STARTED */
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+#endif
+	struct net_mgmt_event_callback cb;
+	const struct wifi_status status = {
+		.status = WIFI_STATUS_CONN_SUCCESS
+	};
+	const struct wifi_scan_result scan_result1 = {
+		.ssid = "TestAP1",
+		.ssid_length = 7,
+		.channel = 36,
+		.mac = {0x12, 0x34, 0x56, 0x78, 0x90, 0xAB},
+		.mac_length = 6
+	};
+	const struct wifi_scan_result scan_result2 = {
+		.ssid = "TestAP2",
+		.ssid_length = 7,
+		.channel = 36,
+		.mac = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66},
+		.mac_length = 6
+	};
+
+	/* Send Wi-Fi scan response which further triggers the cloud location request */
+	cb.info = &scan_result1;
+	scan_wifi_net_mgmt_event_handler(&cb, NET_EVENT_WIFI_SCAN_RESULT, NULL);
+	k_sleep(K_MSEC(1));
+
+	cb.info = &scan_result2;
+	scan_wifi_net_mgmt_event_handler(&cb, NET_EVENT_WIFI_SCAN_RESULT, NULL);
+	k_sleep(K_MSEC(1));
+
+	cb.info = &status;
+	scan_wifi_net_mgmt_event_handler(&cb, NET_EVENT_WIFI_SCAN_DONE, NULL);
+	k_sleep(K_MSEC(1));
+
+	/* Wait for LOCATION_EVT_CLOUD_LOCATION_EXT_REQUEST */
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+
+	struct location_data location_data = {
+		.latitude = 51.98765,
+		.longitude = 13.12345,
+		.accuracy = 50.0,
+		.datetime.valid = false
+	};
+
+	location_cloud_location_ext_result_set(LOCATION_EXT_RESULT_SUCCESS, &location_data);
+	k_sleep(K_MSEC(1));
+#endif
+}
+
 /********* GENERAL ERROR TESTS ***********************/
 
 /* Test location request with unknown method. */
@@ -1958,6 +2051,362 @@ void test_location_request_mode_all_cellular_gnss(void)
 #endif
 }
 
+/* Sets the expectations for starting GNSS and cellular positioning at the same time
+ * in LOCATION_REQ_MODE_CONCURRENT.
+ */
+static void concurrent_gnss_cellular_start_expect(void)
+{
+	__cmock_nrf_modem_gnss_event_handler_set_ExpectAndReturn(&method_gnss_event_handler, 0);
+
+#if defined(CONFIG_LOCATION_TEST_AGNSS)
+	/* Static because the mock reads the returned data when it is called */
+	static struct nrf_modem_gnss_agnss_expiry agnss_expiry = {
+		.data_flags = 0,
+		.utc_expiry = 0xffff,
+		.klob_expiry = 0xffff,
+		.neq_expiry = 0xffff,
+		.integrity_expiry = 0xffff,
+		.position_expiry = 0xffff };
+
+	__cmock_nrf_modem_gnss_agnss_expiry_get_ExpectAndReturn(NULL, 0);
+	__cmock_nrf_modem_gnss_agnss_expiry_get_IgnoreArg_agnss_expiry();
+	__cmock_nrf_modem_gnss_agnss_expiry_get_ReturnMemThruPtr_agnss_expiry(
+		&agnss_expiry, sizeof(agnss_expiry));
+#endif
+	__cmock_nrf_modem_gnss_fix_interval_set_ExpectAndReturn(1, 0);
+	__cmock_nrf_modem_gnss_use_case_set_ExpectAndReturn(
+		NRF_MODEM_GNSS_USE_CASE_MULTIPLE_HOT_START, 0);
+	__cmock_nrf_modem_gnss_start_ExpectAndReturn(0);
+
+	__mock_nrf_modem_at_scanf_ExpectAndReturn(
+		"AT%XSYSTEMMODE?", "%%XSYSTEMMODE: %d,%d,%d,%d,%d", 4);
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* LTE-M support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* NB-IoT support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(1); /* GNSS support */
+	__mock_nrf_modem_at_scanf_ReturnVarg_int(0); /* LTE preference */
+
+#if !defined(CONFIG_LOCATION_TEST_AGNSS)
+	__cmock_nrf_modem_at_cmd_ExpectAndReturn(NULL, 0, "AT%%XMONITOR", 0);
+	__cmock_nrf_modem_at_cmd_IgnoreArg_buf();
+	__cmock_nrf_modem_at_cmd_IgnoreArg_len();
+	__cmock_nrf_modem_at_cmd_ReturnArrayThruPtr_buf(
+		(char *)xmonitor_resp, sizeof(xmonitor_resp));
+#endif
+
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT%NCELLMEAS=1", 0);
+}
+
+/* Test location request with:
+ * - LOCATION_REQ_MODE_CONCURRENT for GNSS and cellular positioning
+ * - cellular location does not meet the accuracy target so GNSS location is returned
+ */
+void test_location_request_mode_concurrent_gnss_cellular(void)
+{
+	int err;
+
+	struct location_config config = { 0 };
+	enum location_method methods[] = {LOCATION_METHOD_GNSS, LOCATION_METHOD_CELLULAR};
+
+	location_config_defaults_set(&config, 2, methods);
+	config.mode = LOCATION_REQ_MODE_CONCURRENT;
+	config.accuracy_target = 100;
+	config.methods[0].gnss.timeout = SYS_FOREVER_MS;
+	config.methods[1].cellular.cell_count = 1;
+
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_STARTED;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_GNSS;
+	location_cb_expected++;
+
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_STARTED;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_CELLULAR;
+	location_cb_expected++;
+#endif
+
+#if defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_CLOUD_LOCATION_EXT_REQUEST;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_CELLULAR;
+	location_cb_expected++;
+#else
+	/* Cellular location is not given to the application but it is stored temporarily
+	 * into the expected event data to generate the cloud response
+	 */
+	test_location_event_data[location_cb_expected].location.latitude = 61.50375;
+	test_location_event_data[location_cb_expected].location.longitude = 23.896979;
+	test_location_event_data[location_cb_expected].location.accuracy = 750.0;
+	cellular_rest_req_resp_handle(location_cb_expected);
+#endif
+
+	test_pvt_data.flags = NRF_MODEM_GNSS_PVT_FLAG_FIX_VALID;
+	test_pvt_data.latitude = 60.987;
+	test_pvt_data.longitude = -45.997;
+	test_pvt_data.accuracy = 15.83;
+	test_pvt_data.datetime.year = 2021;
+	test_pvt_data.datetime.month = 8;
+	test_pvt_data.datetime.day = 2;
+	test_pvt_data.datetime.hour = 12;
+	test_pvt_data.datetime.minute = 34;
+	test_pvt_data.datetime.seconds = 23;
+	test_pvt_data.datetime.ms = 789;
+	test_pvt_data.sv[0].sv = 2;
+	test_pvt_data.sv[0].flags = NRF_MODEM_GNSS_SV_FLAG_USED_IN_FIX;
+	test_pvt_data.sv[1].sv = 4;
+	test_pvt_data.sv[1].flags = NRF_MODEM_GNSS_SV_FLAG_USED_IN_FIX;
+	test_pvt_data.sv[2].sv = 6;
+	test_pvt_data.sv[2].flags = 0;
+	test_pvt_data.sv[3].sv = 8;
+	test_pvt_data.sv[3].flags = NRF_MODEM_GNSS_SV_FLAG_USED_IN_FIX;
+	test_pvt_data.sv[4].sv = 10;
+	test_pvt_data.sv[4].flags = NRF_MODEM_GNSS_SV_FLAG_USED_IN_FIX;
+	test_pvt_data.sv[5].sv = 12;
+	test_pvt_data.sv[5].flags = 0;
+
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_LOCATION;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_GNSS;
+	test_location_event_data[location_cb_expected].location.latitude = 60.987;
+	test_location_event_data[location_cb_expected].location.longitude = -45.997;
+	test_location_event_data[location_cb_expected].location.accuracy = 15.83;
+	test_location_event_data[location_cb_expected].location.datetime.valid = true;
+	test_location_event_data[location_cb_expected].location.datetime.year = 2021;
+	test_location_event_data[location_cb_expected].location.datetime.month = 8;
+	test_location_event_data[location_cb_expected].location.datetime.day = 2;
+	test_location_event_data[location_cb_expected].location.datetime.hour = 12;
+	test_location_event_data[location_cb_expected].location.datetime.minute = 34;
+	test_location_event_data[location_cb_expected].location.datetime.second = 23;
+	test_location_event_data[location_cb_expected].location.datetime.ms = 789;
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	test_location_event_data[location_cb_expected].location.details.gnss.satellites_tracked = 6;
+	test_location_event_data[location_cb_expected].location.details.gnss.satellites_used = 4;
+	test_location_event_data[location_cb_expected].location.details.gnss.pvt_data =
+		test_pvt_data;
+#endif
+	location_cb_expected++;
+
+	/***** GNSS and cellular positioning are started at the same time *****/
+	concurrent_gnss_cellular_start_expect();
+
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(0, err);
+
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	/* Wait for LOCATION_EVT_STARTED for both methods */
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+#endif
+
+	/* GNSS is started while neighbor cell measurement is ongoing */
+	at_monitor_dispatch("+CSCON: 0");
+	k_sleep(K_MSEC(1));
+
+#if !defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
+	__cmock_nrf_modem_at_cmd_ExpectAndReturn(NULL, 0, "AT+CGACT?", 0);
+	__cmock_nrf_modem_at_cmd_IgnoreArg_buf();
+	__cmock_nrf_modem_at_cmd_IgnoreArg_len();
+	__cmock_nrf_modem_at_cmd_ReturnArrayThruPtr_buf(
+		(char *)cgact_resp_active, sizeof(cgact_resp_active));
+#endif
+
+	/* Trigger NCELLMEAS response which further triggers the cloud location request */
+	at_monitor_dispatch(ncellmeas_resp_pci1);
+	k_sleep(K_MSEC(1));
+
+#if defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+
+	struct location_data location_data = {
+		.latitude = 61.50375,
+		.longitude = 23.896979,
+		.accuracy = 750.0,
+		.datetime.valid = false
+	};
+
+	location_cloud_location_ext_result_set(LOCATION_EXT_RESULT_SUCCESS, &location_data);
+	k_sleep(K_MSEC(1));
+#endif
+
+	/* Cellular location does not meet the accuracy target so GNSS is still running */
+	TEST_ASSERT_EQUAL(location_cb_expected - 1, location_cb_occurred);
+
+	__cmock_nrf_modem_gnss_read_ExpectAndReturn(
+		NULL, sizeof(test_pvt_data), NRF_MODEM_GNSS_DATA_PVT, 0);
+	__cmock_nrf_modem_gnss_read_IgnoreArg_buf();
+	__cmock_nrf_modem_gnss_read_ReturnMemThruPtr_buf(&test_pvt_data, sizeof(test_pvt_data));
+	__cmock_nrf_modem_gnss_stop_ExpectAndReturn(0);
+	method_gnss_event_handler(NRF_MODEM_GNSS_EVT_PVT);
+	k_sleep(K_MSEC(1));
+}
+
+/* Sets the expected cellular location and drives the cellular positioning of a request
+ * in LOCATION_REQ_MODE_CONCURRENT until the cloud location has been given to the library.
+ */
+static void concurrent_cellular_location_expect_and_run(void)
+{
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_LOCATION;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_CELLULAR;
+	test_location_event_data[location_cb_expected].location.latitude = 61.50375;
+	test_location_event_data[location_cb_expected].location.longitude = 23.896979;
+	test_location_event_data[location_cb_expected].location.accuracy = 750.0;
+	test_location_event_data[location_cb_expected].location.datetime.valid = false;
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	test_location_event_data[location_cb_expected].location.details.cellular.ncells_count = 1;
+	test_location_event_data[location_cb_expected].location.details.cellular.gci_cells_count =
+		0;
+#endif
+	location_cb_expected++;
+
+#if !defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
+	cellular_rest_req_resp_handle(location_cb_expected - 1);
+#endif
+
+	/* GNSS is started while neighbor cell measurement is ongoing */
+	at_monitor_dispatch("+CSCON: 0");
+	k_sleep(K_MSEC(1));
+
+#if !defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
+	__cmock_nrf_modem_at_cmd_ExpectAndReturn(NULL, 0, "AT+CGACT?", 0);
+	__cmock_nrf_modem_at_cmd_IgnoreArg_buf();
+	__cmock_nrf_modem_at_cmd_IgnoreArg_len();
+	__cmock_nrf_modem_at_cmd_ReturnArrayThruPtr_buf(
+		(char *)cgact_resp_active, sizeof(cgact_resp_active));
+#endif
+
+	/* Trigger NCELLMEAS response which further triggers the cloud location request */
+	at_monitor_dispatch(ncellmeas_resp_pci1);
+	k_sleep(K_MSEC(1));
+
+#if defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
+	/* Wait for LOCATION_EVT_CLOUD_LOCATION_EXT_REQUEST */
+	int err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+
+	TEST_ASSERT_EQUAL(0, err);
+
+	struct location_data location_data = {
+		.latitude = 61.50375,
+		.longitude = 23.896979,
+		.accuracy = 750.0,
+		.datetime.valid = false
+	};
+
+	location_cloud_location_ext_result_set(LOCATION_EXT_RESULT_SUCCESS, &location_data);
+	k_sleep(K_MSEC(1));
+#endif
+}
+
+/* Test location request with:
+ * - LOCATION_REQ_MODE_CONCURRENT for GNSS and cellular positioning
+ * - cellular location meets the accuracy target so it is returned and GNSS is cancelled
+ */
+void test_location_request_mode_concurrent_cellular_accuracy_target_met(void)
+{
+	int err;
+
+	struct location_config config = { 0 };
+	enum location_method methods[] = {LOCATION_METHOD_GNSS, LOCATION_METHOD_CELLULAR};
+
+	location_config_defaults_set(&config, 2, methods);
+	config.mode = LOCATION_REQ_MODE_CONCURRENT;
+	config.accuracy_target = 1000;
+	config.methods[0].gnss.timeout = SYS_FOREVER_MS;
+	config.methods[1].cellular.cell_count = 1;
+
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_STARTED;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_GNSS;
+	location_cb_expected++;
+
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_STARTED;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_CELLULAR;
+	location_cb_expected++;
+#endif
+
+#if defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_CLOUD_LOCATION_EXT_REQUEST;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_CELLULAR;
+	location_cb_expected++;
+#endif
+
+	concurrent_gnss_cellular_start_expect();
+
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(0, err);
+
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	/* Wait for LOCATION_EVT_STARTED for both methods */
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+#endif
+
+	/* GNSS is cancelled when the cellular location meets the accuracy target */
+	__cmock_nrf_modem_gnss_stop_ExpectAndReturn(0);
+
+	concurrent_cellular_location_expect_and_run();
+}
+
+/* Test location request with:
+ * - LOCATION_REQ_MODE_CONCURRENT for GNSS and cellular positioning
+ * - cellular location does not meet the accuracy target and GNSS does not get a fix
+ * - location request timeout stops GNSS and returns the cellular location as the best one
+ */
+void test_location_request_mode_concurrent_timeout_best_location(void)
+{
+	int err;
+
+	struct location_config config = { 0 };
+	enum location_method methods[] = {LOCATION_METHOD_GNSS, LOCATION_METHOD_CELLULAR};
+
+	location_config_defaults_set(&config, 2, methods);
+	config.mode = LOCATION_REQ_MODE_CONCURRENT;
+	config.accuracy_target = 100;
+	config.timeout = 500;
+	config.methods[0].gnss.timeout = SYS_FOREVER_MS;
+	config.methods[1].cellular.cell_count = 1;
+
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_STARTED;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_GNSS;
+	location_cb_expected++;
+
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_STARTED;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_CELLULAR;
+	location_cb_expected++;
+#endif
+
+#if defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
+	test_location_event_data[location_cb_expected].id = LOCATION_EVT_CLOUD_LOCATION_EXT_REQUEST;
+	test_location_event_data[location_cb_expected].method = LOCATION_METHOD_CELLULAR;
+	location_cb_expected++;
+#endif
+
+	concurrent_gnss_cellular_start_expect();
+
+	err = location_request(&config);
+	TEST_ASSERT_EQUAL(0, err);
+
+#if defined(CONFIG_LOCATION_DATA_DETAILS)
+	/* Wait for LOCATION_EVT_STARTED for both methods */
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+	err = k_sem_take(&event_handler_called_sem, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(0, err);
+#endif
+
+	concurrent_cellular_location_expect_and_run();
+
+	/* Cellular location does not meet the accuracy target so GNSS is still running */
+	TEST_ASSERT_EQUAL(location_cb_expected - 1, location_cb_occurred);
+
+	/* GNSS is stopped when the location request times out */
+	__cmock_nrf_modem_gnss_stop_ExpectAndReturn(0);
+
+	/* Wait for the location request timeout */
+	k_sleep(K_MSEC(600));
+}
+
 /* Test location request error/timeout with :
  * - Use cellular and GNSS positioning and error and timeout occurs, respectively
  * - Use LOCATION_REQ_MODE_ALL so we can check timeout event ID for both methods
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(location, CONFIG_LOCATION_LOG_LEVEL);
+
+#include "cloud_cache.c"
+
+#define NCELL_CNT 6
+#define AP_CNT 12
+
+static struct lte_lc_ncell ncells[NCELL_CNT];
+static struct lte_lc_cells_info cell_data;
+static struct wifi_scan_result aps[AP_CNT];
+static struct wifi_scan_info wifi_data;
+
+static const struct location_data test_location = {
+	.latitude = 61.50375,
+	.longitude = 23.896979,
+	.accuracy = 750.0,
+};
+
+static void cell_data_create(uint32_t serving_cell_id, uint8_t ncells_count)
+{
+	memset(&cell_data, 0, sizeof(cell_data));
+	cell_data.current_cell.mcc = 244;
+	cell_data.current_cell.mnc = 91;
+	cell_data.current_cell.tac = 0x0B;
+	cell_data.current_cell.id = serving_cell_id;
+	cell_data.ncells_count = ncells_count;
+	cell_data.neighbor_cells = ncells;
+
+	for (int i = 0; i < ncells_count; i++) {
+		ncells[i].earfcn = 6200;
+		ncells[i].phys_cell_id = 100 + i;
+	}
+}
+
+static void wifi_data_create(uint16_t cnt)
+{
+	memset(aps, 0, sizeof(aps));
+	wifi_data.ap_info = aps;
+	wifi_data.cnt = cnt;
+
+	for (int i = 0; i < cnt; i++) {
+		aps[i].mac_length = WIFI_MAC_ADDR_LEN;
+		aps[i].mac[0] = 0x40;
+		aps[i].mac[5] = i;
+	}
+}
+
+/* Creates a fingerprint with the given items, which must be in ascending order. */
+static void fp_items_set(struct cloud_cache_fingerprint *fp, const uint32_t *items, int count)
+{
+	memset(fp, 0, sizeof(*fp));
+	fp->serving_cell = 1;
+	fp->count = count;
+
+	for (int i = 0; i < count; i++) {
+		fp->items[i] = items[i];
+	}
+}
+
+static void cloud_cache_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_ok(cloud_cache_init());
+}
+
+ZTEST_SUITE(location_cloud_cache, NULL, NULL, cloud_cache_before, NULL, NULL);
+
+ZTEST(location_cloud_cache, test_fp_create)
+{
+	struct cloud_cache_fingerprint fp;
+
+	cell_data_create(0x12345, 4);
+	cloud_cache_fp_create(&cell_data, NULL, &fp);
+
+	zassert_not_equal(0, fp.serving_cell, "Serving cell not set");
+	zassert_false(fp.wifi, "Wi-Fi set without access points");
+	zassert_equal(4, fp.count, "Unexpected number of items: %d", fp.count);
+
+	for (int i = 1; i < fp.count; i++) {
+		zassert_true(fp.items[i - 1] < fp.items[i], "Items not in ascending order");
+	}
+}
+
+ZTEST(location_cloud_cache, test_fp_order_independent)
+{
+	struct cloud_cache_fingerprint fp_a;
+	struct cloud_cache_fingerprint fp_b;
+	struct lte_lc_ncell tmp;
+
+	cell_data_create(0x12345, NCELL_CNT);
+	cloud_cache_fp_create(&cell_data, NULL, &fp_a);
+
+	/* The same neighbor cells reported in another order give the same fingerprint. */
+	tmp = ncells[0];
+	ncells[0] = ncells[NCELL_CNT - 1];
+	ncells[NCELL_CNT - 1] = tmp;
+	cloud_cache_fp_create(&cell_data, NULL, &fp_b);
+
+	zassert_true(cloud_cache_fp_equal(&fp_a, &fp_b), "Fingerprints differ");
+	zassert_equal(100, cloud_cache_fp_similarity(&fp_a, &fp_b));
+}
+
+ZTEST(location_cloud_cache, test_fp_sample)
+{
+	struct cloud_cache_fingerprint fp;
+	struct cloud_cache_fingerprint fp_small;
+
+	/* Only the smallest hashes are kept if there are more access points than fit in. */
+	wifi_data_create(AP_CNT);
+	cloud_cache_fp_create(NULL, &wifi_data, &fp);
+
+	zassert_true(fp.wifi, "Wi-Fi not set");
+	zassert_equal(0, fp.serving_cell, "Serving cell set without cell data");
+	zassert_equal(CLOUD_CACHE_FP_SIZE, fp.count, "Unexpected number of items: %d",
+		      fp.count);
+
+	for (int i = 0; i < AP_CNT; i++) {
+		uint32_t hash = cloud_cache_hash(CLOUD_CACHE_ITEM_AP, aps[i].mac,
+						 WIFI_MAC_ADDR_LEN);
+		bool found = false;
+
+		for (int j = 0; j < fp.count; j++) {
+			found = found || (fp.items[j] == hash);
+		}
+
+		zassert_true(found || (hash > fp.items[fp.count - 1]),
+			     "Access point %d dropped from the sample", i);
+	}
+
+	/* A sample of the same access points matches. */
+	wifi_data_create(AP_CNT - 1);
+	cloud_cache_fp_create(NULL, &wifi_data, &fp_small);
+	zassert_true(cloud_cache_fp_similarity(&fp, &fp_small) >=
+		     CONFIG_LOCATION_SERVICE_CLOUD_CACHE_SIMILARITY);
+}
+
+ZTEST(location_cloud_cache, test_fp_local_mac_ignored)
+{
+	struct cloud_cache_fingerprint fp;
+
+	wifi_data_create(2);
+	aps[0].mac[0] |= CLOUD_CACHE_MAC_LOCAL_BIT;
+	aps[1].mac[0] |= CLOUD_CACHE_MAC_LOCAL_BIT;
+	cloud_cache_fp_create(NULL, &wifi_data, &fp);
+
+	zassert_false(fp.wifi, "Wi-Fi set with locally administered addresses only");
+	zassert_equal(0, fp.count, "Locally administered addresses used");
+}
+
+ZTEST(location_cloud_cache, test_similarity)
+{
+	static const uint32_t items_a[] = { 1, 2, 3, 4 };
+	static const uint32_t items_b[] = { 3, 4, 5, 6 };
+	static const uint32_t items_c[] = { 7, 8 };
+	struct cloud_cache_fingerprint fp_a;
+	struct cloud_cache_fingerprint fp_b;
+	struct cloud_cache_fingerprint fp_empty;
+
+	fp_items_set(&fp_a, items_a, ARRAY_SIZE(items_a));
+	fp_items_set(&fp_b, items_b, ARRAY_SIZE(items_b));
+	fp_items_set(&fp_empty, NULL, 0);
+
+	/* 2 common items out of 6 different ones */
+	zassert_equal(33, cloud_cache_fp_similarity(&fp_a, &fp_b));
+	zassert_equal(33, cloud_cache_fp_similarity(&fp_b, &fp_a));
+	zassert_equal(100, cloud_cache_fp_similarity(&fp_a, &fp_a));
+	zassert_equal(100, cloud_cache_fp_similarity(&fp_empty, &fp_empty));
+	zassert_equal(0, cloud_cache_fp_similarity(&fp_a, &fp_empty));
+
+	fp_items_set(&fp_b, items_c, ARRAY_SIZE(items_c));
+	zassert_equal(0, cloud_cache_fp_similarity(&fp_a, &fp_b));
+}
+
+ZTEST(location_cloud_cache, test_add_get)
+{
+	struct location_data location = { 0 };
+
+	cell_data_create(0x12345, NCELL_CNT);
+	zassert_equal(-ENOENT, cloud_cache_get(&cell_data, NULL, &location));
+
+	cloud_cache_add(&cell_data, NULL, &test_location);
+
+	/* One neighbor cell less still matches. */
+	cell_data.ncells_count = NCELL_CNT - 1;
+	zassert_ok(cloud_cache_get(&cell_data, NULL, &location), "Location not found");
+	zassert_equal(test_location.latitude, location.latitude);
+	zassert_equal(test_location.longitude, location.longitude);
+	zassert_equal(test_location.accuracy, location.accuracy);
+
+	/* A different serving cell or scan result type does not match. */
+	cell_data_create(0x54321, NCELL_CNT);
+	zassert_equal(-ENOENT, cloud_cache_get(&cell_data, NULL, &location));
+
+	cell_data_create(0x12345, NCELL_CNT);
+	wifi_data_create(4);
+	zassert_equal(-ENOENT, cloud_cache_get(&cell_data, &wifi_data, &location));
+}
@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#include "cgms_internal.h"
+
+#if defined(CONFIG_BT_CGMS_STORAGE_FLASH)
+#include <zephyr/drivers/flash.h>
+#include <zephyr/storage/flash_map.h>
+
+/* Every record takes a 16-byte slot in the flash simulator. */
+#define SLOT_SIZE 16
+#define STORAGE_CAPACITY (FIXED_PARTITION_SIZE(cgms_storage) / SLOT_SIZE)
+#else
+#define STORAGE_CAPACITY CONFIG_BT_CGMS_MAX_MEASUREMENT_RECORD
+#endif
+
+static struct cgms_meas meas_create(uint16_t val, uint16_t time_offset)
+{
+	struct cgms_meas meas = {
+		.glucose_concentration = val,
+		.time_offset = time_offset,
+		.sensor_status_annunciation = {
+			.warning = 0x01,
+			.calib_temp = 0x02,
+			.status = 0x04,
+		},
+	};
+
+	return meas;
+}
+
+static void records_add(uint32_t first, uint32_t count)
+{
+	struct cgms_meas meas;
+	int err;
+
+	for (uint32_t i = first; i < first + count; i++) {
+		meas = meas_create(i, i);
+		err = cgms_db_add(&meas);
+		zassert_ok(err, "Adding record %u failed: %d", i, err);
+	}
+}
+
+/* Checks that the stored records are consecutive and end with the given value */
+static void records_check(uint32_t last)
+{
+	struct cgms_meas meas[4];
+	uint32_t count = cgms_db_count();
+	uint32_t expected = last + 1 - count;
+	uint32_t index = 0;
+	int rc;
+
+	while (index < count) {
+		rc = cgms_db_read(index, meas, ARRAY_SIZE(meas));
+		zassert_true(rc > 0, "Reading record %u failed: %d", index, rc);
+
+		for (int i = 0; i < rc; i++) {
+			zassert_equal(expected, meas[i].glucose_concentration,
+				      "Unexpected record %u: %u", index + i,
+				      meas[i].glucose_concentration);
+			zassert_equal(0x04, meas[i].sensor_status_annunciation.status,
+				      "Unexpected status annunciation");
+			expected++;
+		}
+
+		index += rc;
+	}
+}
+
+#if defined(CONFIG_BT_CGMS_STORAGE_FLASH)
+static const struct flash_area *storage_open(void)
+{
+	const struct flash_area *fa;
+
+	zassert_ok(flash_area_open(FIXED_PARTITION_ID(cgms_storage), &fa),
+		   "Opening the storage failed");
+
+	return fa;
+}
+
+static uint32_t storage_slots_per_page(void)
+{
+	const struct flash_area *fa = storage_open();
+	struct flash_pages_info info;
+
+	zassert_ok(flash_get_page_info_by_offs(flash_area_get_device(fa), fa->fa_off, &info),
+		   "Reading the page size failed");
+
+	return info.size / SLOT_SIZE;
+}
+
+/* Simulates a record write that was interrupted by a reset. */
+static void storage_slot_corrupt(uint32_t slot)
+{
+	uint8_t buf[SLOT_SIZE] = { 0 };
+
+	zassert_ok(flash_area_write(storage_open(), slot * SLOT_SIZE, buf, sizeof(buf)),
+		   "Writing slot %u failed", slot);
+}
+#endif
+
+static void cgms_db_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_ok(cgms_db_init(), "Database initialization failed");
+	zassert_ok(cgms_db_clear(), "Database clear failed");
+}
+
+ZTEST_SUITE(cgms_db, NULL, NULL, cgms_db_before, NULL, NULL);
+
+ZTEST(cgms_db, test_add_read)
+{
+	struct cgms_meas meas[3];
+	int rc;
+
+	records_add(0, 5);
+	zassert_equal(5, cgms_db_count(), "Unexpected number of records");
+
+	rc = cgms_db_read(2, meas, ARRAY_SIZE(meas));
+	zassert_equal(3, rc, "Unexpected number of records read: %d", rc);
+	zassert_equal(2, meas[0].glucose_concentration, "Unexpected first record");
+	zassert_equal(3, meas[1].time_offset, "Unexpected second record");
+	zassert_equal(0x01, meas[2].sensor_status_annunciation.warning,
+		      "Unexpected warning annunciation");
+
+	records_check(4);
+}
+
+ZTEST(cgms_db, test_read_index)
+{
+	struct cgms_meas meas[4];
+	int rc;
+
+	records_add(0, 5);
+
+	/* Reading past the newest record returns only the stored ones. */
+	rc = cgms_db_read(3, meas, ARRAY_SIZE(meas));
+	zassert_equal(2, rc, "Unexpected number of records read: %d", rc);
+	zassert_equal(4, meas[1].glucose_concentration, "Unexpected last record");
+
+	rc = cgms_db_read(5, meas, ARRAY_SIZE(meas));
+	zassert_equal(0, rc, "Record read past the newest one");
+}
+
+ZTEST(cgms_db, test_wrap)
+{
+	uint32_t total = 2 * STORAGE_CAPACITY + 3;
+	uint32_t count;
+
+	records_add(0, total);
+
+	count = cgms_db_count();
+	zassert_true((count > 0) && (count <= STORAGE_CAPACITY),
+		     "Unexpected number of records: %u", count);
+
+	/* The oldest records are overwritten, the newest one is stored last. */
+	records_check(total - 1);
+}
+
+ZTEST(cgms_db, test_clear)
+{
+	struct cgms_meas meas;
+
+	records_add(0, 5);
+	zassert_ok(cgms_db_clear(), "Database clear failed");
+
+	zassert_equal(0, cgms_db_count(), "Records not deleted");
+	zassert_equal(0, cgms_db_read(0, &meas, 1), "Deleted record read");
+
+	/* The database is usable after the clear. */
+	records_add(10, 2);
+	zassert_equal(2, cgms_db_count(), "Unexpected number of records");
+	records_check(11);
+}
+
+ZTEST(cgms_db, test_recover)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_BT_CGMS_STORAGE_FLASH);
+
+	records_add(0, 10);
+
+	/* The flash storage keeps the records across a reset. */
+	zassert_ok(cgms_db_init(), "Database initialization failed");
+	zassert_equal(10, cgms_db_count(), "Records not recovered");
+	records_check(9);
+
+	records_add(10, 1);
+	records_check(10);
+}
+
+ZTEST(cgms_db, test_recover_interrupted_write)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_BT_CGMS_STORAGE_FLASH);
+
+#if defined(CONFIG_BT_CGMS_STORAGE_FLASH)
+	records_add(0, 10);
+	storage_slot_corrupt(10);
+
+	/* The records are kept and the slot of the interrupted write is skipped. */
+	zassert_ok(cgms_db_init(), "Database initialization failed");
+	zassert_equal(10, cgms_db_count(), "Records not recovered");
+	records_check(9);
+
+	records_add(10, 2);
+	zassert_equal(12, cgms_db_count(), "Unexpected number of records");
+	records_check(11);
+
+	/* The skipped slot is recognized again after the next reset. */
+	zassert_ok(cgms_db_init(), "Database initialization failed");
+	zassert_equal(12, cgms_db_count(), "Records not recovered");
+	records_check(11);
+#endif
+}
+
+ZTEST(cgms_db, test_recover_sequence_gap)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_BT_CGMS_STORAGE_FLASH);
+
+#if defined(CONFIG_BT_CGMS_STORAGE_FLASH)
+	const struct flash_area *fa = storage_open();
+	uint32_t slots_per_page = storage_slots_per_page();
+
+	records_add(0, slots_per_page + 10);
+
+	/* The page of the oldest records is erased, as if an erase was interrupted. */
+	zassert_ok(flash_area_erase(fa, 0, slots_per_page * SLOT_SIZE), "Erase failed");
+
+	/* The newest continuous records are kept. */
+	zassert_ok(cgms_db_init(), "Database initialization failed");
+	zassert_equal(10, cgms_db_count(), "Unexpected number of records");
+	records_check(slots_per_page + 9);
+
+	records_add(slots_per_page + 10, 1);
+	records_check(slots_per_page + 10);
+#endif
+}
+
+static void *cgms_racp_setup(void)
+{
+	zassert_ok(cgms_racp_init(), "RACP initialization failed");
+
+	return NULL;
+}
+
+static void cgms_racp_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_ok(cgms_db_clear(), "Database clear failed");
+	zassert_ok(cgms_racp_session_start(), "Session start failed");
+}
+
+ZTEST_SUITE(cgms_racp, NULL, cgms_racp_setup, cgms_racp_before, NULL, NULL);
+
+ZTEST(cgms_racp, test_time_offset_wrap)
+{
+	struct cgms_meas meas[3];
+
+	zassert_ok(cgms_racp_meas_add(meas_create(0, 10)), "Adding record failed");
+	zassert_ok(cgms_racp_meas_add(meas_create(1, UINT16_MAX)), "Adding record failed");
+	zassert_ok(cgms_racp_meas_add(meas_create(2, 5)), "Adding record failed");
+
+	/* The records are kept when the time offset wraps around. */
+	zassert_equal(3, cgms_db_read(0, meas, ARRAY_SIZE(meas)), "Records removed");
+	zassert_equal(meas[0].session, meas[1].session, "Session changed");
+	zassert_equal((uint16_t)(meas[1].session + 1), meas[2].session,
+		      "Session not changed after the wrap");
+}
+
+ZTEST(cgms_racp, test_session_start)
+{
+	struct cgms_meas meas[3];
+	struct cgms_meas latest;
+
+	zassert_ok(cgms_racp_meas_add(meas_create(0, 10)), "Adding record failed");
+	zassert_ok(cgms_racp_meas_add(meas_create(1, 20)), "Adding record failed");
+
+	/* The records of the previous session are kept. */
+	zassert_ok(cgms_racp_session_start(), "Session start failed");
+	zassert_ok(cgms_racp_meas_add(meas_create(2, 0)), "Adding record failed");
+
+	zassert_equal(3, cgms_db_read(0, meas, ARRAY_SIZE(meas)), "Records removed");
+	zassert_equal((uint16_t)(meas[1].session + 1), meas[2].session,
+		      "Session not changed");
+
+	zassert_ok(cgms_racp_meas_get_latest(&latest), "Reading latest record failed");
+	zassert_equal(2, latest.glucose_concentration, "Unexpected latest record");
+}
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <bluetooth/gatt_dm.h>
+#include "../mock/gatt_discover_mock.h"
+#include "../mock/gatt_cache_mock.h"
+
+/* Timeout for storing the discovery cache in ms */
+#define CACHE_STORE_TIMEOUT 1000
+
+/* Number of the HIDS attributes in the simulated database */
+#define HIDS_ATTR_CNT 11
+
+/* Defined in src/main.c */
+void test_before(void *fixture);
+struct bt_gatt_dm *run_dm(const struct bt_uuid *svc_uuid);
+
+static const uint8_t db_hash_a[16] = { 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7,
+				       0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf };
+static const uint8_t db_hash_b[16] = { 0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+				       0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf };
+
+static struct bt_gatt_dm_cache_stats stats_base;
+
+static void cache_before(void *fixture)
+{
+	test_before(fixture);
+	bt_gatt_cache_mock_setup(db_hash_a);
+	bt_gatt_dm_cache_stats_get(&stats_base);
+}
+
+static void cache_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* The other test suites discover services of a peer that is not bonded. */
+	bt_gatt_cache_mock_bond_set(false);
+}
+
+static void stats_check(uint32_t hits, uint32_t misses, uint32_t stores)
+{
+	struct bt_gatt_dm_cache_stats stats;
+
+	bt_gatt_dm_cache_stats_get(&stats);
+	zassert_equal(hits, stats.hits - stats_base.hits, "Unexpected cache hits: %u",
+		      stats.hits - stats_base.hits);
+	zassert_equal(misses, stats.misses - stats_base.misses, "Unexpected cache misses: %u",
+		      stats.misses - stats_base.misses);
+	zassert_equal(stores, stats.stores - stats_base.stores, "Unexpected cache stores: %u",
+		      stats.stores - stats_base.stores);
+}
+
+/* Runs the HIDS discovery and checks the discovered service */
+static void run_hids_dm(void)
+{
+	struct bt_gatt_dm *dm;
+	const struct bt_gatt_dm_attr *attr;
+	const struct bt_gatt_service_val *serv_val;
+
+	dm = run_dm(BT_UUID_HIDS);
+	zassert_not_null(dm, "Device Manager pointer not set");
+
+	attr = bt_gatt_dm_service_get(dm);
+	serv_val = bt_gatt_dm_attr_service_val(attr);
+	zassert_true(!bt_uuid_cmp(BT_UUID_HIDS, serv_val->uuid), "Invalid service detected");
+	zassert_equal(11, serv_val->end_handle, "Invalid end handle: %u", serv_val->end_handle);
+	zassert_equal(HIDS_ATTR_CNT, bt_gatt_dm_attr_cnt(dm),
+		      "Unexpected number of attributes detected: %d", bt_gatt_dm_attr_cnt(dm));
+
+	attr = bt_gatt_dm_char_by_uuid(dm, BT_UUID_HIDS_REPORT);
+	zassert_not_null(attr, "Report characteristic not found");
+	zassert_equal(6, attr->handle, "Invalid characteristic handle: %u", attr->handle);
+	zassert_equal(BT_GATT_CHRC_READ | BT_GATT_CHRC_NOTIFY,
+		      bt_gatt_dm_attr_chrc_val(attr)->properties, "Invalid properties");
+	zassert_not_null(bt_gatt_dm_desc_by_uuid(dm, attr, BT_UUID_GATT_CCC),
+			 "CCC descriptor not found");
+
+	bt_gatt_dm_data_release(dm);
+}
+
+ZTEST_SUITE(gatt_cache_tests, NULL, NULL, cache_before, cache_after, NULL);
+
+ZTEST(gatt_cache_tests, test_cache_miss)
+{
+	const char *name;
+
+	run_hids_dm();
+	zassert_true(bt_gatt_discover_mock_calls() > 0, "Service not discovered");
+
+	zassert_equal(0, bt_gatt_cache_mock_store_wait(K_MSEC(CACHE_STORE_TIMEOUT)),
+		      "Discovery cache not stored");
+	zassert_equal(1, bt_gatt_cache_mock_entry_cnt(), "Unexpected number of entries");
+
+	name = bt_gatt_cache_mock_entry_name(0);
+	zassert_true(!strncmp(name, "bt_dm/0/", strlen("bt_dm/0/")),
+		     "Unexpected cache key: %s", name);
+
+	stats_check(0, 1, 1);
+}
+
+ZTEST(gatt_cache_tests, test_cache_hit)
+{
+	size_t discover_calls;
+
+	run_hids_dm();
+	zassert_equal(0, bt_gatt_cache_mock_store_wait(K_MSEC(CACHE_STORE_TIMEOUT)),
+		      "Discovery cache not stored");
+	discover_calls = bt_gatt_discover_mock_calls();
+
+	run_hids_dm();
+	zassert_equal(discover_calls, bt_gatt_discover_mock_calls(),
+		      "Service discovered despite the cache hit");
+	zassert_not_equal(0, bt_gatt_cache_mock_store_wait(K_NO_WAIT),
+			  "Cache stored again after the cache hit");
+
+	stats_check(1, 1, 1);
+}
+
+ZTEST(gatt_cache_tests, test_cache_db_hash_changed)
+{
+	size_t discover_calls;
+
+	run_hids_dm();
+	zassert_equal(0, bt_gatt_cache_mock_store_wait(K_MSEC(CACHE_STORE_TIMEOUT)),
+		      "Discovery cache not stored");
+	discover_calls = bt_gatt_discover_mock_calls();
+
+	bt_gatt_cache_mock_db_hash_set(db_hash_b);
+
+	run_hids_dm();
+	zassert_true(bt_gatt_discover_mock_calls() > discover_calls,
+		     "Service not discovered after the Database Hash change");
+	zassert_equal(0, bt_gatt_cache_mock_store_wait(K_MSEC(CACHE_STORE_TIMEOUT)),
+		      "Discovery cache not updated");
+	zassert_equal(1, bt_gatt_cache_mock_entry_cnt(), "Outdated entry not replaced");
+	discover_calls = bt_gatt_discover_mock_calls();
+
+	/* The updated entry is used on the next discovery. */
+	run_hids_dm();
+	zassert_equal(discover_calls, bt_gatt_discover_mock_calls(),
+		      "Service discovered despite the cache hit");
+
+	stats_check(1, 2, 2);
+}
+
+ZTEST(gatt_cache_tests, test_cache_local_identity)
+{
+	size_t discover_calls;
+
+	run_hids_dm();
+	zassert_equal(0, bt_gatt_cache_mock_store_wait(K_MSEC(CACHE_STORE_TIMEOUT)),
+		      "Discovery cache not stored");
+	discover_calls = bt_gatt_discover_mock_calls();
+
+	/* The same peer bonded on another local identity has its own cache entry. */
+	bt_gatt_cache_mock_id_set(1);
+
+	run_hids_dm();
+	zassert_true(bt_gatt_discover_mock_calls() > discover_calls,
+		     "Cache entry of another identity used");
+	zassert_equal(0, bt_gatt_cache_mock_store_wait(K_MSEC(CACHE_STORE_TIMEOUT)),
+		      "Discovery cache not stored");
+	zassert_equal(2, bt_gatt_cache_mock_entry_cnt(), "Unexpected number of entries");
+
+	stats_check(0, 2, 2);
+}
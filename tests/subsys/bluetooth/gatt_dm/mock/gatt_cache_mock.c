@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <string.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/bluetooth/gatt.h>
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/ztest.h>
+
+#include "gatt_cache_mock.h"
+
+#define ENTRY_NAME_MAX_LEN 64
+#define ENTRY_DATA_MAX_LEN 2048
+#define ENTRY_MAX_CNT 4
+
+struct settings_entry {
+	char name[ENTRY_NAME_MAX_LEN];
+	uint8_t data[ENTRY_DATA_MAX_LEN];
+	size_t len;
+};
+
+/* Settings of the discovery cache mock */
+static struct bt_cache_mock {
+	uint8_t db_hash[16];
+	uint8_t id;
+	bool bonded;
+	struct bt_conn *conn;
+	struct bt_gatt_read_params *params;
+	struct k_work_delayable work;
+	struct settings_entry entries[ENTRY_MAX_CNT];
+	size_t entry_cnt;
+} cache_mock_data;
+
+static const bt_addr_le_t peer_addr = {
+	.type = BT_ADDR_LE_PUBLIC,
+	.a.val = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06 },
+};
+
+K_SEM_DEFINE(settings_stored, 0, 1);
+
+static void bt_gatt_read_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct bt_cache_mock *mock_data = CONTAINER_OF(dwork, struct bt_cache_mock, work);
+
+	zassert_true(mock_data->params->handle_count == 0, "Read by UUID expected");
+	zassert_true(!bt_uuid_cmp(mock_data->params->by_uuid.uuid, BT_UUID_GATT_DB_HASH),
+		     "Unexpected UUID read");
+
+	(void)mock_data->params->func(mock_data->conn, 0, mock_data->params,
+				      mock_data->db_hash, sizeof(mock_data->db_hash));
+}
+
+void bt_gatt_cache_mock_setup(const uint8_t db_hash[16])
+{
+	k_work_init_delayable(&cache_mock_data.work, bt_gatt_read_work);
+	memcpy(cache_mock_data.db_hash, db_hash, sizeof(cache_mock_data.db_hash));
+	cache_mock_data.id = 0;
+	cache_mock_data.bonded = true;
+	cache_mock_data.entry_cnt = 0;
+	k_sem_reset(&settings_stored);
+}
+
+void bt_gatt_cache_mock_db_hash_set(const uint8_t db_hash[16])
+{
+	memcpy(cache_mock_data.db_hash, db_hash, sizeof(cache_mock_data.db_hash));
+}
+
+void bt_gatt_cache_mock_bond_set(bool bonded)
+{
+	cache_mock_data.bonded = bonded;
+}
+
+void bt_gatt_cache_mock_id_set(uint8_t id)
+{
+	cache_mock_data.id = id;
+}
+
+int bt_gatt_cache_mock_store_wait(k_timeout_t timeout)
+{
+	int err = k_sem_take(&settings_stored, timeout);
+
+	/* Let the store work item finish after the entry is written. */
+	k_sleep(K_MSEC(1));
+
+	return err;
+}
+
+size_t bt_gatt_cache_mock_entry_cnt(void)
+{
+	return cache_mock_data.entry_cnt;
+}
+
+const char *bt_gatt_cache_mock_entry_name(size_t idx)
+{
+	if (idx >= cache_mock_data.entry_cnt) {
+		return NULL;
+	}
+
+	return cache_mock_data.entries[idx].name;
+}
+
+/* Mocked version of the bt_gatt_read */
+/* Call the bt_gatt_cache_mock_setup function first */
+int bt_gatt_read(struct bt_conn *conn, struct bt_gatt_read_params *params)
+{
+	printk("Running %s mock\n", __func__);
+	cache_mock_data.conn = conn;
+	cache_mock_data.params = params;
+
+	k_work_schedule(&cache_mock_data.work, K_MSEC(5));
+	return 0;
+}
+
+int __wrap_bt_conn_get_info(const struct bt_conn *conn, struct bt_conn_info *info)
+{
+	ARG_UNUSED(conn);
+
+	memset(info, 0, sizeof(*info));
+	info->type = BT_CONN_TYPE_LE;
+	info->id = cache_mock_data.id;
+	info->le.dst = &peer_addr;
+
+	return 0;
+}
+
+bool __wrap_bt_le_bond_exists(uint8_t id, const bt_addr_le_t *addr)
+{
+	return cache_mock_data.bonded && (id == cache_mock_data.id) &&
+	       bt_addr_le_eq(addr, &peer_addr);
+}
+
+int __wrap_settings_save_one(const char *name, const void *value, size_t val_len)
+{
+	struct settings_entry *entry = NULL;
+
+	zassert_true(strlen(name) < ENTRY_NAME_MAX_LEN, "Settings name too long: %s", name);
+	zassert_true(val_len <= ENTRY_DATA_MAX_LEN, "Settings value too long: %zu", val_len);
+	zassert_false(k_is_in_isr(), "Settings written from ISR");
+
+	for (size_t i = 0; i < cache_mock_data.entry_cnt; i++) {
+		if (!strcmp(cache_mock_data.entries[i].name, name)) {
+			entry = &cache_mock_data.entries[i];
+			break;
+		}
+	}
+
+	if (!entry) {
+		zassert_true(cache_mock_data.entry_cnt < ENTRY_MAX_CNT, "Settings storage full");
+		entry = &cache_mock_data.entries[cache_mock_data.entry_cnt++];
+		strcpy(entry->name, name);
+	}
+
+	memcpy(entry->data, value, val_len);
+	entry->len = val_len;
+
+	k_sem_give(&settings_stored);
+
+	return 0;
+}
+
+static ssize_t entry_read(void *cb_arg, void *data, size_t len)
+{
+	struct settings_entry *entry = cb_arg;
+
+	len = MIN(len, entry->len);
+	memcpy(data, entry->data, len);
+
+	return len;
+}
+
+int __wrap_settings_load_subtree_direct(const char *subtree, settings_load_direct_cb cb,
+					void *param)
+{
+	for (size_t i = 0; i < cache_mock_data.entry_cnt; i++) {
+		struct settings_entry *entry = &cache_mock_data.entries[i];
+		const char *next;
+
+		if (!settings_name_steq(entry->name, subtree, &next)) {
+			continue;
+		}
+
+		if (cb(next, entry->len, entry_read, entry, param)) {
+			break;
+		}
+	}
+
+	return 0;
+}
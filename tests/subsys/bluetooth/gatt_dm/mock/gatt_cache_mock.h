@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BT_GATT_CACHE_MOCK_H_
+#define BT_GATT_CACHE_MOCK_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+/**
+ * @file
+ * @defgroup bt_gatt_cache_mock API
+ * @{
+ * @brief The API used to setup the mocks used by the discovery cache
+ *
+ * The mocks replace the Database Hash read, the connection information,
+ * the bond lookup and the settings storage.
+ */
+
+/**
+ * @brief Discovery cache mock setup
+ *
+ * Clears the settings storage and sets the peer as bonded on the identity 0.
+ *
+ * @param db_hash Database Hash returned by the peer.
+ */
+void bt_gatt_cache_mock_setup(const uint8_t db_hash[16]);
+
+/**
+ * @brief Set the Database Hash returned by the peer
+ *
+ * @param db_hash Database Hash returned by the peer.
+ */
+void bt_gatt_cache_mock_db_hash_set(const uint8_t db_hash[16]);
+
+/**
+ * @brief Set the bond state of the peer
+ *
+ * @param bonded True if the peer is bonded.
+ */
+void bt_gatt_cache_mock_bond_set(bool bonded);
+
+/**
+ * @brief Set the local identity of the connection
+ *
+ * @param id Local identity.
+ */
+void bt_gatt_cache_mock_id_set(uint8_t id);
+
+/**
+ * @brief Wait until an entry is written to the settings storage
+ *
+ * The function returns after the work item that wrote the entry completes.
+ *
+ * @param timeout Waiting period.
+ *
+ * @retval 0 If an entry was written.
+ *         Otherwise, a (negative) error code is returned.
+ */
+int bt_gatt_cache_mock_store_wait(k_timeout_t timeout);
+
+/**
+ * @brief Get the number of entries in the settings storage
+ *
+ * @return Number of stored entries.
+ */
+size_t bt_gatt_cache_mock_entry_cnt(void);
+
+/**
+ * @brief Get the name of a settings storage entry
+ *
+ * @param idx Index of the entry.
+ *
+ * @return Name of the entry or NULL if there is no such entry.
+ */
+const char *bt_gatt_cache_mock_entry_name(size_t idx);
+
+/** @} */
+#endif /* BT_GATT_CACHE_MOCK_H_ */
@@ -90,5 +90,13 @@
  */
 void bt_gatt_discover_mock_setup(const struct bt_gatt_attr *attr, size_t len);
 
+/**
+ * @brief Get the number of bt_gatt_discover calls
+ *
+ * @return Number of @ref bt_gatt_discover calls since the last
+ *         @ref bt_gatt_discover_mock_setup call.
+ */
+size_t bt_gatt_discover_mock_calls(void);
+
 /** @} */
 #endif /* #define BT_GATT_DISCOVERY_MOCK_H_ */
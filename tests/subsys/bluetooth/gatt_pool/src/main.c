@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <bluetooth/gatt_pool.h>
+
+#define TEST_UUID_SVC  BT_UUID_HIDS
+#define TEST_UUID_CHRC BT_UUID_HIDS_REPORT
+
+static struct bt_gatt_pool gp_a;
+static struct bt_gatt_pool gp_b;
+static struct bt_gatt_pool gp_c;
+static struct bt_gatt_pool gp_d;
+
+static int chrc_add(struct bt_gatt_pool *gp, const struct bt_uuid *uuid)
+{
+	const struct bt_gatt_attr attr =
+		BT_GATT_ATTRIBUTE(uuid, BT_GATT_PERM_READ, NULL, NULL, NULL);
+
+	return bt_gatt_pool_chrc_alloc(gp, BT_GATT_CHRC_READ, &attr);
+}
+
+static void pool_release(struct bt_gatt_pool *gp)
+{
+	if (gp->attr_slab) {
+		bt_gatt_pool_attrs_free(gp);
+	}
+}
+
+static void after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	pool_release(&gp_a);
+	pool_release(&gp_b);
+	pool_release(&gp_c);
+	pool_release(&gp_d);
+}
+
+ZTEST(gatt_pool, test_attrs_size_class)
+{
+	zassert_ok(bt_gatt_pool_attrs_alloc(&gp_a, 5));
+	zassert_equal(gp_a.attr_array_size, CONFIG_BT_GATT_POOL_ATTR_SLAB_SMALL_SIZE);
+	zassert_equal(gp_a.svc.attr_count, 0);
+
+	zassert_equal(bt_gatt_pool_attrs_alloc(&gp_a, 5), -EINVAL,
+		      "Attribute array overridden");
+
+	/* The small size class is exhausted, so the next one is used. */
+	zassert_ok(bt_gatt_pool_attrs_alloc(&gp_b, 5));
+	zassert_equal(gp_b.attr_array_size, CONFIG_BT_GATT_POOL_ATTR_SLAB_MEDIUM_SIZE);
+
+	zassert_equal(bt_gatt_pool_attrs_alloc(&gp_c,
+					       CONFIG_BT_GATT_POOL_ATTR_SLAB_LARGE_SIZE + 1),
+		      -ENOMEM);
+	zassert_ok(bt_gatt_pool_attrs_alloc(&gp_c, 5));
+	zassert_equal(gp_c.attr_array_size, CONFIG_BT_GATT_POOL_ATTR_SLAB_LARGE_SIZE);
+
+	zassert_equal(bt_gatt_pool_attrs_alloc(&gp_d, 1), -ENOMEM);
+
+	/* A released array is reused. */
+	bt_gatt_pool_attrs_free(&gp_a);
+	zassert_is_null(gp_a.svc.attrs);
+	zassert_ok(bt_gatt_pool_attrs_alloc(&gp_d, CONFIG_BT_GATT_POOL_ATTR_SLAB_SMALL_SIZE));
+	zassert_equal(gp_d.attr_array_size, CONFIG_BT_GATT_POOL_ATTR_SLAB_SMALL_SIZE);
+}
+
+ZTEST(gatt_pool, test_uuid_sharing)
+{
+	struct bt_gatt_pool_stats before;
+	struct bt_gatt_pool_stats stats;
+	uint16_t expected_uuids = IS_ENABLED(CONFIG_BT_GATT_POOL_UUID_DEDUP) ? 2 : 4;
+
+	bt_gatt_pool_stats_get(&before);
+
+	zassert_ok(bt_gatt_pool_attrs_alloc(&gp_a, 3));
+	zassert_ok(bt_gatt_pool_attrs_alloc(&gp_b, 3));
+
+	zassert_ok(bt_gatt_pool_svc_alloc(&gp_a, TEST_UUID_SVC));
+	zassert_ok(chrc_add(&gp_a, TEST_UUID_CHRC));
+	zassert_ok(bt_gatt_pool_svc_alloc(&gp_b, TEST_UUID_SVC));
+	zassert_ok(chrc_add(&gp_b, TEST_UUID_CHRC));
+	zassert_equal(gp_a.svc.attr_count, 3);
+
+	bt_gatt_pool_stats_get(&stats);
+	zassert_equal(stats.uuid_16.used, before.uuid_16.used + expected_uuids);
+	zassert_equal(stats.chrc.used, before.chrc.used + 2);
+
+	if (IS_ENABLED(CONFIG_BT_GATT_POOL_UUID_DEDUP)) {
+		zassert_equal_ptr(gp_a.svc.attrs[0].user_data, gp_b.svc.attrs[0].user_data);
+		zassert_equal_ptr(gp_a.svc.attrs[2].uuid, gp_b.svc.attrs[2].uuid);
+	}
+
+	/* The UUIDs stay valid as long as any attribute uses them. */
+	bt_gatt_pool_attrs_free(&gp_a);
+	zassert_ok(bt_uuid_cmp(gp_b.svc.attrs[0].user_data, TEST_UUID_SVC));
+	zassert_ok(bt_uuid_cmp(gp_b.svc.attrs[2].uuid, TEST_UUID_CHRC));
+
+	bt_gatt_pool_attrs_free(&gp_b);
+
+	bt_gatt_pool_stats_get(&stats);
+	zassert_equal(stats.uuid_16.used, before.uuid_16.used);
+	zassert_equal(stats.chrc.used, before.chrc.used);
+	zassert_true(stats.uuid_16.max_used >= before.uuid_16.used + expected_uuids);
+}
+
+ZTEST(gatt_pool, test_uuid128_sharing)
+{
+	const struct bt_uuid *uuid =
+		BT_UUID_DECLARE_128(BT_UUID_128_ENCODE(0x6e400001, 0xb5a3, 0xf393,
+						       0xe0a9, 0xe50e24dcca9e));
+	int err;
+
+	zassert_ok(bt_gatt_pool_attrs_alloc(&gp_a, 5));
+
+	/* The pool holds two 128-bit UUIDs. */
+	for (size_t i = 0; i < CONFIG_BT_GATT_UUID128_POOL_SIZE; i++) {
+		zassert_ok(bt_gatt_pool_svc_alloc(&gp_a, uuid));
+	}
+
+	err = bt_gatt_pool_svc_alloc(&gp_a, uuid);
+	if (IS_ENABLED(CONFIG_BT_GATT_POOL_UUID_DEDUP)) {
+		zassert_ok(err);
+	} else {
+		zassert_equal(err, -ENOMEM);
+	}
+}
+
+ZTEST(gatt_pool, test_pool_exhaustion)
+{
+	struct bt_gatt_pool_stats stats;
+
+	zassert_ok(bt_gatt_pool_attrs_alloc(&gp_a, 2 * CONFIG_BT_GATT_CHRC_POOL_SIZE + 2));
+
+	for (size_t i = 0; i < CONFIG_BT_GATT_CHRC_POOL_SIZE; i++) {
+		zassert_ok(chrc_add(&gp_a, BT_UUID_DECLARE_16(0x2000 + i)));
+	}
+
+	zassert_equal(chrc_add(&gp_a, BT_UUID_DECLARE_16(0x2000)), -ENOMEM);
+
+	bt_gatt_pool_stats_get(&stats);
+	zassert_equal(stats.chrc.size, CONFIG_BT_GATT_CHRC_POOL_SIZE);
+	zassert_equal(stats.chrc.used, CONFIG_BT_GATT_CHRC_POOL_SIZE);
+	zassert_equal(stats.uuid_16.used, CONFIG_BT_GATT_CHRC_POOL_SIZE);
+	zassert_equal(stats.chrc.max_used, CONFIG_BT_GATT_CHRC_POOL_SIZE);
+
+	bt_gatt_pool_free(&gp_a);
+
+	bt_gatt_pool_stats_get(&stats);
+	zassert_equal(stats.chrc.used, 0);
+	zassert_equal(stats.uuid_16.used, 0);
+	zassert_equal(stats.chrc.max_used, CONFIG_BT_GATT_CHRC_POOL_SIZE);
+
+	/* All the elements can be taken again. */
+	for (size_t i = 0; i < CONFIG_BT_GATT_CHRC_POOL_SIZE; i++) {
+		zassert_ok(chrc_add(&gp_a, BT_UUID_DECLARE_16(0x2000 + i)));
+	}
+}
+
+ZTEST_SUITE(gatt_pool, NULL, NULL, NULL, after, NULL);
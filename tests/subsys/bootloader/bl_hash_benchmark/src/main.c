@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+#include <bl_crypto.h>
+
+/*
+ * Measures the time it takes to hash firmware images of typical sizes directly
+ * from flash, which is what dominates the firmware validation time at boot.
+ */
+
+#define FLASH_SIZE (CONFIG_FLASH_SIZE * 1024)
+
+#if defined(CONFIG_SB_CRYPTO_CC310_SHA256)
+#define BACKEND_NAME "cc310"
+#elif defined(CONFIG_SB_CRYPTO_OBERON_SHA256)
+#define BACKEND_NAME "oberon"
+#else
+#define BACKEND_NAME "unknown"
+#endif
+
+static const uint32_t image_sizes[] = {
+	256 * 1024,
+	512 * 1024,
+	1024 * 1024,
+};
+
+static uint64_t hash_flash(uint32_t size, uint8_t *digest)
+{
+	bl_sha256_ctx_t ctx;
+	timing_t start_time;
+	timing_t end_time;
+
+	start_time = timing_counter_get();
+
+	zassert_ok(bl_sha256_init(&ctx), "bl_sha256_init failed");
+	zassert_ok(bl_sha256_update(&ctx, (const uint8_t *)0, size), "bl_sha256_update failed");
+	zassert_ok(bl_sha256_finalize(&ctx, digest), "bl_sha256_finalize failed");
+
+	end_time = timing_counter_get();
+
+	return timing_cycles_to_ns(timing_cycles_get(&start_time, &end_time));
+}
+
+ZTEST(bl_hash_benchmark, test_hash_throughput)
+{
+	uint8_t digest[32];
+
+	zassert_ok(bl_crypto_init(), "bl_crypto_init failed");
+
+	timing_init();
+	timing_start();
+
+	for (size_t i = 0; i < ARRAY_SIZE(image_sizes); i++) {
+		uint32_t size = image_sizes[i];
+		uint64_t elapsed_us;
+
+		if (size > FLASH_SIZE) {
+			TC_PRINT("[%s] %u kB: skipped, flash is only %u kB\n", BACKEND_NAME,
+				 size / 1024, FLASH_SIZE / 1024);
+			continue;
+		}
+
+		elapsed_us = MAX(hash_flash(size, digest) / NSEC_PER_USEC, 1);
+
+		/* The chunked digest must match the one-shot digest. */
+		zassert_ok(bl_sha256_verify((const uint8_t *)0, size, digest),
+			   "Digest mismatch for %u kB", size / 1024);
+
+		TC_PRINT("[%s] %u kB: %llu us (%llu.%02llu MB/s)\n", BACKEND_NAME, size / 1024,
+			 elapsed_us, (uint64_t)size / elapsed_us,
+			 ((uint64_t)size * 100 / elapsed_us) % 100);
+	}
+
+	timing_stop();
+}
+
+ZTEST_SUITE(bl_hash_benchmark, NULL, NULL, NULL, NULL, NULL);
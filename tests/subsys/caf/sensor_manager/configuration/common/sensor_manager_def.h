@@ -31,6 +31,11 @@ static const struct caf_sampled_channel accel_chan[] = {
 	},
 };
 
+static const struct sensor_trigger fifo_trig = {
+	.type = SENSOR_TRIG_DATA_READY,
+	.chan = SENSOR_CHAN_ALL,
+};
+
 static const struct sm_sensor_config sensor_configs[] = {
 	{
 		.dev = DEVICE_DT_GET(DT_NODELABEL(sensor_sim_1)),
@@ -56,4 +61,23 @@ static const struct sm_sensor_config sensor_configs[] = {
 		.sampling_period_ms = 33000,
 		.active_events_limit = 3,
 	},
+	{
+		.dev = DEVICE_DT_GET(DT_NODELABEL(sensor_sim_4)),
+		.event_descr = "Simulated sensor 4",
+		.chans = accel_chan,
+		.chan_cnt = ARRAY_SIZE(accel_chan),
+		.sampling_period_ms = 33000,
+		.active_events_limit = 3,
+		.samples_per_event = 4,
+	},
+	{
+		.dev = DEVICE_DT_GET(DT_NODELABEL(sensor_sim_5)),
+		.event_descr = "Simulated sensor 5",
+		.chans = accel_chan,
+		.chan_cnt = ARRAY_SIZE(accel_chan),
+		.sampling_period_ms = 33000,
+		.active_events_limit = 3,
+		.samples_per_event = 5,
+		.fifo_trigger = &fifo_trig,
+	},
 };
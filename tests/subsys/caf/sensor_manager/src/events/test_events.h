@@ -27,6 +27,8 @@ enum test_id {
 	TEST_CHANGE_PERIOD_PRE,
 	TEST_CHANGE_PERIOD_POST,
 	TEST_MULTIPLE_SENSORS,
+	TEST_BATCHING,
+	TEST_FIFO,
 
 	TEST_CNT
 };
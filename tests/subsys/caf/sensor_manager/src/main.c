@@ -21,6 +21,11 @@ LOG_MODULE_REGISTER(MODULE);
 #define PRE_CHANGE_SAMPLING_PERIOD 20
 #define SAMPLING_PERIOD 40
 #define SAMPLING_PERIOD_LONG 33000
+#define BATCH_SAMPLING_PERIOD 10
+#define BATCH_SAMPLE_CNT 4
+#define ACCEL_DATA_CNT 3
+#define FIFO_TRIGGER_PERIOD 100
+#define FIFO_SAMPLE_CNT 5
 
 static enum test_id cur_test_id;
 static K_SEM_DEFINE(test_end_sem, 0, 1);
@@ -56,6 +61,7 @@ static void test_before(void *f)
 	struct set_sensor_period_event *event_sensor1 = new_set_sensor_period_event();
 	struct set_sensor_period_event *event_sensor2 = new_set_sensor_period_event();
 	struct set_sensor_period_event *event_sensor3 = new_set_sensor_period_event();
+	struct set_sensor_period_event *event_sensor4 = new_set_sensor_period_event();
 	struct test_initialization_done_event *event_init_done =
 						new_test_initialization_done_event();
 
@@ -71,6 +77,10 @@ static void test_before(void *f)
 	event_sensor3->descr = "Simulated sensor 3";
 	APP_EVENT_SUBMIT(event_sensor3);
 
+	event_sensor4->sampling_period = SAMPLING_PERIOD_LONG;
+	event_sensor4->descr = "Simulated sensor 4";
+	APP_EVENT_SUBMIT(event_sensor4);
+
 	APP_EVENT_SUBMIT(event_init_done);
 
 	int err = k_sem_take(&test_init_sem, K_SECONDS(30));
@@ -122,6 +132,22 @@ ZTEST(caf_sensor_manager_tests, test_multiple_sensors)
 	test_start(TEST_MULTIPLE_SENSORS);
 }
 
+ZTEST(caf_sensor_manager_tests, test_batching)
+{
+	struct set_sensor_period_event *event = new_set_sensor_period_event();
+
+	event->sampling_period = BATCH_SAMPLING_PERIOD;
+	event->descr = "Simulated sensor 4";
+	APP_EVENT_SUBMIT(event);
+
+	test_start(TEST_BATCHING);
+}
+
+ZTEST(caf_sensor_manager_tests, test_fifo)
+{
+	test_start(TEST_FIFO);
+}
+
 static bool app_event_handler(const struct app_event_header *aeh)
 {
 	if (is_test_end_event(aeh)) {
@@ -139,6 +165,11 @@ static bool app_event_handler(const struct app_event_header *aeh)
 
 		struct sensor_event *ev = cast_sensor_event(aeh);
 
+		if ((cur_test_id != TEST_FIFO) && !strcmp(ev->descr, "Simulated sensor 5")) {
+			/* Sensor with the FIFO trigger is sampled regardless of the test. */
+			return false;
+		}
+
 		switch (cur_test_id) {
 		case TEST_BASIC:
 			cur_test_id = TEST_IDLE;
@@ -217,6 +248,67 @@ static bool app_event_handler(const struct app_event_header *aeh)
 			}
 
 			zassert_unreachable("Expected sensor event from different sensor");
+			break;
+
+		case TEST_BATCHING:
+			if (strcmp(ev->descr, "Simulated sensor 4")) {
+				/* Ignore events from sensors that are not batched. */
+				break;
+			}
+
+			zassert_equal(sensor_event_get_data_cnt(ev),
+				      BATCH_SAMPLE_CNT * ACCEL_DATA_CNT,
+				      "Samples are not batched");
+
+			if (first_event_uptime == 0) {
+				first_event_uptime = k_uptime_get();
+				break;
+			}
+
+			int64_t batch_period = k_uptime_get() - first_event_uptime;
+
+			zassert_between_inclusive(batch_period,
+						  BATCH_SAMPLE_CNT * BATCH_SAMPLING_PERIOD - 1,
+						  BATCH_SAMPLE_CNT * BATCH_SAMPLING_PERIOD + 1,
+						  "Wrong batch time");
+
+			struct set_sensor_period_event *event = new_set_sensor_period_event();
+
+			event->sampling_period = SAMPLING_PERIOD_LONG;
+			event->descr = "Simulated sensor 4";
+			APP_EVENT_SUBMIT(event);
+
+			first_event_uptime = 0;
+			cur_test_id = TEST_IDLE;
+			k_sem_give(&test_end_sem);
+			break;
+
+		case TEST_FIFO:
+			if (strcmp(ev->descr, "Simulated sensor 5")) {
+				/* Ignore events from sensors that are not sampled on the trigger. */
+				break;
+			}
+
+			zassert_equal(sensor_event_get_data_cnt(ev),
+				      FIFO_SAMPLE_CNT * ACCEL_DATA_CNT,
+				      "FIFO was not drained into a single event");
+
+			if (first_event_uptime == 0) {
+				first_event_uptime = k_uptime_get();
+				break;
+			}
+
+			int64_t fifo_period = k_uptime_get() - first_event_uptime;
+
+			zassert_between_inclusive(fifo_period,
+						  FIFO_TRIGGER_PERIOD - 2,
+						  FIFO_TRIGGER_PERIOD + 2,
+						  "FIFO is not drained on the trigger");
+
+			first_event_uptime = 0;
+			cur_test_id = TEST_IDLE;
+			k_sem_give(&test_end_sem);
+			break;
 
 		default:
 			break;
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <dfu/dfu_multi_image.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+#include <zcbor_encode.h>
+
+#include <string.h>
+
+#define FLASH_BASE (64 * 1024)
+#define FLASH_PAGE_SIZE 4096
+
+#define IMAGE_COUNT 2
+#define IMAGE_SIZE (32 * 1024)
+#define HEADER_MAX_SIZE 64
+#define PACKAGE_MAX_SIZE (HEADER_MAX_SIZE + IMAGE_COUNT * IMAGE_SIZE)
+
+/*
+ * Emulated transport: chunks of CHUNK_SIZE bytes arrive every RECEIVE_TIME_US microseconds,
+ * which roughly corresponds to 1 MB/s link.
+ */
+#define CHUNK_SIZE 512
+#define RECEIVE_TIME_US 500
+
+static const struct device *fdev = DEVICE_DT_GET(DT_CHOSEN(zephyr_flash_controller));
+static uint8_t package[PACKAGE_MAX_SIZE];
+static size_t package_size;
+static uint8_t header_buf[HEADER_MAX_SIZE];
+static uint8_t read_buf[CHUNK_SIZE];
+
+/*
+ * Image writer storing the images in the simulated flash, one after another.
+ */
+
+static off_t image_base;
+static size_t image_offset;
+
+static int flash_writer_open(int image_id, size_t image_size)
+{
+	image_base = FLASH_BASE + image_id * ROUND_UP(IMAGE_SIZE, FLASH_PAGE_SIZE);
+	image_offset = 0;
+
+	return flash_erase(fdev, image_base, ROUND_UP(image_size, FLASH_PAGE_SIZE));
+}
+
+static int flash_writer_write(const uint8_t *chunk, size_t chunk_size)
+{
+	int err = flash_write(fdev, image_base + image_offset, chunk, chunk_size);
+
+	if (!err) {
+		image_offset += chunk_size;
+	}
+
+	return err;
+}
+
+static int flash_writer_close(bool success)
+{
+	return success ? 0 : -ECANCELED;
+}
+
+static size_t build_header(uint8_t *buf, size_t buf_size)
+{
+	size_t cbor_size;
+	bool res;
+
+	ZCBOR_STATE_E(states, 3, buf + sizeof(uint16_t), buf_size - sizeof(uint16_t), 0);
+
+	res = zcbor_map_start_encode(states, 1);
+	res = res && zcbor_tstr_put_lit(states, "img");
+	res = res && zcbor_list_start_encode(states, IMAGE_COUNT);
+
+	for (int i = 0; i < IMAGE_COUNT; i++) {
+		res = res && zcbor_map_start_encode(states, 2);
+		res = res && zcbor_tstr_put_lit(states, "id");
+		res = res && zcbor_int32_put(states, i);
+		res = res && zcbor_tstr_put_lit(states, "size");
+		res = res && zcbor_uint32_put(states, IMAGE_SIZE);
+		res = res && zcbor_map_end_encode(states, 2);
+	}
+
+	res = res && zcbor_list_end_encode(states, IMAGE_COUNT);
+	res = res && zcbor_map_end_encode(states, 1);
+
+	zassert_true(res, "Failed to encode package header");
+
+	cbor_size = states[0].payload - (buf + sizeof(uint16_t));
+	sys_put_le16(cbor_size, buf);
+
+	return sizeof(uint16_t) + cbor_size;
+}
+
+static void *setup(void)
+{
+	size_t header_size = build_header(package, sizeof(package));
+
+	for (size_t i = header_size; i < header_size + IMAGE_COUNT * IMAGE_SIZE; i++) {
+		package[i] = (uint8_t)(i * 31);
+	}
+
+	package_size = header_size + IMAGE_COUNT * IMAGE_SIZE;
+
+	return NULL;
+}
+
+ZTEST(dfu_multi_image_throughput_test, test_throughput)
+{
+	const uint8_t *image = package + (package_size - IMAGE_COUNT * IMAGE_SIZE);
+	int64_t start_time;
+	int64_t elapsed_ms;
+	int err;
+
+	zassert_true(device_is_ready(fdev), "Flash device not ready");
+	zassert_ok(dfu_multi_image_init(header_buf, sizeof(header_buf)), "DFU init failed");
+
+	for (int i = 0; i < IMAGE_COUNT; i++) {
+		struct dfu_image_writer writer = {
+			.image_id = i,
+			.open = flash_writer_open,
+			.write = flash_writer_write,
+			.close = flash_writer_close,
+		};
+
+		zassert_ok(dfu_multi_image_register_writer(&writer), "Writer registration failed");
+	}
+
+	start_time = k_uptime_get();
+
+	for (size_t i = 0; i < package_size; i += CHUNK_SIZE) {
+		/* Wait for the next chunk to be received */
+		k_sleep(K_USEC(RECEIVE_TIME_US));
+
+		err = dfu_multi_image_write(i, package + i, MIN(CHUNK_SIZE, package_size - i));
+		zassert_ok(err, "DFU write failed: %d", err);
+	}
+
+	err = dfu_multi_image_done(true);
+	zassert_ok(err, "DFU done failed: %d", err);
+
+	elapsed_ms = MAX(k_uptime_get() - start_time, 1);
+
+	TC_PRINT("Written %zu bytes in %lld ms (%lld kB/s)\n", package_size, elapsed_ms,
+		 (int64_t)package_size * MSEC_PER_SEC / 1024 / elapsed_ms);
+
+	/* Verify that all the images have been stored correctly */
+	for (int i = 0; i < IMAGE_COUNT; i++) {
+		off_t base = FLASH_BASE + i * ROUND_UP(IMAGE_SIZE, FLASH_PAGE_SIZE);
+
+		for (size_t off = 0; off < IMAGE_SIZE; off += sizeof(read_buf)) {
+			zassert_ok(flash_read(fdev, base + off, read_buf, sizeof(read_buf)),
+				   "Flash read failed");
+			zassert_mem_equal(read_buf, image + i * IMAGE_SIZE + off, sizeof(read_buf),
+					  "Image %d content mismatch at offset %zu", i, off);
+		}
+	}
+}
+
+ZTEST_SUITE(dfu_multi_image_throughput_test, NULL, setup, NULL, NULL, NULL);
@@ -16,6 +16,7 @@
 
 #define TEST_ID_1 "test_1"
 #define TEST_ID_2 "test_2"
+#define TEST_ID_3 "test_3"
 
 #define BUF_LEN 14000 /* Note, not page aligned */
 
@@ -101,6 +102,131 @@ ZTEST(dfu_target_stream_test, test_dfu_target_stream)
 	zassert_mem_equal(read_buf, write_buf, BUF_LEN, "Incorrect value");
 }
 
+ZTEST(dfu_target_stream_test, test_dfu_target_stream_write_buf)
+{
+	int err;
+	size_t offset;
+	size_t len;
+	uint8_t *buf;
+
+	/* Reset state to avoid failure when initializing */
+	err = dfu_target_stream_done(true);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	/* Null checks */
+	err = dfu_target_stream_write_buf_get(NULL, &len);
+	zassert_true(err < 0, "Unexpected success: %d", err);
+
+	err = dfu_target_stream_write_buf_get(&buf, NULL);
+	zassert_true(err < 0, "Unexpected success: %d", err);
+
+	/* Separate id, so no progress is loaded from the other tests */
+	err = DFU_TARGET_STREAM_INIT(TEST_ID_3, fdev, sbuf, sizeof(sbuf),
+				     FLASH_BASE, FLASH_AVAILABLE, NULL);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_write_buf_get(&buf, &len);
+#ifdef CONFIG_DFU_TARGET_STREAM_SYNCHRONOUS
+	zassert_equal(err, -ENOTSUP, "Unexpected result: %d", err);
+#else
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_equal_ptr(buf, sbuf, "Unexpected buffer");
+	zassert_equal(len, sizeof(sbuf), "Unexpected length");
+
+	/* Partially fill the buffer, nothing is written to flash yet */
+	memcpy(buf, write_buf, 100);
+	err = dfu_target_stream_write_buf_commit(100);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_offset_get(&offset);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_equal(offset, 0, "Invalid offset");
+
+	err = dfu_target_stream_write_buf_get(&buf, &len);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_equal_ptr(buf, sbuf + 100, "Unexpected buffer");
+	zassert_equal(len, sizeof(sbuf) - 100, "Unexpected length");
+
+	/* Committing more than the free space must fail */
+	err = dfu_target_stream_write_buf_commit(len + 1);
+	zassert_true(err < 0, "Unexpected success: %d", err);
+
+	/* Filling the buffer writes it to flash */
+	memcpy(buf, write_buf + 100, len);
+	err = dfu_target_stream_write_buf_commit(len);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_offset_get(&offset);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_equal(offset, sizeof(sbuf), "Invalid offset");
+
+	err = dfu_target_stream_write_buf_get(&buf, &len);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_equal_ptr(buf, sbuf, "Unexpected buffer");
+	zassert_equal(len, sizeof(sbuf), "Unexpected length");
+
+	err = flash_read(fdev, FLASH_BASE, read_buf, sizeof(sbuf));
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_mem_equal(read_buf, write_buf, sizeof(sbuf), "Incorrect value");
+#endif
+
+	err = dfu_target_stream_done(true);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+}
+
+ZTEST(dfu_target_stream_test, test_dfu_target_stream_write_buf_bounds)
+{
+	/* The flash area ends in the middle of the second write buffer */
+	const size_t available = sizeof(sbuf) + 32;
+	int err;
+	size_t len;
+	uint8_t *buf;
+
+	Z_TEST_SKIP_IFDEF(CONFIG_DFU_TARGET_STREAM_SYNCHRONOUS);
+
+	/* Reset state to avoid failure when initializing */
+	err = dfu_target_stream_done(true);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = DFU_TARGET_STREAM_INIT(TEST_ID_3, fdev, sbuf, sizeof(sbuf),
+				     FLASH_BASE, available, NULL);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = dfu_target_stream_write_buf_get(&buf, &len);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_equal(len, sizeof(sbuf), "Unexpected length");
+
+	memcpy(buf, write_buf, len);
+	err = dfu_target_stream_write_buf_commit(len);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	/* The free part of the buffer is limited to the rest of the flash area */
+	err = dfu_target_stream_write_buf_get(&buf, &len);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_equal(len, available - sizeof(sbuf), "Unexpected length");
+
+	err = dfu_target_stream_write_buf_commit(len + 1);
+	zassert_equal(err, -ENOMEM, "Unexpected result: %d", err);
+
+	memcpy(buf, write_buf + sizeof(sbuf), len);
+	err = dfu_target_stream_write_buf_commit(len);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	/* The flash area is full */
+	err = dfu_target_stream_write_buf_get(&buf, &len);
+	zassert_equal(err, -ENOMEM, "Unexpected result: %d", err);
+
+	err = dfu_target_stream_write_buf_commit(1);
+	zassert_equal(err, -ENOMEM, "Unexpected result: %d", err);
+
+	err = dfu_target_stream_done(true);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+
+	err = flash_read(fdev, FLASH_BASE, read_buf, available);
+	zassert_equal(err, 0, "Unexpected failure: %d", err);
+	zassert_mem_equal(read_buf, write_buf, available, "Incorrect value");
+}
+
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
 ZTEST(dfu_target_stream_test, test_dfu_target_stream_save_progress)
 {
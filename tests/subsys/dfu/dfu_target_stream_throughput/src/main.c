@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <dfu/dfu_target_stream.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/kernel.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+
+#include <string.h>
+
+#define TEST_ID "throughput"
+#define IMAGE_OFFSET FIXED_PARTITION_OFFSET(storage_partition)
+#define IMAGE_SIZE MIN(FIXED_PARTITION_SIZE(storage_partition), 32 * 1024)
+
+/*
+ * Emulated transport: chunks of up to CHUNK_SIZE bytes are received by the downloader.
+ * The copy path receives them into the downloader buffer and passes them to
+ * dfu_target_stream_write(). The zero-copy path receives them directly into the
+ * stream flash write buffer.
+ */
+#define CHUNK_SIZE 1024
+#define WRITE_BUF_SIZE 512
+
+static const struct device *fdev = DEVICE_DT_GET(DT_CHOSEN(zephyr_flash_controller));
+static uint8_t image[IMAGE_SIZE];
+static uint8_t __aligned(4) write_buf[WRITE_BUF_SIZE];
+static uint8_t rx_buf[CHUNK_SIZE];
+static uint8_t read_buf[WRITE_BUF_SIZE];
+
+static void stream_init(void)
+{
+	int err;
+
+	err = dfu_target_stream_init(&(struct dfu_target_stream_init) {
+		.id = TEST_ID,
+		.fdev = fdev,
+		.buf = write_buf,
+		.len = sizeof(write_buf),
+		.offset = IMAGE_OFFSET,
+		.size = IMAGE_SIZE,
+	});
+	zassert_ok(err, "DFU target stream init failed: %d", err);
+}
+
+static void image_check(void)
+{
+	for (size_t off = 0; off < IMAGE_SIZE; off += sizeof(read_buf)) {
+		size_t len = MIN(sizeof(read_buf), IMAGE_SIZE - off);
+
+		zassert_ok(flash_read(fdev, IMAGE_OFFSET + off, read_buf, len),
+			   "Flash read failed");
+		zassert_mem_equal(read_buf, image + off, len, "Image mismatch at offset %zu", off);
+	}
+}
+
+static uint32_t write_copy(void)
+{
+	uint32_t start;
+	int err;
+
+	stream_init();
+	start = k_cycle_get_32();
+
+	for (size_t off = 0; off < IMAGE_SIZE; off += CHUNK_SIZE) {
+		size_t len = MIN(CHUNK_SIZE, IMAGE_SIZE - off);
+
+		/* Receive the chunk into the downloader buffer */
+		memcpy(rx_buf, image + off, len);
+
+		err = dfu_target_stream_write(rx_buf, len);
+		zassert_ok(err, "DFU target stream write failed: %d", err);
+	}
+
+	err = dfu_target_stream_done(true);
+	zassert_ok(err, "DFU target stream done failed: %d", err);
+
+	return k_cycle_get_32() - start;
+}
+
+static uint32_t write_zero_copy(void)
+{
+	uint32_t start;
+	uint8_t *buf;
+	size_t len;
+	int err;
+
+	stream_init();
+	start = k_cycle_get_32();
+
+	for (size_t off = 0; off < IMAGE_SIZE; off += len) {
+		err = dfu_target_stream_write_buf_get(&buf, &len);
+		zassert_ok(err, "DFU target stream buffer get failed: %d", err);
+
+		/* Receive the chunk directly into the write buffer */
+		len = MIN(MIN(len, CHUNK_SIZE), IMAGE_SIZE - off);
+		memcpy(buf, image + off, len);
+
+		err = dfu_target_stream_write_buf_commit(len);
+		zassert_ok(err, "DFU target stream buffer commit failed: %d", err);
+	}
+
+	err = dfu_target_stream_done(true);
+	zassert_ok(err, "DFU target stream done failed: %d", err);
+
+	return k_cycle_get_32() - start;
+}
+
+static void result_print(const char *name, uint32_t cycles)
+{
+	uint64_t us = MAX(k_cyc_to_us_ceil64(cycles), 1);
+
+	TC_PRINT("%s: %u bytes in %llu us (%llu kB/s)\n", name, (unsigned int)IMAGE_SIZE,
+		 (unsigned long long)us,
+		 (unsigned long long)((uint64_t)IMAGE_SIZE * USEC_PER_SEC / 1024 / us));
+}
+
+static void *setup(void)
+{
+	for (size_t i = 0; i < IMAGE_SIZE; i++) {
+		image[i] = (uint8_t)(i * 31);
+	}
+
+	return NULL;
+}
+
+/*
+ * On native_sim, the time spent by the CPU is not simulated, so both paths take the same
+ * time and only their results are compared. Run on hardware to measure the saved copy.
+ */
+ZTEST(dfu_target_stream_throughput_test, test_throughput)
+{
+	uint32_t copy_cycles;
+	uint32_t zero_copy_cycles;
+
+	Z_TEST_SKIP_IFDEF(CONFIG_DFU_TARGET_STREAM_SYNCHRONOUS);
+	zassert_true(device_is_ready(fdev), "Flash device not ready");
+
+	copy_cycles = write_copy();
+	image_check();
+
+	/* Erase the image, so that the zero-copy path is verified on its own */
+	zassert_ok(flash_erase(fdev, IMAGE_OFFSET, FIXED_PARTITION_SIZE(storage_partition)),
+		   "Flash erase failed");
+
+	zero_copy_cycles = write_zero_copy();
+	image_check();
+
+	result_print("Copy", copy_cycles);
+	result_print("Zero-copy", zero_copy_cycles);
+}
+
+ZTEST_SUITE(dfu_target_stream_throughput_test, NULL, setup, NULL, NULL, NULL);
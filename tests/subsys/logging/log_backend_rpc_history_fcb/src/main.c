@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "log_backend_rpc_history.h"
+
+#include <zephyr/fs/fcb.h>
+#include <zephyr/logging/log_msg.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/ztest.h>
+
+#include <string.h>
+
+#define MSG_MAX_WLEN 256
+#define PACKAGE_LEN 20
+#define DATA_LEN 7
+/* Number of messages that exceeds the capacity of the log history partition. */
+#define FILL_MSG_COUNT 1000
+/* FCB magic used by the log history. */
+#define LOG_HISTORY_MAGIC 0x7d2ac863
+
+static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT) msg_buf[MSG_MAX_WLEN];
+
+static const union log_msg_generic *msg_create(uint32_t id, log_timestamp_t timestamp,
+					       size_t package_len, size_t data_len)
+{
+	struct log_msg *msg = (struct log_msg *)msg_buf;
+	struct log_msg_desc desc = {
+		.level = LOG_LEVEL_INF,
+		.package_len = package_len,
+		.data_len = data_len,
+	};
+
+	zassert_true(log_msg_get_total_wlen(desc) <= ARRAY_SIZE(msg_buf));
+
+	memset(msg_buf, 0, sizeof(msg_buf));
+	msg->hdr.desc = desc;
+	msg->hdr.source = (const void *)(uintptr_t)(0x1000 + id);
+	msg->hdr.timestamp = timestamp;
+
+	/* The message ID is stored at the beginning of the package, followed by a pattern. */
+	memcpy(msg->data, &id, sizeof(id));
+
+	for (size_t i = sizeof(id); i < package_len + data_len; i++) {
+		msg->data[i] = (uint8_t)(id + i);
+	}
+
+	return (const union log_msg_generic *)msg;
+}
+
+static uint32_t msg_id(const union log_msg_generic *msg)
+{
+	uint32_t id;
+
+	memcpy(&id, msg->log.data, sizeof(id));
+
+	return id;
+}
+
+static void msg_check(const union log_msg_generic *msg, uint32_t id, log_timestamp_t timestamp,
+		      size_t package_len, size_t data_len)
+{
+	const union log_msg_generic *expected = msg_create(id, timestamp, package_len, data_len);
+
+	zassert_not_null(msg, "Message %u not popped", id);
+	zassert_equal(LOG_LEVEL_INF, msg->log.hdr.desc.level);
+	zassert_equal(package_len, msg->log.hdr.desc.package_len);
+	zassert_equal(data_len, msg->log.hdr.desc.data_len);
+	zassert_equal_ptr(expected->log.hdr.source, msg->log.hdr.source);
+	zassert_equal(timestamp, msg->log.hdr.timestamp, "Invalid timestamp of message %u", id);
+	zassert_mem_equal(expected->log.data, msg->log.data, package_len + data_len,
+			  "Invalid payload of message %u", id);
+}
+
+static void push_msgs(uint32_t count)
+{
+	for (uint32_t id = 0; id < count; id++) {
+		log_rpc_history_push(msg_create(id, id * 10, PACKAGE_LEN, DATA_LEN));
+	}
+}
+
+/* Pops all messages and checks that their IDs are consecutive. Returns the number of them. */
+static uint32_t pop_msgs(uint32_t first_id)
+{
+	const union log_msg_generic *msg;
+	uint32_t id = first_id;
+
+	while ((msg = log_rpc_history_pop()) != NULL) {
+		msg_check(msg, id, id * 10, PACKAGE_LEN, DATA_LEN);
+		log_rpc_history_free(msg);
+		id++;
+	}
+
+	return id - first_id;
+}
+
+static int entry_count_cb(struct fcb_entry_ctx *entry_ctx, void *arg)
+{
+	ARG_UNUSED(entry_ctx);
+
+	(*(uint32_t *)arg)++;
+
+	return 0;
+}
+
+/* Returns the number of blocks stored in the log history partition. */
+static uint32_t stored_block_count(void)
+{
+	static struct flash_sector sectors[CONFIG_LOG_BACKEND_RPC_HISTORY_STORAGE_FCB_NUM_SECTORS];
+	struct fcb fcb = {
+		.f_magic = LOG_HISTORY_MAGIC,
+		.f_sectors = sectors,
+	};
+	uint32_t sector_cnt = ARRAY_SIZE(sectors);
+	uint32_t count = 0;
+
+	zassert_ok(flash_area_get_sectors(FIXED_PARTITION_ID(log_history), &sector_cnt, sectors));
+	fcb.f_sector_cnt = (uint8_t)sector_cnt;
+	zassert_ok(fcb_init(FIXED_PARTITION_ID(log_history), &fcb));
+	zassert_ok(fcb_walk(&fcb, NULL, entry_count_cb, &count));
+
+	return count;
+}
+
+static void test_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	log_rpc_history_init();
+}
+
+ZTEST_SUITE(log_rpc_history_fcb, NULL, NULL, test_before, NULL, NULL);
+
+ZTEST(log_rpc_history_fcb, test_round_trip)
+{
+	static const struct {
+		log_timestamp_t timestamp;
+		size_t package_len;
+		size_t data_len;
+	} msgs[] = {
+		{ 100, 8, 0 },
+		{ 150, 16, 3 },
+		/* Negative timestamp delta. */
+		{ 120, 12, 0 },
+		{ 0, 4, 1 },
+		/* Large timestamp delta. */
+		{ (log_timestamp_t)INT32_MAX, 40, 17 },
+	};
+	const union log_msg_generic *msg;
+
+	for (size_t i = 0; i < ARRAY_SIZE(msgs); i++) {
+		log_rpc_history_push(msg_create(i, msgs[i].timestamp, msgs[i].package_len,
+						msgs[i].data_len));
+	}
+
+	zassert_true(log_rpc_history_get_usage_size() > 0);
+
+	for (size_t i = 0; i < ARRAY_SIZE(msgs); i++) {
+		msg = log_rpc_history_pop();
+		msg_check(msg, i, msgs[i].timestamp, msgs[i].package_len, msgs[i].data_len);
+		log_rpc_history_free(msg);
+	}
+
+	zassert_is_null(log_rpc_history_pop());
+	zassert_equal(0, log_rpc_history_get_dropped());
+}
+
+ZTEST(log_rpc_history_fcb, test_multiple_blocks)
+{
+	/* The messages span many blocks stored in the FCB. */
+	push_msgs(200);
+
+	zassert_equal(200, pop_msgs(0));
+	zassert_equal(0, log_rpc_history_get_dropped());
+}
+
+ZTEST(log_rpc_history_fcb, test_overwriting)
+{
+	const union log_msg_generic *msg;
+	uint32_t first_id;
+	uint32_t popped;
+
+	push_msgs(FILL_MSG_COUNT);
+
+	/* The oldest messages are overwritten, the newest ones are kept. */
+	msg = log_rpc_history_pop();
+	zassert_not_null(msg);
+	first_id = msg_id(msg);
+	msg_check(msg, first_id, first_id * 10, PACKAGE_LEN, DATA_LEN);
+	log_rpc_history_free(msg);
+
+	popped = pop_msgs(first_id + 1) + 1;
+
+	zassert_true(first_id > 0);
+	zassert_equal(FILL_MSG_COUNT, first_id + popped);
+	zassert_equal(0, log_rpc_history_get_dropped());
+}
+
+ZTEST(log_rpc_history_fcb, test_no_overwriting)
+{
+	uint32_t popped;
+	uint32_t dropped;
+
+	log_rpc_history_set_overwriting(false);
+
+	push_msgs(FILL_MSG_COUNT);
+
+	/* The oldest messages are kept, including the ones in the block that did not fit
+	 * in the FCB, and the new ones are dropped.
+	 */
+	popped = pop_msgs(0);
+	dropped = log_rpc_history_get_dropped();
+
+	log_rpc_history_set_overwriting(true);
+
+	zassert_true(popped > 0);
+	zassert_true(dropped > 0);
+	zassert_equal(FILL_MSG_COUNT, popped + dropped);
+}
+
+ZTEST(log_rpc_history_fcb, test_msg_too_large)
+{
+	log_rpc_history_push(msg_create(0, 0, CONFIG_LOG_BACKEND_RPC_HISTORY_STORAGE_FCB_BLOCK_SIZE,
+					0));
+
+	zassert_is_null(log_rpc_history_pop());
+	zassert_equal(1, log_rpc_history_get_dropped());
+}
+
+ZTEST(log_rpc_history_fcb, test_panic_flush)
+{
+	/* The messages fit in the block that is being filled. */
+	push_msgs(3);
+
+	zassert_equal(0, stored_block_count());
+
+	/* The panic path stores the block in the FCB, so it can be read back from the flash. */
+	log_rpc_history_save_checksum();
+
+	zassert_equal(1, stored_block_count());
+	zassert_equal(3, pop_msgs(0));
+	zassert_equal(0, log_rpc_history_get_dropped());
+}
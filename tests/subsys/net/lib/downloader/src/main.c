@@ -164,6 +164,7 @@
 
 static int dl_callback(const struct downloader_evt *event);
 static int dl_callback_abort(const struct downloader_evt *event);
+static int dl_app_buf_get(void **buf, size_t *len);
 
 static struct downloader dl;
 
@@ -180,6 +181,14 @@ struct downloader_cfg dl_cfg_small_buffer = {
 	.buf_size = 32,
 };
 
+char app_buf[64];
+struct downloader_cfg dl_cfg_app_buf = {
+	.callback = dl_callback,
+	.buf = dl_buf,
+	.buf_size = sizeof(dl_buf),
+	.buf_get = dl_app_buf_get,
+};
+
 struct downloader_cfg dl_cfg_cb_abort = {
 	.callback = dl_callback_abort,
 	.buf = dl_buf,
@@ -815,6 +824,29 @@ static ssize_t z_impl_zsock_recvfrom_http_header_then_data(
 	return 0;
 }
 
+static ssize_t z_impl_zsock_recvfrom_http_header_then_data_app_buf(
+	int sock, void *buf, size_t max_len, int flags, struct net_sockaddr *src_addr,
+	net_socklen_t *addrlen)
+{
+	TEST_ASSERT_EQUAL(FD, sock);
+
+	switch (z_impl_zsock_recvfrom_fake.call_count) {
+	case 1:
+		TEST_ASSERT_EQUAL_PTR(dl_buf, buf);
+		memcpy(buf, HTTP_HDR_OK, strlen(HTTP_HDR_OK));
+		return strlen(HTTP_HDR_OK);
+	case 2:
+	case 3:
+		/* Payload goes directly to the application buffer */
+		TEST_ASSERT_EQUAL_PTR(app_buf, buf);
+		TEST_ASSERT_EQUAL(sizeof(app_buf), max_len);
+		memset(buf, 23, max_len);
+		return max_len;
+	}
+
+	return 0;
+}
+
 static ssize_t z_impl_zsock_recvfrom_http_partial_header_then_header_with_data(
 	int sock, void *buf, size_t max_len, int flags, struct net_sockaddr *src_addr,
 	net_socklen_t *addrlen)
@@ -1250,6 +1282,14 @@ static int dl_callback(const struct downloader_evt *event)
 	return 0;
 }
 
+static int dl_app_buf_get(void **buf, size_t *len)
+{
+	*buf = app_buf;
+	*len = sizeof(app_buf);
+
+	return 0;
+}
+
 static int dl_callback_abort(const struct downloader_evt *event)
 {
 	TEST_ASSERT(event != NULL);
@@ -1378,6 +1418,39 @@ void test_downloader_get_http(void)
 	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
 }
 
+void test_downloader_get_http_app_buf(void)
+{
+	int err;
+	struct downloader_evt evt;
+
+	err = downloader_init(&dl, &dl_cfg_app_buf);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ipv6_fail_ipv4_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv4;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_http_ipv4_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv4_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_http_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_ok;
+	z_impl_zsock_recvfrom_fake.custom_fake =
+		z_impl_zsock_recvfrom_http_header_then_data_app_buf;
+
+	err = downloader_get(&dl, &dl_host_cfg, HTTP_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	for (int i = 0; i < 2; i++) {
+		evt = dl_wait_for_event(DOWNLOADER_EVT_FRAGMENT, K_SECONDS(3));
+		TEST_ASSERT_TRUE(evt.fragment.app_buf);
+		TEST_ASSERT_EQUAL_PTR(app_buf, evt.fragment.buf);
+		TEST_ASSERT_EQUAL(sizeof(app_buf), evt.fragment.len);
+	}
+
+	evt = dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+}
+
 void test_downloader_get_http_partial_header(void)
 {
 	int err;
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* The other objects of the library are tested without coalescing, so it is enabled
+ * for this file only and the module is built into it.
+ */
+#define CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE 1
+#define CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE_WINDOW_MS 100
+#define CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE_RESOURCES 4
+#define CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE_SIGNAL_STEP 3
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fff.h>
+
+#include "lwm2m_notify_coalesce.c"
+#include "stubs.h"
+
+/* Margin for the system work queue to run the flush */
+#define WINDOW_MARGIN_MS 50
+
+static void coalesce_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	DO_FOREACH_FAKE(RESET_FAKE);
+	FFF_RESET_HISTORY();
+
+	(void)k_work_cancel_delayable(&coalesce_work);
+	memset(entries, 0, sizeof(entries));
+	memset(&stats, 0, sizeof(stats));
+}
+
+ZTEST_SUITE(lwm2m_client_utils_notify_coalesce, NULL, NULL, coalesce_before, NULL, NULL);
+
+ZTEST(lwm2m_client_utils_notify_coalesce, test_window)
+{
+	struct lwm2m_obj_path path = LWM2M_OBJ(4, 0, 9);
+
+	zassert_ok(lwm2m_coalesce_set_u16(&path, 10));
+	zassert_equal(0, lwm2m_set_u16_fake.call_count, "Written before the end of the window");
+
+	k_sleep(K_MSEC(CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE_WINDOW_MS + WINDOW_MARGIN_MS));
+
+	zassert_equal(1, lwm2m_set_u16_fake.call_count, "Not written after the window");
+	zassert_equal(10, lwm2m_set_u16_fake.arg1_val);
+}
+
+ZTEST(lwm2m_client_utils_notify_coalesce, test_step_suppression)
+{
+	struct lwm2m_obj_path path = LWM2M_OBJ(4, 0, 2);
+	struct lwm2m_coalesce_stats coalesce_stats;
+
+	zassert_ok(lwm2m_coalesce_step_set(&path,
+					   CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE_SIGNAL_STEP));
+
+	zassert_ok(lwm2m_coalesce_set_s16(&path, -100));
+	lwm2m_coalesce_flush();
+	zassert_equal(1, lwm2m_set_s16_fake.call_count, "First value not written");
+
+	/* Changes within the step of the reported value are dropped */
+	zassert_ok(lwm2m_coalesce_set_s16(&path, -102));
+	zassert_ok(lwm2m_coalesce_set_s16(&path, -98));
+	lwm2m_coalesce_flush();
+	zassert_equal(1, lwm2m_set_s16_fake.call_count, "Change within the step written");
+
+	zassert_ok(lwm2m_coalesce_set_s16(&path, -103));
+	lwm2m_coalesce_flush();
+	zassert_equal(2, lwm2m_set_s16_fake.call_count, "Change of the step not written");
+	zassert_equal(-103, lwm2m_set_s16_fake.arg1_val);
+
+	lwm2m_coalesce_stats_get(&coalesce_stats);
+	zassert_equal(2, coalesce_stats.suppressed);
+	zassert_equal(2, coalesce_stats.written);
+}
+
+ZTEST(lwm2m_client_utils_notify_coalesce, test_coalescing)
+{
+	struct lwm2m_obj_path cell_id = LWM2M_OBJ(4, 0, 8);
+	struct lwm2m_obj_path mnc = LWM2M_OBJ(4, 0, 9);
+	struct lwm2m_coalesce_stats coalesce_stats;
+
+	zassert_ok(lwm2m_coalesce_set_u32(&cell_id, 1));
+	zassert_ok(lwm2m_coalesce_set_u32(&cell_id, 2));
+	zassert_ok(lwm2m_coalesce_set_u32(&cell_id, 3));
+	zassert_ok(lwm2m_coalesce_set_u16(&mnc, 10));
+	lwm2m_coalesce_flush();
+
+	/* Only the latest value of each resource is written */
+	zassert_equal(1, lwm2m_set_u32_fake.call_count);
+	zassert_equal(3, lwm2m_set_u32_fake.arg1_val);
+	zassert_equal(1, lwm2m_set_u16_fake.call_count);
+
+	lwm2m_coalesce_stats_get(&coalesce_stats);
+	zassert_equal(2, coalesce_stats.coalesced);
+	zassert_equal(2, coalesce_stats.written);
+
+	/* Nothing is pending after the flush */
+	lwm2m_coalesce_flush();
+	zassert_equal(1, lwm2m_set_u32_fake.call_count);
+	zassert_equal(1, lwm2m_set_u16_fake.call_count);
+}
+
+ZTEST(lwm2m_client_utils_notify_coalesce, test_overflow)
+{
+	struct lwm2m_obj_path path = LWM2M_OBJ(10256, 0, 2);
+
+	for (int i = 0; i < CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE_RESOURCES; i++) {
+		path.obj_inst_id = i;
+		zassert_ok(lwm2m_coalesce_step_set(&path, 1));
+	}
+
+	zassert_equal(-ENOMEM, lwm2m_coalesce_step_set(&LWM2M_OBJ(10256, 0, 3), 1));
+
+	/* A resource that does not fit in the table is written immediately */
+	path.obj_inst_id = CONFIG_LWM2M_CLIENT_UTILS_NOTIFY_COALESCE_RESOURCES;
+	zassert_ok(lwm2m_coalesce_set_s32(&path, -80));
+	zassert_equal(1, lwm2m_set_s32_fake.call_count, "Value not written immediately");
+	zassert_equal(-80, lwm2m_set_s32_fake.arg1_val);
+
+	lwm2m_coalesce_flush();
+	zassert_equal(1, lwm2m_set_s32_fake.call_count);
+}
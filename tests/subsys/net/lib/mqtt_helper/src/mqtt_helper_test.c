@@ -85,6 +85,45 @@ static int mqtt_readall_publish_payload_stub(struct mqtt_client *client, uint8_t
 	return 0;
 }
 
+/* QoS 1 message that is queued by the library until acknowledged. */
+static const struct mqtt_publish_param pub_param_queued = {
+	.message = {
+		.payload = {
+			.data = TEST_PAYLOAD,
+			.len = TEST_PAYLOAD_LEN,
+		},
+		.topic = {
+			.topic = {
+				.utf8 = TEST_TOPIC_1,
+				.size = TEST_TOPIC_1_LEN,
+			},
+			.qos = MQTT_QOS_1_AT_LEAST_ONCE,
+		},
+	},
+	.message_id = TEST_MESSAGE_ID,
+};
+
+static int mqtt_publish_replay_calls;
+static bool mqtt_publish_replay_dup;
+
+static int mqtt_publish_replay_stub(struct mqtt_client *client,
+				    const struct mqtt_publish_param *param,
+				    int num_calls)
+{
+	TEST_ASSERT_EQUAL(TEST_MESSAGE_ID, param->message_id);
+	TEST_ASSERT_EQUAL(MQTT_QOS_1_AT_LEAST_ONCE, param->message.topic.qos);
+	TEST_ASSERT_EQUAL(mqtt_publish_replay_dup, param->dup_flag);
+	TEST_ASSERT_EQUAL(TEST_TOPIC_1_LEN, param->message.topic.topic.size);
+	TEST_ASSERT_EQUAL_MEMORY(TEST_TOPIC_1, param->message.topic.topic.utf8,
+				 TEST_TOPIC_1_LEN);
+	TEST_ASSERT_EQUAL(TEST_PAYLOAD_LEN, param->message.payload.len);
+	TEST_ASSERT_EQUAL_MEMORY(TEST_PAYLOAD, param->message.payload.data, TEST_PAYLOAD_LEN);
+
+	mqtt_publish_replay_calls++;
+
+	return 0;
+}
+
 static int poll_stub_pollin(struct zsock_pollfd *fds, int nfds, int timeout, int num_calls)
 {
 	fds[0].revents = fds[0].events & ZSOCK_POLLIN;
@@ -227,6 +266,29 @@ static void cb_on_error(enum mqtt_helper_error error)
 	}
 }
 
+/* Drops the queued messages by deinitializing and initializing the library again. */
+static void publish_queue_clear(void)
+{
+	struct mqtt_helper_cfg cfg = {
+		.cb = {
+			.on_connack = cb_on_connack,
+			.on_disconnect = cb_on_disconnect,
+			.on_publish = cb_on_publish,
+			.on_puback = cb_on_puback,
+			.on_suback = cb_on_suback,
+			.on_error = cb_on_error,
+		},
+	};
+
+	mqtt_state = MQTT_STATE_DISCONNECTED;
+	TEST_ASSERT_EQUAL(0, mqtt_helper_deinit());
+
+	__cmock_mqtt_client_init_Expect(&mqtt_client);
+	TEST_ASSERT_EQUAL(0, mqtt_helper_init(&cfg));
+
+	mqtt_publish_replay_calls = 0;
+}
+
 /* Tests */
 
 void test_mqtt_helper_init_when_unitialized(void)
@@ -523,6 +585,92 @@ void test_mqtt_helper_publish_invalid_message_id(void)
 	TEST_ASSERT_EQUAL(-EINVAL, mqtt_helper_publish(&pub_param_dummy));
 }
 
+void test_mqtt_helper_publish_queued_when_disconnected(void)
+{
+	struct mqtt_publish_param pub_param = pub_param_queued;
+	struct mqtt_helper_stats stats_before;
+	struct mqtt_helper_stats stats_after;
+
+	publish_queue_clear();
+	mqtt_helper_stats_get(&stats_before);
+
+	/* Queued without calling mqtt_publish(). */
+	TEST_ASSERT_EQUAL(0, mqtt_helper_publish(&pub_param));
+
+	__cmock_mqtt_publish_Stub(mqtt_publish_replay_stub);
+	mqtt_publish_replay_dup = false;
+
+	mqtt_state = MQTT_STATE_CONNECTING;
+	send_mqtt_event(MQTT_EVT_CONNACK, MQTT_CONNECTION_ACCEPTED);
+
+	TEST_ASSERT_EQUAL(0, k_sem_take(&connack_success_sem, K_SECONDS(1)));
+	TEST_ASSERT_EQUAL(1, mqtt_publish_replay_calls);
+
+	mqtt_helper_stats_get(&stats_after);
+	TEST_ASSERT_EQUAL(stats_before.replayed_count + 1, stats_after.replayed_count);
+
+	/* Acknowledged message is not sent again after the next CONNACK. */
+	send_mqtt_event(MQTT_EVT_PUBACK, TEST_MESSAGE_ID);
+	TEST_ASSERT_EQUAL(0, k_sem_take(&puback_sem, K_SECONDS(1)));
+
+	mqtt_state = MQTT_STATE_CONNECTING;
+	send_mqtt_event(MQTT_EVT_CONNACK, MQTT_CONNECTION_ACCEPTED);
+
+	TEST_ASSERT_EQUAL(0, k_sem_take(&connack_success_sem, K_SECONDS(1)));
+	TEST_ASSERT_EQUAL(1, mqtt_publish_replay_calls);
+
+	publish_queue_clear();
+}
+
+void test_mqtt_helper_publish_unacked_resent_with_dup_flag(void)
+{
+	struct mqtt_publish_param pub_param = pub_param_queued;
+
+	publish_queue_clear();
+
+	__cmock_mqtt_publish_ExpectAndReturn(&mqtt_client, &pub_param, 0);
+
+	mqtt_state = MQTT_STATE_CONNECTED;
+
+	TEST_ASSERT_EQUAL(0, mqtt_helper_publish(&pub_param));
+
+	/* Connection lost before PUBACK. */
+	send_mqtt_event(MQTT_EVT_DISCONNECT, 0);
+	TEST_ASSERT_EQUAL(0, k_sem_take(&disconnect_sem, K_SECONDS(1)));
+
+	__cmock_mqtt_publish_Stub(mqtt_publish_replay_stub);
+	mqtt_publish_replay_dup = true;
+
+	mqtt_state = MQTT_STATE_CONNECTING;
+	send_mqtt_event(MQTT_EVT_CONNACK, MQTT_CONNECTION_ACCEPTED);
+
+	TEST_ASSERT_EQUAL(0, k_sem_take(&connack_success_sem, K_SECONDS(1)));
+	TEST_ASSERT_EQUAL(1, mqtt_publish_replay_calls);
+
+	publish_queue_clear();
+}
+
+void test_mqtt_helper_publish_queue_full(void)
+{
+	static uint8_t large_payload[CONFIG_MQTT_HELPER_PUBLISH_QUEUE_MSG_SIZE];
+	struct mqtt_publish_param pub_param = pub_param_queued;
+
+	publish_queue_clear();
+
+	for (int i = 0; i < CONFIG_MQTT_HELPER_PUBLISH_QUEUE_LEN; i++) {
+		TEST_ASSERT_EQUAL(0, mqtt_helper_publish(&pub_param));
+	}
+
+	TEST_ASSERT_EQUAL(-ENOMEM, mqtt_helper_publish(&pub_param));
+
+	publish_queue_clear();
+
+	pub_param.message.payload.data = large_payload;
+	pub_param.message.payload.len = sizeof(large_payload);
+
+	TEST_ASSERT_EQUAL(-EMSGSIZE, mqtt_helper_publish(&pub_param));
+}
+
 void test_mqtt_helper_deinit_when_disconnected(void)
 {
 	mqtt_state = MQTT_STATE_DISCONNECTED;
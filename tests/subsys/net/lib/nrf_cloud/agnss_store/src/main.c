@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <nrf_modem_gnss.h>
+#include <date_time.h>
+#include <net/nrf_cloud_agnss.h>
+#include "nrf_cloud_agnss_internal.h"
+#include "nrf_cloud_pgps_utils.h"
+
+#define TEST_TIME_MS 1760000000000LL
+#define MINUTE_MS (60LL * MSEC_PER_SEC)
+#define DAY_MS (24LL * 60LL * MINUTE_MS)
+#define QZSS_FIRST_SV_ID 193
+
+static int64_t test_now;
+static bool test_time_known;
+static int write_count;
+static uint16_t written_types[8];
+static uint8_t written_sv_ids[8];
+
+/* Stand-ins for the modem and date-time libraries, which are not part of the test. */
+int32_t nrf_modem_gnss_agnss_write(void *buf, int32_t buf_len, uint16_t type)
+{
+	ARG_UNUSED(buf_len);
+
+	if (write_count < ARRAY_SIZE(written_types)) {
+		written_types[write_count] = type;
+		if (type == NRF_MODEM_GNSS_AGNSS_GPS_EPHEMERIDES) {
+			written_sv_ids[write_count] =
+				((struct nrf_modem_gnss_agnss_gps_data_ephemeris *)buf)->sv_id;
+		} else if (type == NRF_MODEM_GNSS_AGNSS_GPS_ALMANAC) {
+			written_sv_ids[write_count] =
+				((struct nrf_modem_gnss_agnss_gps_data_almanac *)buf)->sv_id;
+		}
+	}
+	write_count++;
+
+	return 0;
+}
+
+int date_time_now(int64_t *unix_time_ms)
+{
+	if (!test_time_known) {
+		return -ENODATA;
+	}
+
+	*unix_time_ms = test_now;
+
+	return 0;
+}
+
+/* Returns the GPS time in seconds the given time before the current time. */
+static int64_t gps_sec_before(int64_t age_ms)
+{
+	return (test_now - age_ms) / MSEC_PER_SEC - (int64_t)GPS_TO_UNIX_UTC_OFFSET_SECONDS +
+	       (int64_t)GPS_TO_UTC_LEAP_SECONDS;
+}
+
+/* Adds an ephemeris with the reference time toe_age_ms before the current time. */
+static void ephemeris_add(uint8_t sv_id, int64_t toe_age_ms)
+{
+	struct nrf_modem_gnss_agnss_gps_data_ephemeris ephemeris = {
+		.sv_id = sv_id,
+		.toe = (gps_sec_before(toe_age_ms) % SECONDS_PER_WEEK) / 16,
+	};
+
+	nrf_cloud_agnss_store_add(NRF_MODEM_GNSS_AGNSS_GPS_EPHEMERIDES, &ephemeris,
+				  sizeof(ephemeris));
+}
+
+/* Adds an almanac with the reference time toa_age_ms before the current time. */
+static void almanac_add(uint8_t sv_id, int64_t toa_age_ms)
+{
+	int64_t toa = gps_sec_before(toa_age_ms);
+	struct nrf_modem_gnss_agnss_gps_data_almanac almanac = {
+		.sv_id = sv_id,
+		.wn = (toa / SECONDS_PER_WEEK) % 256,
+		.toa = (toa % SECONDS_PER_WEEK) / 4096,
+	};
+
+	nrf_cloud_agnss_store_add(NRF_MODEM_GNSS_AGNSS_GPS_ALMANAC, &almanac, sizeof(almanac));
+}
+
+static void utc_add(void)
+{
+	struct nrf_modem_gnss_agnss_gps_data_utc utc = { .delta_tls = 18 };
+
+	nrf_cloud_agnss_store_add(NRF_MODEM_GNSS_AGNSS_GPS_UTC_PARAMETERS, &utc, sizeof(utc));
+}
+
+static void request_init(struct nrf_modem_gnss_agnss_data_frame *request, uint64_t ephe,
+			 uint64_t alm, uint32_t data_flags)
+{
+	memset(request, 0, sizeof(*request));
+	request->data_flags = data_flags;
+	request->system_count = 1;
+	request->system[0].system_id = NRF_MODEM_GNSS_SYSTEM_GPS;
+	request->system[0].sv_mask_ephe = ephe;
+	request->system[0].sv_mask_alm = alm;
+}
+
+static void agnss_store_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	nrf_cloud_agnss_store_clear();
+
+	test_now = TEST_TIME_MS;
+	test_time_known = true;
+	write_count = 0;
+	memset(written_types, 0, sizeof(written_types));
+	memset(written_sv_ids, 0, sizeof(written_sv_ids));
+}
+
+ZTEST(nrf_cloud_agnss_store, test_inject_removes_stored_data_from_request)
+{
+	struct nrf_modem_gnss_agnss_data_frame request;
+	int ret;
+
+	ephemeris_add(3, 0);
+	almanac_add(5, 0);
+	utc_add();
+
+	request_init(&request, BIT64(2) | BIT64(3), BIT64(4),
+		     NRF_MODEM_GNSS_AGNSS_GPS_UTC_REQUEST |
+		     NRF_MODEM_GNSS_AGNSS_KLOBUCHAR_REQUEST |
+		     NRF_MODEM_GNSS_AGNSS_GPS_SYS_TIME_AND_SV_TOW_REQUEST);
+
+	ret = nrf_cloud_agnss_store_inject(&request);
+
+	zassert_equal(ret, 3, "Unexpected number of injected elements: %d", ret);
+	zassert_equal(write_count, 3);
+	zassert_equal(written_types[0], NRF_MODEM_GNSS_AGNSS_GPS_EPHEMERIDES);
+	zassert_equal(written_sv_ids[0], 3);
+	zassert_equal(written_types[1], NRF_MODEM_GNSS_AGNSS_GPS_ALMANAC);
+	zassert_equal(written_sv_ids[1], 5);
+	zassert_equal(written_types[2], NRF_MODEM_GNSS_AGNSS_GPS_UTC_PARAMETERS);
+
+	/* Only the data that was not stored remains in the request */
+	zassert_equal(request.system[0].sv_mask_ephe, BIT64(3));
+	zassert_equal(request.system[0].sv_mask_alm, 0);
+	zassert_equal(request.data_flags,
+		      NRF_MODEM_GNSS_AGNSS_KLOBUCHAR_REQUEST |
+		      NRF_MODEM_GNSS_AGNSS_GPS_SYS_TIME_AND_SV_TOW_REQUEST);
+}
+
+ZTEST(nrf_cloud_agnss_store, test_expired_ephemeris_not_injected)
+{
+	struct nrf_modem_gnss_agnss_data_frame request;
+	int ret;
+
+	ephemeris_add(1, 0);
+	almanac_add(1, 0);
+
+	test_now += (CONFIG_NRF_CLOUD_AGNSS_STORE_EPHEMERIS_VALIDITY + 1) * MINUTE_MS;
+	request_init(&request, BIT64(0), BIT64(0), 0);
+
+	ret = nrf_cloud_agnss_store_inject(&request);
+
+	/* The almanac is valid much longer than the ephemeris */
+	zassert_equal(ret, 1, "Unexpected number of injected elements: %d", ret);
+	zassert_equal(written_types[0], NRF_MODEM_GNSS_AGNSS_GPS_ALMANAC);
+	zassert_equal(request.system[0].sv_mask_ephe, BIT64(0));
+	zassert_equal(request.system[0].sv_mask_alm, 0);
+}
+
+ZTEST(nrf_cloud_agnss_store, test_late_ephemeris_expires_from_toe)
+{
+	struct nrf_modem_gnss_agnss_data_frame request;
+	int ret;
+
+	/* Received long after its reference time, the ephemeris is valid only briefly */
+	ephemeris_add(2, (CONFIG_NRF_CLOUD_AGNSS_STORE_EPHEMERIS_VALIDITY - 10) * MINUTE_MS);
+
+	request_init(&request, BIT64(1), 0, 0);
+	ret = nrf_cloud_agnss_store_inject(&request);
+	zassert_equal(ret, 1, "Unexpected number of injected elements: %d", ret);
+
+	test_now += 20 * MINUTE_MS;
+
+	request_init(&request, BIT64(1), 0, 0);
+	ret = nrf_cloud_agnss_store_inject(&request);
+	zassert_equal(ret, 0, "Ephemeris injected after its validity from toe");
+	zassert_equal(request.system[0].sv_mask_ephe, BIT64(1));
+}
+
+ZTEST(nrf_cloud_agnss_store, test_old_almanac_not_injected)
+{
+	struct nrf_modem_gnss_agnss_data_frame request;
+	int ret;
+
+	/* Validity is counted from the almanac reference time, not the reception */
+	almanac_add(1, (CONFIG_NRF_CLOUD_AGNSS_STORE_ALMANAC_VALIDITY + 1) * DAY_MS);
+	almanac_add(2, (CONFIG_NRF_CLOUD_AGNSS_STORE_ALMANAC_VALIDITY - 1) * DAY_MS);
+
+	request_init(&request, 0, BIT64(0) | BIT64(1), 0);
+	ret = nrf_cloud_agnss_store_inject(&request);
+
+	zassert_equal(ret, 1, "Unexpected number of injected elements: %d", ret);
+	zassert_equal(written_sv_ids[0], 2);
+	zassert_equal(request.system[0].sv_mask_alm, BIT64(0));
+}
+
+ZTEST(nrf_cloud_agnss_store, test_newer_data_replaces_stored_data)
+{
+	struct nrf_modem_gnss_agnss_data_frame request;
+	int ret;
+
+	ephemeris_add(7, 0);
+	test_now += CONFIG_NRF_CLOUD_AGNSS_STORE_EPHEMERIS_VALIDITY * MINUTE_MS / 2;
+	ephemeris_add(7, 0);
+	test_now += CONFIG_NRF_CLOUD_AGNSS_STORE_EPHEMERIS_VALIDITY * MINUTE_MS / 2 + MINUTE_MS;
+
+	request_init(&request, BIT64(6), 0, 0);
+
+	ret = nrf_cloud_agnss_store_inject(&request);
+
+	zassert_equal(ret, 1, "Unexpected number of injected elements: %d", ret);
+	zassert_equal(request.system[0].sv_mask_ephe, 0);
+}
+
+ZTEST(nrf_cloud_agnss_store, test_qzss_data_not_stored)
+{
+	struct nrf_modem_gnss_agnss_data_frame request;
+	int ret;
+
+	ephemeris_add(QZSS_FIRST_SV_ID, 0);
+
+	request_init(&request, 0, 0, 0);
+	request.system_count = 2;
+	request.system[1].system_id = NRF_MODEM_GNSS_SYSTEM_QZSS;
+	request.system[1].sv_mask_ephe = BIT64(0);
+
+	ret = nrf_cloud_agnss_store_inject(&request);
+
+	zassert_equal(ret, 0, "Unexpected number of injected elements: %d", ret);
+	zassert_equal(write_count, 0);
+	zassert_equal(request.system[1].sv_mask_ephe, BIT64(0));
+}
+
+ZTEST(nrf_cloud_agnss_store, test_unknown_time)
+{
+	struct nrf_modem_gnss_agnss_data_frame request;
+	int ret;
+
+	ephemeris_add(1, 0);
+	test_time_known = false;
+
+	request_init(&request, BIT64(0), 0, 0);
+
+	ret = nrf_cloud_agnss_store_inject(&request);
+
+	zassert_equal(ret, -ENODATA, "Unexpected return value: %d", ret);
+	zassert_equal(write_count, 0);
+	zassert_equal(request.system[0].sv_mask_ephe, BIT64(0));
+}
+
+ZTEST(nrf_cloud_agnss_store, test_clear)
+{
+	struct nrf_modem_gnss_agnss_data_frame request;
+	int ret;
+
+	ephemeris_add(1, 0);
+	utc_add();
+	nrf_cloud_agnss_store_clear();
+
+	request_init(&request, BIT64(0), 0, NRF_MODEM_GNSS_AGNSS_GPS_UTC_REQUEST);
+
+	ret = nrf_cloud_agnss_store_inject(&request);
+
+	zassert_equal(ret, 0, "Unexpected number of injected elements: %d", ret);
+	zassert_equal(write_count, 0);
+}
+
+ZTEST(nrf_cloud_agnss_store, test_inject_null_request)
+{
+	zassert_equal(nrf_cloud_agnss_store_inject(NULL), -EINVAL);
+}
+
+ZTEST_SUITE(nrf_cloud_agnss_store, NULL, NULL, agnss_store_before, NULL, NULL);
@@ -0,0 +1,385 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <limits.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/coap.h>
+#include <zephyr/net/coap_client.h>
+#include <net/nrf_cloud_coap.h>
+#include "nrf_cloud_coap_transport.h"
+
+#define NSTART CONFIG_NRF_CLOUD_COAP_ASYNC_NSTART
+#define QUEUE_SIZE CONFIG_NRF_CLOUD_COAP_ASYNC_QUEUE_SIZE
+
+#define SERVER_PORT 5683
+/* Time the server stand-in waits before responding, which simulates the round-trip time. */
+#define SERVER_RTT_MS 100
+#define SERVER_STACK_SIZE 2048
+#define SERVER_PRIORITY 5
+#define MAX_PENDING_RESPONSES 16
+
+/* The server responds to this resource with 4.00 Bad Request. */
+#define BAD_RSC "bad"
+/* The server does not respond to this resource. */
+#define SILENT_RSC "silent"
+#define MSG_RSC "msg/d2c"
+
+#define TEST_REQUESTS 16
+#define TEST_MSG "{\"appId\":\"TEMP\",\"messageType\":\"DATA\",\"data\":\"21.5\"}"
+
+struct pending_response {
+	int64_t due;
+	struct sockaddr addr;
+	socklen_t addr_len;
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	uint8_t tkl;
+	uint16_t id;
+	uint8_t type;
+	uint8_t code;
+	bool used;
+};
+
+struct req_ctx {
+	int64_t start;
+	int64_t latency;
+	int result;
+};
+
+static struct pending_response responses[MAX_PENDING_RESPONSES];
+/* Requests received by the server and not yet responded to. */
+static atomic_t outstanding;
+static atomic_t max_outstanding;
+static uint8_t last_payload[256];
+static size_t last_payload_len;
+static int server_sock = -1;
+
+static struct nrf_cloud_coap_client test_client;
+static struct req_ctx ctxs[TEST_REQUESTS];
+
+static K_SEM_DEFINE(done_sem, 0, K_SEM_MAX_LIMIT);
+static K_THREAD_STACK_DEFINE(server_stack, SERVER_STACK_SIZE);
+static struct k_thread server_thread;
+
+/* Stand-in for the function of the transport, which is not part of the test. */
+int nrf_cloud_coap_transport_request_init(struct coap_client_request *request,
+					  const char *resource, const char *query,
+					  enum coap_content_format fmt_in,
+					  bool response_expected, void *user)
+{
+	ARG_UNUSED(query);
+	ARG_UNUSED(fmt_in);
+	ARG_UNUSED(response_expected);
+	ARG_UNUSED(user);
+
+	strncpy(request->path, resource, sizeof(request->path) - 1);
+	request->num_options = 0;
+
+	return 0;
+}
+
+/* Stand-in for the function of the transport, which uses the internal client. */
+int nrf_cloud_coap_async_request(const struct nrf_cloud_coap_async_req *req)
+{
+	return nrf_cloud_coap_transport_async_submit(&test_client, req);
+}
+
+static bool path_is(const struct coap_option *path, const char *segment)
+{
+	return (path->len == strlen(segment)) && !memcmp(path->value, segment, path->len);
+}
+
+static void server_request_handle(uint8_t *buf, size_t len, const struct sockaddr *addr,
+				  socklen_t addr_len)
+{
+	struct pending_response *resp = NULL;
+	struct coap_packet pkt;
+	struct coap_option path;
+	bool bad_request;
+	const uint8_t *payload;
+	uint16_t payload_len;
+	uint8_t type;
+	atomic_val_t cur;
+	atomic_val_t max;
+
+	if (coap_packet_parse(&pkt, buf, len, NULL, 0) < 0) {
+		return;
+	}
+
+	type = coap_header_get_type(&pkt);
+	if ((type != COAP_TYPE_CON) && (type != COAP_TYPE_NON_CON)) {
+		return;
+	}
+
+	if (coap_find_options(&pkt, COAP_OPTION_URI_PATH, &path, 1) != 1) {
+		return;
+	}
+
+	if (path_is(&path, SILENT_RSC)) {
+		return;
+	}
+	bad_request = path_is(&path, BAD_RSC);
+
+	payload = coap_packet_get_payload(&pkt, &payload_len);
+	last_payload_len = MIN(payload_len, sizeof(last_payload));
+	if (payload) {
+		memcpy(last_payload, payload, last_payload_len);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(responses); i++) {
+		if (!responses[i].used) {
+			resp = &responses[i];
+			break;
+		}
+	}
+	if (!resp) {
+		/* Too many requests in flight, handled as a lost request. */
+		return;
+	}
+
+	resp->due = k_uptime_get() + SERVER_RTT_MS;
+	memcpy(&resp->addr, addr, addr_len);
+	resp->addr_len = addr_len;
+	resp->tkl = coap_header_get_token(&pkt, resp->token);
+	resp->id = coap_header_get_id(&pkt);
+	resp->type = type;
+	resp->code = bad_request ? COAP_RESPONSE_CODE_BAD_REQUEST : COAP_RESPONSE_CODE_CHANGED;
+	resp->used = true;
+
+	cur = atomic_inc(&outstanding) + 1;
+	do {
+		max = atomic_get(&max_outstanding);
+	} while ((cur > max) && !atomic_cas(&max_outstanding, max, cur));
+}
+
+static void server_responses_send(void)
+{
+	uint8_t buf[32];
+	struct coap_packet pkt;
+	int64_t now = k_uptime_get();
+
+	for (size_t i = 0; i < ARRAY_SIZE(responses); i++) {
+		struct pending_response *resp = &responses[i];
+
+		if (!resp->used || (resp->due > now)) {
+			continue;
+		}
+
+		resp->used = false;
+		atomic_dec(&outstanding);
+
+		if (coap_packet_init(&pkt, buf, sizeof(buf), COAP_VERSION_1,
+				     (resp->type == COAP_TYPE_CON) ? COAP_TYPE_ACK : COAP_TYPE_NON_CON,
+				     resp->tkl, resp->token, resp->code,
+				     (resp->type == COAP_TYPE_CON) ? resp->id : coap_next_id()) < 0) {
+			continue;
+		}
+
+		(void)zsock_sendto(server_sock, pkt.data, pkt.offset, 0, &resp->addr,
+				   resp->addr_len);
+	}
+}
+
+static void server_fn(void *p1, void *p2, void *p3)
+{
+	uint8_t buf[512];
+	struct sockaddr addr;
+	socklen_t addr_len;
+	struct zsock_pollfd fds = {
+		.fd = server_sock,
+		.events = ZSOCK_POLLIN
+	};
+
+	while (true) {
+		if ((zsock_poll(&fds, 1, 5) > 0) && (fds.revents & ZSOCK_POLLIN)) {
+			int len;
+
+			addr_len = sizeof(addr);
+			len = zsock_recvfrom(server_sock, buf, sizeof(buf), 0, &addr, &addr_len);
+			if (len > 0) {
+				server_request_handle(buf, len, &addr, addr_len);
+			}
+		}
+
+		server_responses_send();
+	}
+}
+
+static void done_cb(int result, void *user)
+{
+	struct req_ctx *ctx = user;
+
+	ctx->result = result;
+	ctx->latency = k_uptime_get() - ctx->start;
+	k_sem_give(&done_sem);
+}
+
+static int request_send(const char *resource, bool reliable, struct req_ctx *ctx)
+{
+	const struct nrf_cloud_coap_async_req req = {
+		.method = COAP_METHOD_POST,
+		.resource = resource,
+		.buf = (const uint8_t *)TEST_MSG,
+		.len = sizeof(TEST_MSG) - 1,
+		.fmt_out = COAP_CONTENT_FORMAT_APP_JSON,
+		.reliable = reliable,
+		.done_cb = done_cb,
+		.user = ctx
+	};
+
+	ctx->start = k_uptime_get();
+	ctx->result = INT_MIN;
+
+	return nrf_cloud_coap_async_request(&req);
+}
+
+static void requests_wait(size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		zassert_ok(k_sem_take(&done_sem, K_SECONDS(10)), "Request not completed");
+	}
+}
+
+static void *suite_setup(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SERVER_PORT)
+	};
+
+	zassert_equal(zsock_inet_pton(AF_INET, "127.0.0.1", &addr.sin_addr), 1);
+
+	server_sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	zassert_true(server_sock >= 0);
+	zassert_ok(zsock_bind(server_sock, (struct sockaddr *)&addr, sizeof(addr)));
+
+	k_thread_create(&server_thread, server_stack, K_THREAD_STACK_SIZEOF(server_stack),
+			server_fn, NULL, NULL, NULL, SERVER_PRIORITY, 0, K_NO_WAIT);
+
+	test_client.sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	zassert_true(test_client.sock >= 0);
+	zassert_ok(zsock_connect(test_client.sock, (struct sockaddr *)&addr, sizeof(addr)));
+	zassert_ok(coap_client_init(&test_client.cc, NULL));
+	test_client.initialized = true;
+	test_client.authenticated = true;
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_sem_reset(&done_sem);
+	atomic_set(&max_outstanding, 0);
+}
+
+ZTEST(nrf_cloud_coap_async, test_pipelined_throughput)
+{
+	const int64_t rounds = DIV_ROUND_UP(TEST_REQUESTS, NSTART);
+	int64_t latency_sum = 0;
+	int64_t start;
+	int64_t elapsed;
+	int err;
+
+	start = k_uptime_get();
+
+	for (size_t i = 0; i < TEST_REQUESTS; i++) {
+		/* The queue holds fewer requests than the test sends. */
+		while ((err = request_send(MSG_RSC, true, &ctxs[i])) == -ENOBUFS) {
+			k_sleep(K_MSEC(10));
+		}
+		zassert_ok(err);
+	}
+
+	requests_wait(TEST_REQUESTS);
+	elapsed = k_uptime_get() - start;
+
+	for (size_t i = 0; i < TEST_REQUESTS; i++) {
+		zassert_ok(ctxs[i].result, "Request %zu failed: %d", i, ctxs[i].result);
+		latency_sum += ctxs[i].latency;
+	}
+
+	TC_PRINT("NSTART %d: %d requests in %lld ms, %lld requests/s, average latency %lld ms\n",
+		 NSTART, TEST_REQUESTS, (long long)elapsed,
+		 (long long)(TEST_REQUESTS * MSEC_PER_SEC / elapsed),
+		 (long long)(latency_sum / TEST_REQUESTS));
+
+	zassert_equal(atomic_get(&max_outstanding), NSTART,
+		      "%ld requests in flight", atomic_get(&max_outstanding));
+	zassert_true(elapsed >= (rounds * SERVER_RTT_MS), "NSTART not respected");
+	zassert_true(elapsed < ((rounds + 2) * SERVER_RTT_MS), "Requests not pipelined");
+}
+
+ZTEST(nrf_cloud_coap_async, test_queue_full)
+{
+	for (size_t i = 0; i < QUEUE_SIZE; i++) {
+		zassert_ok(request_send(MSG_RSC, true, &ctxs[i]));
+	}
+
+	zassert_equal(request_send(MSG_RSC, true, &ctxs[QUEUE_SIZE]), -ENOBUFS);
+
+	requests_wait(QUEUE_SIZE);
+
+	/* A slot is free again. */
+	zassert_ok(request_send(MSG_RSC, true, &ctxs[0]));
+	requests_wait(1);
+}
+
+ZTEST(nrf_cloud_coap_async, test_results)
+{
+	zassert_ok(request_send(BAD_RSC, true, &ctxs[0]));
+	requests_wait(1);
+	zassert_equal(ctxs[0].result, COAP_RESPONSE_CODE_BAD_REQUEST);
+
+	zassert_ok(request_send(MSG_RSC, false, &ctxs[0]));
+	requests_wait(1);
+	zassert_ok(ctxs[0].result);
+	zassert_true(ctxs[0].latency < CONFIG_NRF_CLOUD_COAP_ASYNC_NON_TIMEOUT_MS);
+
+	/* A NON request without a response completes after the timeout. */
+	zassert_ok(request_send(SILENT_RSC, false, &ctxs[0]));
+	requests_wait(1);
+	zassert_ok(ctxs[0].result);
+	zassert_true(ctxs[0].latency >= CONFIG_NRF_CLOUD_COAP_ASYNC_NON_TIMEOUT_MS);
+
+	zassert_equal(nrf_cloud_coap_async_request(NULL), -EINVAL);
+}
+
+ZTEST(nrf_cloud_coap_async, test_batch)
+{
+	static const char expected[] = "[" TEST_MSG "," TEST_MSG "]";
+	struct nrf_cloud_coap_batch batch;
+	char buf[2 * sizeof(TEST_MSG) + 1];
+	struct req_ctx *ctx = &ctxs[0];
+
+	zassert_equal(nrf_cloud_coap_batch_init(&batch, buf, 1), -EINVAL);
+	zassert_ok(nrf_cloud_coap_batch_init(&batch, buf, sizeof(buf)));
+	zassert_equal(nrf_cloud_coap_batch_send(&batch, true, done_cb, ctx), -ENODATA);
+
+	zassert_ok(nrf_cloud_coap_batch_json_add(&batch, TEST_MSG));
+	zassert_ok(nrf_cloud_coap_batch_json_add(&batch, TEST_MSG));
+	zassert_equal(nrf_cloud_coap_batch_json_add(&batch, TEST_MSG), -ENOMEM);
+	zassert_equal(batch.count, 2);
+
+	ctx->start = k_uptime_get();
+	zassert_ok(nrf_cloud_coap_batch_send(&batch, true, done_cb, ctx));
+	zassert_equal(nrf_cloud_coap_batch_json_add(&batch, TEST_MSG), -EBUSY);
+	zassert_equal(nrf_cloud_coap_batch_send(&batch, true, done_cb, ctx), -EBUSY);
+
+	requests_wait(1);
+	zassert_ok(ctx->result);
+	zassert_equal(last_payload_len, sizeof(expected) - 1);
+	zassert_mem_equal(last_payload, expected, sizeof(expected) - 1);
+
+	/* The batch can be reused once sent. */
+	zassert_ok(nrf_cloud_coap_batch_init(&batch, buf, sizeof(buf)));
+	zassert_ok(nrf_cloud_coap_batch_json_add(&batch, TEST_MSG));
+}
+
+ZTEST_SUITE(nrf_cloud_coap_async, NULL, suite_setup, before, NULL, NULL);
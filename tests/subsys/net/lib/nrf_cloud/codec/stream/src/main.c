@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Unit tests and benchmark for the streaming nRF Cloud message codec in
+ * nrf_cloud_msg_stream.h.
+ *
+ * The JSON output is compared with the output of cJSON for the same message,
+ * because the streaming encoder replaces cJSON trees for these messages.
+ * The benchmark counts heap allocations and cycles per message for both.
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+#include <net/nrf_cloud_defs.h>
+#include <cJSON.h>
+#include <stdlib.h>
+#include <string.h>
+#include "nrf_cloud_msg_stream.h"
+
+#define BENCH_ITERATIONS 200
+#define TEST_APP_ID "TEMP"
+#define TEST_TS 1700000000000LL
+
+static size_t alloc_count;
+
+static void *counting_malloc(size_t size)
+{
+	alloc_count++;
+	return malloc(size);
+}
+
+static void counting_free(void *ptr)
+{
+	free(ptr);
+}
+
+static void *suite_setup(void)
+{
+	cJSON_Hooks hooks = {
+		.malloc_fn = counting_malloc,
+		.free_fn = counting_free,
+	};
+
+	cJSON_InitHooks(&hooks);
+
+	return NULL;
+}
+
+/* Device message as sent by the nRF Cloud CoAP library, built with cJSON. */
+static char *cjson_msg_encode(double val)
+{
+	cJSON *root = cJSON_CreateObject();
+	cJSON *msg = cJSON_AddObjectToObject(root, NRF_CLOUD_REST_MSG_KEY);
+	char *out;
+
+	cJSON_AddStringToObject(msg, NRF_CLOUD_JSON_APPID_KEY, TEST_APP_ID);
+	cJSON_AddStringToObject(msg, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+				NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	cJSON_AddNumberToObject(msg, NRF_CLOUD_MSG_TIMESTAMP_KEY, TEST_TS);
+	cJSON_AddNumberToObject(msg, NRF_CLOUD_JSON_DATA_KEY, val);
+
+	out = cJSON_PrintUnformatted(root);
+	cJSON_Delete(root);
+
+	return out;
+}
+
+/* The same message, built with the streaming encoder. */
+static int stream_msg_encode(double val, char *buf, size_t size, size_t *len)
+{
+	struct nrf_cloud_msg_stream s;
+
+	nrf_cloud_msg_stream_init(&s, NRF_CLOUD_MSG_STREAM_JSON, buf, size);
+	(void)nrf_cloud_msg_stream_obj_start(&s, NULL);
+	(void)nrf_cloud_msg_stream_msg_start(&s, NRF_CLOUD_REST_MSG_KEY, TEST_APP_ID,
+					     NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	(void)nrf_cloud_msg_stream_int_add(&s, NRF_CLOUD_MSG_TIMESTAMP_KEY, TEST_TS);
+	(void)nrf_cloud_msg_stream_num_add(&s, NRF_CLOUD_JSON_DATA_KEY, val);
+	(void)nrf_cloud_msg_stream_obj_end(&s);
+	(void)nrf_cloud_msg_stream_obj_end(&s);
+
+	return nrf_cloud_msg_stream_finish(&s, len);
+}
+
+ZTEST(nrf_cloud_msg_stream, test_json_matches_cjson)
+{
+	static const double values[] = {
+		0, -1, 23.4, 0.1, -273.15, 1e-7, 123456789012.5, 2147483648.0, 1.0 / 3,
+	};
+	char buf[128];
+	size_t len;
+
+	for (size_t i = 0; i < ARRAY_SIZE(values); i++) {
+		char *expected = cjson_msg_encode(values[i]);
+
+		zassert_not_null(expected);
+		zassert_ok(stream_msg_encode(values[i], buf, sizeof(buf), &len));
+		zassert_equal(len, strlen(expected));
+		zassert_str_equal(buf, expected);
+		cJSON_free(expected);
+	}
+}
+
+ZTEST(nrf_cloud_msg_stream, test_json_string_escaping)
+{
+	const char *str = "\"quoted\"\\\n\t\x01";
+	struct nrf_cloud_msg_stream s;
+	char buf[64];
+	cJSON *root = cJSON_CreateObject();
+	char *expected;
+
+	cJSON_AddStringToObject(root, NRF_CLOUD_JSON_DATA_KEY, str);
+	expected = cJSON_PrintUnformatted(root);
+	cJSON_Delete(root);
+
+	nrf_cloud_msg_stream_init(&s, NRF_CLOUD_MSG_STREAM_JSON, buf, sizeof(buf));
+	(void)nrf_cloud_msg_stream_obj_start(&s, NULL);
+	(void)nrf_cloud_msg_stream_str_add(&s, NRF_CLOUD_JSON_DATA_KEY, str);
+	(void)nrf_cloud_msg_stream_obj_end(&s);
+	zassert_ok(nrf_cloud_msg_stream_finish(&s, NULL));
+	zassert_str_equal(buf, expected);
+	cJSON_free(expected);
+}
+
+ZTEST(nrf_cloud_msg_stream, test_json_nested)
+{
+	struct nrf_cloud_msg_stream s;
+	char buf[64];
+
+	nrf_cloud_msg_stream_init(&s, NRF_CLOUD_MSG_STREAM_JSON, buf, sizeof(buf));
+	(void)nrf_cloud_msg_stream_obj_start(&s, NULL);
+	(void)nrf_cloud_msg_stream_arr_start(&s, "a");
+	(void)nrf_cloud_msg_stream_bool_add(&s, NULL, true);
+	(void)nrf_cloud_msg_stream_int_add(&s, NULL, -5);
+	(void)nrf_cloud_msg_stream_obj_start(&s, NULL);
+	(void)nrf_cloud_msg_stream_obj_end(&s);
+	(void)nrf_cloud_msg_stream_arr_end(&s);
+	(void)nrf_cloud_msg_stream_bool_add(&s, "b", false);
+	(void)nrf_cloud_msg_stream_obj_end(&s);
+	zassert_ok(nrf_cloud_msg_stream_finish(&s, NULL));
+	zassert_str_equal(buf, "{\"a\":[true,-5,{}],\"b\":false}");
+}
+
+ZTEST(nrf_cloud_msg_stream, test_cbor)
+{
+	static const uint8_t expected[] = {
+		0xa3, 0x65, 'a', 'p', 'p', 'I', 'd', 0x64, 'T', 'E', 'M', 'P',
+		0x64, 'd', 'a', 't', 'a', 0xfb, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x62, 't', 's', 0x1b, 0x00, 0x00, 0x01, 0x8b, 0xcf, 0xe5,
+		0x68, 0x00,
+	};
+	struct nrf_cloud_msg_stream s;
+	uint8_t buf[64];
+	size_t len;
+
+	nrf_cloud_msg_stream_init(&s, NRF_CLOUD_MSG_STREAM_CBOR, buf, sizeof(buf));
+	(void)nrf_cloud_msg_stream_msg_start(&s, NULL, TEST_APP_ID, NULL);
+	(void)nrf_cloud_msg_stream_num_add(&s, NRF_CLOUD_JSON_DATA_KEY, 1.5);
+	(void)nrf_cloud_msg_stream_int_add(&s, NRF_CLOUD_MSG_TIMESTAMP_KEY, TEST_TS);
+	(void)nrf_cloud_msg_stream_obj_end(&s);
+	zassert_ok(nrf_cloud_msg_stream_finish(&s, &len));
+	zassert_equal(len, sizeof(expected));
+	zassert_mem_equal(buf, expected, sizeof(expected));
+}
+
+ZTEST(nrf_cloud_msg_stream, test_cbor_container_size)
+{
+	struct nrf_cloud_msg_stream s;
+	uint8_t buf[600];
+	size_t len;
+
+	/* More than 23 items need a longer header, which is inserted at the end. */
+	nrf_cloud_msg_stream_init(&s, NRF_CLOUD_MSG_STREAM_CBOR, buf, sizeof(buf));
+	(void)nrf_cloud_msg_stream_arr_start(&s, NULL);
+	for (int i = 0; i < 30; i++) {
+		(void)nrf_cloud_msg_stream_int_add(&s, NULL, i);
+	}
+	(void)nrf_cloud_msg_stream_arr_end(&s);
+	zassert_ok(nrf_cloud_msg_stream_finish(&s, &len));
+	zassert_equal(len, 2 + 24 + 2 * 6);
+	zassert_equal(buf[0], 0x98);
+	zassert_equal(buf[1], 30);
+	zassert_equal(buf[2], 0x00);
+	zassert_equal(buf[len - 2], 0x18);
+	zassert_equal(buf[len - 1], 29);
+
+	nrf_cloud_msg_stream_init(&s, NRF_CLOUD_MSG_STREAM_CBOR, buf, sizeof(buf));
+	(void)nrf_cloud_msg_stream_arr_start(&s, NULL);
+	for (int i = 0; i < 256; i++) {
+		(void)nrf_cloud_msg_stream_bool_add(&s, NULL, true);
+	}
+	(void)nrf_cloud_msg_stream_arr_end(&s);
+	zassert_equal(nrf_cloud_msg_stream_finish(&s, NULL), -E2BIG);
+}
+
+ZTEST(nrf_cloud_msg_stream, test_length_only)
+{
+	char buf[128];
+	size_t needed;
+	size_t len;
+
+	/* Without a buffer, only the length is computed. */
+	zassert_ok(stream_msg_encode(23.4, NULL, 0, &needed));
+	zassert_ok(stream_msg_encode(23.4, buf, sizeof(buf), &len));
+	zassert_equal(needed, len);
+
+	/* The needed length is also known when the buffer is too small. */
+	zassert_equal(stream_msg_encode(23.4, buf, 10, &len), -ENOMEM);
+	zassert_equal(needed, len);
+}
+
+ZTEST(nrf_cloud_msg_stream, test_invalid)
+{
+	struct nrf_cloud_msg_stream s;
+	char buf[32];
+
+	/* Missing key in an object. */
+	nrf_cloud_msg_stream_init(&s, NRF_CLOUD_MSG_STREAM_JSON, buf, sizeof(buf));
+	(void)nrf_cloud_msg_stream_obj_start(&s, NULL);
+	zassert_equal(nrf_cloud_msg_stream_int_add(&s, NULL, 1), -EINVAL);
+
+	/* Key in an array. */
+	nrf_cloud_msg_stream_init(&s, NRF_CLOUD_MSG_STREAM_JSON, buf, sizeof(buf));
+	(void)nrf_cloud_msg_stream_arr_start(&s, NULL);
+	zassert_equal(nrf_cloud_msg_stream_int_add(&s, "a", 1), -EINVAL);
+
+	/* Object not ended. */
+	nrf_cloud_msg_stream_init(&s, NRF_CLOUD_MSG_STREAM_JSON, buf, sizeof(buf));
+	(void)nrf_cloud_msg_stream_obj_start(&s, NULL);
+	zassert_equal(nrf_cloud_msg_stream_finish(&s, NULL), -EINVAL);
+
+	/* Mismatched end. */
+	nrf_cloud_msg_stream_init(&s, NRF_CLOUD_MSG_STREAM_JSON, buf, sizeof(buf));
+	(void)nrf_cloud_msg_stream_obj_start(&s, NULL);
+	zassert_equal(nrf_cloud_msg_stream_arr_end(&s), -EINVAL);
+}
+
+ZTEST(nrf_cloud_msg_stream, test_json_get)
+{
+	const char *json = "{\"data\":{\"appId\":\"X\",\"a\":[1,\"}\"]}, \"appId\" : \"DEVICE\","
+			   "\"n\":-1.5e3,\"esc\":\"a\\\"b\"}";
+	const size_t json_len = strlen(json);
+	const char *str;
+	size_t str_len;
+	double num;
+
+	/* Keys in nested objects are skipped. */
+	zassert_ok(nrf_cloud_msg_stream_json_str_get(json, json_len, NRF_CLOUD_JSON_APPID_KEY,
+						     &str, &str_len));
+	zassert_equal(str_len, strlen("DEVICE"));
+	zassert_mem_equal(str, "DEVICE", str_len);
+
+	zassert_ok(nrf_cloud_msg_stream_json_str_get(json, json_len, "esc", &str, &str_len));
+	zassert_equal(str_len, 4);
+
+	zassert_ok(nrf_cloud_msg_stream_json_num_get(json, json_len, "n", &num));
+	zassert_equal(num, -1500.0);
+
+	zassert_equal(nrf_cloud_msg_stream_json_str_get(json, json_len, "x", &str, &str_len),
+		      -ENOENT);
+	zassert_equal(nrf_cloud_msg_stream_json_str_get(json, json_len, "n", &str, &str_len),
+		      -ENOMSG);
+	zassert_equal(nrf_cloud_msg_stream_json_num_get(json, json_len, "data", &num), -ENOMSG);
+
+	/* Truncated message. */
+	zassert_equal(nrf_cloud_msg_stream_json_str_get(json, 30, "n", &str, &str_len),
+		      -EBADMSG);
+	zassert_equal(nrf_cloud_msg_stream_json_str_get("[]", 2, "n", &str, &str_len),
+		      -EBADMSG);
+}
+
+ZTEST(nrf_cloud_msg_stream, test_benchmark)
+{
+	char buf[128];
+	timing_t start;
+	timing_t end;
+	uint64_t cjson_cycles;
+	uint64_t stream_cycles;
+	size_t cjson_allocs;
+	size_t stream_allocs;
+	size_t len;
+
+	timing_init();
+	timing_start();
+
+	alloc_count = 0;
+	start = timing_counter_get();
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		char *out = cjson_msg_encode(i * 0.5);
+
+		zassert_not_null(out);
+		memcpy(buf, out, MIN(strlen(out) + 1, sizeof(buf)));
+		cJSON_free(out);
+	}
+	end = timing_counter_get();
+	cjson_cycles = timing_cycles_get(&start, &end);
+	cjson_allocs = alloc_count;
+
+	alloc_count = 0;
+	start = timing_counter_get();
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		zassert_ok(stream_msg_encode(i * 0.5, buf, sizeof(buf), &len));
+	}
+	end = timing_counter_get();
+	stream_cycles = timing_cycles_get(&start, &end);
+	stream_allocs = alloc_count;
+
+	timing_stop();
+
+	/* On native_sim, the cycle counter follows simulated time and can read zero. */
+	TC_PRINT("cJSON:  %zu allocations, %llu cycles per message\n",
+		 cjson_allocs / BENCH_ITERATIONS, cjson_cycles / BENCH_ITERATIONS);
+	TC_PRINT("stream: %zu allocations, %llu cycles per message\n",
+		 stream_allocs / BENCH_ITERATIONS, stream_cycles / BENCH_ITERATIONS);
+
+	zassert_true(cjson_allocs > 0);
+	zassert_equal(stream_allocs, 0);
+}
+
+ZTEST_SUITE(nrf_cloud_msg_stream, NULL, suite_setup, NULL, NULL, NULL);
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_log.h>
+#include "nrf_cloud_codec_internal.h"
+#include "nrf_cloud_coap_transport.h"
+#include "nrf_cloud_log_internal.h"
+
+LOG_MODULE_REGISTER(nrf_cloud_log_test, LOG_LEVEL_INF);
+
+/* Every encoded log takes ENCODED_LEN bytes and one separator byte in the ring buffer. */
+#define ENCODED_FMT "{\"m\":\"%-32.32s\"}"
+#define ENCODED_LEN 40
+#define ENCODED_TAG "{\"m\":"
+
+/* Number of logs that fill the ring buffer just below the batching threshold. */
+#define BELOW_THRESHOLD_CNT                                                                        \
+	((CONFIG_NRF_CLOUD_LOG_RING_BUF_SIZE * CONFIG_NRF_CLOUD_LOG_BATCH_THRESHOLD / 100) /       \
+	 (ENCODED_LEN + 1))
+
+#define MAX_AGE_MS (CONFIG_NRF_CLOUD_LOG_BATCH_MAX_AGE_S * MSEC_PER_SEC)
+/* Margin for the logging thread and the upload work queue to run. */
+#define MARGIN_MS 300
+
+static bool connected;
+static bool send_block;
+static int uploads;
+static int uploaded_logs;
+static char upload_thread[CONFIG_THREAD_MAX_NAME_LEN];
+
+static K_SEM_DEFINE(send_started, 0, 1);
+static K_SEM_DEFINE(send_release, 0, 1);
+
+/* Stand-ins for the nRF Cloud library functions, which are not part of the test. */
+void nrf_cloud_log_init(void)
+{
+}
+
+bool nrf_cloud_log_is_enabled(void)
+{
+	return true;
+}
+
+int nrf_cloud_log_control_get(void)
+{
+	return LOG_LEVEL_DBG;
+}
+
+void nrf_cloud_log_init_context_internal(void *rest_ctx, const char *dev_id, int log_level,
+					 uint32_t src_id, const char *src_name, uint8_t dom_id,
+					 int64_t ts, struct nrf_cloud_log_context *context)
+{
+	ARG_UNUSED(rest_ctx);
+	ARG_UNUSED(dev_id);
+	ARG_UNUSED(src_name);
+
+	memset(context, 0, sizeof(*context));
+	context->level = log_level;
+	context->src_id = src_id;
+	context->dom_id = dom_id;
+	context->ts = ts;
+}
+
+int nrf_cloud_log_json_encode(struct nrf_cloud_log_context *ctx, uint8_t *buf, size_t size,
+			      struct nrf_cloud_data *output)
+{
+	char *encoded = k_malloc(ENCODED_LEN + 1);
+
+	ARG_UNUSED(ctx);
+	ARG_UNUSED(size);
+
+	if (!encoded) {
+		return -ENOMEM;
+	}
+
+	/* The backend terminates the rendered text. */
+	snprintf(encoded, ENCODED_LEN + 1, ENCODED_FMT, (const char *)buf);
+	output->ptr = encoded;
+	output->len = ENCODED_LEN;
+
+	return 0;
+}
+
+void cJSON_free(void *object)
+{
+	k_free(object);
+}
+
+bool nrf_cloud_coap_is_connected(void)
+{
+	return connected;
+}
+
+int nrf_cloud_coap_json_message_send(const char *message, bool bulk, bool confirmable)
+{
+	const char *entry = message;
+
+	zassert_true(bulk, "Logs not sent in bulk");
+	ARG_UNUSED(confirmable);
+
+	strncpy(upload_thread, k_thread_name_get(k_current_get()), sizeof(upload_thread) - 1);
+
+	if (send_block) {
+		k_sem_give(&send_started);
+		zassert_ok(k_sem_take(&send_release, K_SECONDS(5)), "Send not released");
+	}
+
+	while ((entry = strstr(entry, ENCODED_TAG)) != NULL) {
+		uploaded_logs++;
+		entry++;
+	}
+	uploads++;
+
+	return 0;
+}
+
+int nrf_cloud_coap_bin_log_send(const uint8_t * const buf, size_t buf_len, bool confirmable)
+{
+	ARG_UNUSED(buf);
+	ARG_UNUSED(buf_len);
+	ARG_UNUSED(confirmable);
+
+	return -ENOTSUP;
+}
+
+static void logs_generate(int count)
+{
+	for (int i = 0; i < count; i++) {
+		LOG_INF("Test log %d", i);
+	}
+}
+
+/* Waits until the logging thread has processed all pending log messages. */
+static void logs_process(void)
+{
+	for (int i = 0; (i < MARGIN_MS / 10) && log_data_pending(); i++) {
+		k_sleep(K_MSEC(10));
+	}
+	zassert_false(log_data_pending(), "Logging thread blocked");
+
+	k_sleep(K_MSEC(10));
+}
+
+static void *log_backend_setup(void)
+{
+	connected = true;
+	nrf_cloud_log_backend_enable_internal(true);
+
+	return NULL;
+}
+
+static void log_backend_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Upload the logs left by the previous test. */
+	logs_process();
+	k_sleep(K_MSEC(MAX_AGE_MS + MARGIN_MS));
+
+	send_block = false;
+	uploads = 0;
+	uploaded_logs = 0;
+	memset(upload_thread, 0, sizeof(upload_thread));
+	k_sem_reset(&send_started);
+	k_sem_reset(&send_release);
+}
+
+ZTEST_SUITE(nrf_cloud_log_backend, NULL, log_backend_setup, log_backend_before, NULL, NULL);
+
+ZTEST(nrf_cloud_log_backend, test_batch_max_age)
+{
+	logs_generate(2);
+	logs_process();
+
+	/* Below the threshold, the logs stay buffered until the oldest one is too old. */
+	zassert_equal(0, uploads, "Logs uploaded before the maximum age");
+
+	k_sleep(K_MSEC(MAX_AGE_MS + MARGIN_MS));
+
+	zassert_equal(1, uploads, "Unexpected number of uploads: %d", uploads);
+	zassert_equal(2, uploaded_logs, "Unexpected number of uploaded logs: %d", uploaded_logs);
+	zassert_str_equal("nrf_cloud_log", upload_thread, "Logs uploaded from thread %s",
+			  upload_thread);
+}
+
+ZTEST(nrf_cloud_log_backend, test_batch_threshold)
+{
+	logs_generate(BELOW_THRESHOLD_CNT);
+	logs_process();
+
+	zassert_equal(0, uploads, "Logs uploaded below the threshold");
+
+	/* The log that reaches the threshold triggers the upload from the logging thread. */
+	logs_generate(1);
+	logs_process();
+
+	zassert_equal(1, uploads, "Unexpected number of uploads: %d", uploads);
+	zassert_equal(BELOW_THRESHOLD_CNT + 1, uploaded_logs,
+		      "Unexpected number of uploaded logs: %d", uploaded_logs);
+	zassert_str_equal("logging", upload_thread, "Logs uploaded from thread %s",
+			  upload_thread);
+}
+
+ZTEST(nrf_cloud_log_backend, test_flush_not_blocking)
+{
+	send_block = true;
+
+	logs_generate(1);
+	logs_process();
+
+	zassert_ok(k_sem_take(&send_started, K_MSEC(MAX_AGE_MS + MARGIN_MS)),
+		   "Logs not uploaded after the maximum age");
+
+	/* The logging thread does not wait for the upload in progress. The logs it processes
+	 * meanwhile are stored and uploaded in the next batch.
+	 */
+	logs_generate(3);
+	logs_process();
+
+	send_block = false;
+	k_sem_give(&send_release);
+	k_sleep(K_MSEC(MAX_AGE_MS + MARGIN_MS));
+
+	zassert_equal(2, uploads, "Unexpected number of uploads: %d", uploads);
+	zassert_equal(4, uploaded_logs, "Unexpected number of uploaded logs: %d", uploaded_logs);
+}
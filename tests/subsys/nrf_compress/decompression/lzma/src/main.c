@@ -350,6 +350,65 @@ ZTEST(nrf_compress_decompression, test_valid_data_large_decompression)
 #endif
 }
 
+ZTEST(nrf_compress_decompression, test_decompression_throughput)
+{
+	int rc;
+	uint32_t pos = 0;
+	uint32_t offset;
+	uint8_t *output;
+	uint32_t output_size;
+	uint32_t total_output_size = 0;
+	uint32_t start_cycles;
+	uint64_t elapsed_us;
+	struct nrf_compress_implementation *implementation;
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+	void *inst = &lzma_inst;
+
+	reset_dictionary_counters();
+#else
+	void *inst = NULL;
+#endif
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZMA);
+
+	rc = implementation->init(inst, dummy_data_large_output_size);
+	zassert_ok(rc, "Expected init to be successful");
+
+	start_cycles = k_cycle_get_32();
+
+	while (pos < sizeof(dummy_data_large_input)) {
+		rc = implementation->decompress_bytes_needed(inst);
+
+		if ((pos + rc) >= sizeof(dummy_data_large_input)) {
+			rc = implementation->decompress(inst, &dummy_data_large_input[pos],
+							(sizeof(dummy_data_large_input) - pos),
+							true, &offset, &output, &output_size);
+		} else {
+			rc = implementation->decompress(inst, &dummy_data_large_input[pos], rc,
+							false, &offset, &output, &output_size);
+		}
+
+		zassert_ok(rc, "Expected data decompress to be successful");
+
+		total_output_size += output_size;
+		pos += offset;
+	}
+
+	elapsed_us = MAX(k_cyc_to_us_floor64(k_cycle_get_32() - start_cycles), 1);
+
+	rc = implementation->deinit(inst);
+	zassert_ok(rc, "Expected deinit to be successful");
+
+	zassert_equal(total_output_size, dummy_data_large_output_size,
+		      "Expected decompressed data size to match");
+
+	TC_PRINT("Decompressed %u bytes in %llu us (%llu kB/s)\n", total_output_size,
+		 elapsed_us, (uint64_t)total_output_size * USEC_PER_SEC / 1024 / elapsed_us);
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+	TC_PRINT("Dictionary calls: %zu write, %zu read\n", write_dict_cnt, read_dict_cnt);
+#endif
+}
+
 ZTEST(nrf_compress_decompression, test_invalid_data_decompression)
 {
 	int rc;